@@ -97,6 +97,13 @@ else()
     message(STATUS "C++11 support enabled (CONDUIT_USE_CXX11 == 1)")
 endif()
 
+if(ENABLE_OPENMP)
+    set(CONDUIT_USE_OPENMP 1)
+    message(STATUS "OpenMP support enabled (CONDUIT_USE_OPENMP == 1)")
+else()
+    message(STATUS "OpenMP support disabled")
+endif()
+
 ################################
 # Examples and Utils Flags
 ################################
@@ -81,6 +81,39 @@ function(add_cpp_test)
 endfunction()
 
 
+##------------------------------------------------------------------------------
+## - Builds a gtest based benchmark, which is not added to the ctest run
+##
+## add_cpp_benchmark( NAME bench SOURCES b_one.cpp b_two.cpp DEPENDS_ON dep1 ... )
+##------------------------------------------------------------------------------
+function(add_cpp_benchmark)
+
+    set(options)
+    set(singleValueArgs NAME FOLDER)
+    set(multiValueArgs DEPENDS_ON SOURCES)
+
+    # parse our arguments
+    cmake_parse_arguments(args
+                         "${options}"
+                         "${singleValueArgs}"
+                         "${multiValueArgs}" ${ARGN} )
+
+    message(STATUS " [*] Adding Benchmark: ${args_NAME} ")
+
+    # note: OUTPUT_DIR is ignored on windows
+    blt_add_executable( NAME ${args_NAME}
+                        SOURCES ${args_SOURCES}
+                        OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}
+                        DEPENDS_ON "${args_DEPENDS_ON}" gtest)
+
+    # set folder if passed
+    if( DEFINED args_FOLDER )
+        blt_set_target_folder(TARGET ${args_NAME} FOLDER ${args_FOLDER})
+    endif()
+
+endfunction()
+
+
 ##------------------------------------------------------------------------------
 ## - Builds and adds a test that uses gtest and mpi
 ##
@@ -63,6 +63,7 @@
 #include "conduit_data_array.hpp"
 #include "conduit_schema.hpp"
 #include "conduit_node.hpp"
+#include "conduit_node_view.hpp"
 #include "conduit_generator.hpp"
 #include "conduit_utils.hpp"
 
@@ -73,6 +73,80 @@ using namespace conduit::utils;
 namespace conduit
 {
 
+//-----------------------------------------------------------------------------
+//
+// -- json number emit helpers --
+//
+//-----------------------------------------------------------------------------
+
+// size of the chunks json output is batched into before writing to the
+// output stream
+static const size_t json_emit_chunk_bytes = 16384;
+
+// max chars a single formatted value (plus separator and quotes) can use
+static const size_t json_emit_max_value_chars = 40;
+
+//---------------------------------------------------------------------------//
+// writes a single value, the number format is selected at compile time
+// based on the array element type
+//---------------------------------------------------------------------------//
+template <typename T,
+          bool IS_INT = std::numeric_limits<T>::is_integer,
+          bool IS_SIGNED = std::numeric_limits<T>::is_signed>
+struct JSONNumberWriter;
+
+// signed ints
+template <typename T>
+struct JSONNumberWriter<T,true,true>
+{
+    static char *write(T value, char *ptr)
+    {
+        return utils::int64_to_chars((int64)value,ptr);
+    }
+};
+
+// unsigned ints
+template <typename T>
+struct JSONNumberWriter<T,true,false>
+{
+    static char *write(T value, char *ptr)
+    {
+        return utils::uint64_to_chars((uint64)value,ptr);
+    }
+};
+
+// floats, inf and nan are quoted since they aren't valid json numbers
+template <typename T>
+struct JSONNumberWriter<T,false,true>
+{
+    static char *write(T value, char *ptr)
+    {
+        // inf - inf and nan - nan are both nan, which fails this check
+        bool finite = (value - value) == (value - value);
+
+        if(!finite)
+        {
+            *ptr++ = '"';
+        }
+
+        if(sizeof(T) == sizeof(float32))
+        {
+            ptr = utils::float32_to_chars((float32)value,ptr);
+        }
+        else
+        {
+            ptr = utils::float64_to_chars((float64)value,ptr);
+        }
+
+        if(!finite)
+        {
+            *ptr++ = '"';
+        }
+
+        return ptr;
+    }
+};
+
 
 //-----------------------------------------------------------------------------
 //
@@ -334,66 +408,50 @@ template <typename T>
 void            
 DataArray<T>::to_json(std::ostream &os) const 
 { 
+    if(!m_dtype.is_number())
+    {
+        CONDUIT_ERROR("Leaf type \"" 
+                      <<  m_dtype.name()
+                      << "\"" 
+                      << "is not supported in conduit::DataArray.")
+    }
+
     index_t nele = number_of_elements();
+
+    // values are formatted into a local chunk, which is written to the
+    // stream when it fills up, avoiding per value stream overhead
+    char  buffer[json_emit_chunk_bytes];
+    char *ptr = buffer;
+    char *flush_at = buffer + json_emit_chunk_bytes - json_emit_max_value_chars;
+
     if(nele > 1)
-        os << "[";
+        *ptr++ = '[';
+
+    const char *data = (const char*)element_ptr(0);
+    index_t stride   = m_dtype.stride();
 
-    bool first=true;
     for(index_t idx = 0; idx < nele; idx++)
     {
-        if(!first)
-            os << ", ";
-        switch(m_dtype.id())
+        if(ptr >= flush_at)
         {
-            // ints 
-            case DataType::INT8_ID:
-            case DataType::INT16_ID: 
-            case DataType::INT32_ID:
-            case DataType::INT64_ID:
-            {
-                 os << (int64) element(idx);
-                 break;
-            }
-            // uints
-            case DataType::UINT8_ID:
-            case DataType::UINT16_ID:
-            case DataType::UINT32_ID:
-            case DataType::UINT64_ID:
-            {
-                os << (uint64) element(idx);
-                break;
-            }
-            // floats 
-            case DataType::FLOAT32_ID: 
-            case DataType::FLOAT64_ID: 
-            {
-                std::string fs = utils::float64_to_string((float64)element(idx));
-                //check for inf and nan
-                // looking for 'n' covers inf and nan
-                bool inf_or_nan = fs.find('n') != std::string::npos;
-                
-                if(inf_or_nan)
-                    os << "\"";
-                
-                os << fs;
-
-                if(inf_or_nan)
-                    os << "\"";
-                break;
-            }
-            default:
-            {
-                CONDUIT_ERROR("Leaf type \"" 
-                              <<  m_dtype.name()
-                              << "\"" 
-                              << "is not supported in conduit::DataArray.")
-            }
+            os.write(buffer,(std::streamsize)(ptr - buffer));
+            ptr = buffer;
         }
-        first=false;
+
+        if(idx > 0)
+        {
+            *ptr++ = ',';
+            *ptr++ = ' ';
+        }
+
+        ptr = JSONNumberWriter<T>::write(*(const T*)(data + idx * stride),
+                                         ptr);
     }
 
     if(nele > 1)
-        os << "]";
+        *ptr++ = ']';
+
+    os.write(buffer,(std::streamsize)(ptr - buffer));
 }
 
 
@@ -653,13 +711,15 @@ DataArray<T>::compact_elements_to(uint8 *data) const
     // copy all elements 
     index_t num_ele   = m_dtype.number_of_elements();
     index_t ele_bytes = DataType::default_bytes(m_dtype.id());
-    uint8 *data_ptr = data;
-    for(index_t i=0;i<num_ele;i++)
+
+    if(num_ele > 0)
     {
-        memcpy(data_ptr,
-               element_ptr(i),
-               (size_t)ele_bytes);
-        data_ptr+=ele_bytes;
+        utils::strided_copy(data,
+                            ele_bytes,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            num_ele,
+                            ele_bytes);
     }
 }
 
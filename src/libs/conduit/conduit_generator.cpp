@@ -55,6 +55,9 @@
 //-----------------------------------------------------------------------------
 #include <stdio.h>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <map>
 
 //-----------------------------------------------------------------------------
 // -- rapidjson includes -- 
@@ -144,36 +147,16 @@ public:
     
     static index_t check_homogenous_json_array(const rapidjson::Value &jvalue);
     
-    static void    parse_json_int64_array(const rapidjson::Value &jvalue,
-                                          std::vector<int64> &res);
-
-    // for efficiency - assumes res is already alloced to proper size
-    static void    parse_json_int64_array(const rapidjson::Value &jvalue,
-                                          int64_array &res);
-
+    // these write directly into the node's (already alloced) data array
     static void    parse_json_int64_array(const rapidjson::Value &jvalue,
                                           Node &node);
-                                          
-    static void    parse_json_uint64_array(const rapidjson::Value &jvalue,
-                                           std::vector<uint64> &res);
-
-    // for efficiency - assumes res is already alloced to proper size
-    static void    parse_json_uint64_array(const rapidjson::Value &jvalue,
-                                          uint64_array &res);
 
-                                           
     static void    parse_json_uint64_array(const rapidjson::Value &jvalue,
                                            Node &node);
-                                           
-    static void    parse_json_float64_array(const rapidjson::Value &jvalue,
-                                            std::vector<float64> &res);
-
-    // for efficiency - assumes res is already alloced to proper size
-    static void    parse_json_float64_array(const rapidjson::Value &jvalue,
-                                            float64_array &res);
 
     static void    parse_json_float64_array(const rapidjson::Value &jvalue,
                                             Node &node);
+
     static index_t parse_leaf_dtype_name(const std::string &dtype_name);
     
     static void    parse_leaf_dtype(const rapidjson::Value &jvalue,
@@ -190,10 +173,6 @@ public:
                                     const   rapidjson::Value &jvalue,
                                     index_t curr_offset);
                                     
-    static void    walk_pure_json_schema(Node  *node,
-                                         Schema *schema,
-                                         const rapidjson::Value &jvalue);
-
     static void    walk_json_schema(Node   *node,
                                     Schema *schema,
                                     void   *data,
@@ -206,6 +185,20 @@ public:
     static void    parse_error_details(const std::string &json,
                                        const rapidjson::Document &document,
                                        std::ostream &os);
+
+    static void    parse_error_details(const std::string &json,
+                                       const rapidjson::ParseResult &res,
+                                       std::ostream &os);
+
+    // pure json is parsed with two passes of rapidjson's SAX reader
+    // (instead of building a DOM):
+    //  the first pass infers the compact schema, the second writes
+    //  values directly into the node's final storage
+    class PureJSONSchemaHandler;
+    class PureJSONDataHandler;
+
+    static void    parse_pure_json(const std::string &json,
+                                   Node &node);
   };
 //-----------------------------------------------------------------------------
 // Generator::Parser::YAML handles parsing via libyaml.
@@ -222,29 +215,52 @@ public:
     //-----------------------------------------------------------------------------
     // Wrappers around libyaml c API that help us parse
     //-----------------------------------------------------------------------------
-     
-    // YAMLParserWrapper class helps with libyaml cleanup when 
-    // exceptions are thrown during parsing
-    class YAMLParserWrapper
+
+    // YAMLEventParser class wraps libyaml's event (streaming) parser.
+    // It helps with libyaml cleanup when exceptions are thrown during 
+    // parsing, and tracks yaml anchors so aliases can be resolved.
+    class YAMLEventParser
     {
     public:
-        YAMLParserWrapper();
-       ~YAMLParserWrapper();
-
-       // parses and creates doc tree, throws exception
-       // when things go wrong
-       void         parse(const char *yaml_txt);
-
-       yaml_document_t *yaml_doc_ptr();
-       yaml_node_t     *yaml_doc_root_ptr();
+        YAMLEventParser(const char *yaml_txt);
+       ~YAMLEventParser();
+
+       // parses the next event, throws exception when things go wrong
+       yaml_event_t &next();
+       // access the current event
+       yaml_event_t &event();
+
+       // anchored scalars are tracked as text, so an alias to a scalar
+       // can take part in numeric sequences
+       void         add_anchor(const std::string &anchor,
+                               const char *scalar_txt);
+       // anchored mappings and sequences are tracked using the node
+       // they were parsed into
+       void         add_anchor(const std::string &anchor,
+                               const Node *node);
+
+       // returns NULL if the anchor does not refer to a scalar
+       const char  *anchor_scalar(const std::string &anchor) const;
+       // returns NULL if the anchor does not refer to a node
+       const Node  *anchor_node(const std::string &anchor) const;
 
     private:
-        yaml_document_t m_yaml_doc;
         yaml_parser_t   m_yaml_parser;
+        yaml_event_t    m_yaml_event;
 
         bool m_yaml_parser_is_valid;
-        bool m_yaml_doc_is_valid;
+        bool m_yaml_event_is_valid;
+
+        std::map<std::string,std::string>  m_scalar_anchors;
+        std::map<std::string,const Node*>  m_node_anchors;
+    };
 
+    // holds numeric sequence values until we know the sequence is
+    // homogenous
+    union YAMLNumber
+    {
+        int64   ival;
+        float64 fval;
     };
 
     // 
@@ -285,45 +301,42 @@ public:
     // converts c-string to long
     static long int string_to_long(const char *txt_value);
 
-    // assumes res is already inited to DataType::int64 w/ proper size
-    static void parse_yaml_int64_array(yaml_document_t *yaml_doc,
-                                       yaml_node_t *yaml_node,
-                                       Node &res);
-
-    // assumes res is already inited to DataType::float64 w/ proper size
-    static void parse_yaml_float64_array(yaml_document_t *yaml_doc,
-                                         yaml_node_t *yaml_node,
-                                         Node &res);
     // parses generic leaf and places value in res
     static void parse_yaml_inline_leaf(const char *yaml_txt,
                                        Node &res);
 
     // finds if leaf string is int64, float64, or neither (DataType::EMPTY_T)
-    static index_t yaml_leaf_to_numeric_dtype(const char *txt_value);
+    // and places the converted value in res
+    static index_t parse_yaml_number(const char *txt_value,
+                                     YAMLNumber &res);
 
-    // checks if the input yaml node is a homogenous numeric sequence
-    // 
-    // if not: returns DataType::EMPTY_T and seq_size = -1
-    //
-    // if so:
-    //  seq_size contains the sequence length and:
-    //  if homogenous integer sequence returns DataType::INT64_T 
-    //  if homogenous floating point sequence returns DataType::FLOAT64_T 
-    static index_t check_homogenous_yaml_numeric_sequence(const Node &node,
-                                                          yaml_document_t *yaml_doc,
-                                                          yaml_node_t *yaml_node,
-                                                          index_t &seq_size);
+    // creates a new child node (and schema) for an object or a list
+    static Node   *append_yaml_child(Node *node,
+                                     Schema *schema,
+                                     const std::string &name);
+    static Node   *append_yaml_child(Node *node,
+                                     Schema *schema);
 
     // main entry point for parsing pure yaml
     static void    walk_pure_yaml_schema(Node  *node,
                                          Schema *schema,
                                          const char *yaml_txt);
 
-    // workhorse for parsing a pure yaml tree
+    // workhorse for parsing a pure yaml tree, processes the events
+    // for the value that starts at the parser's current event
     static void    walk_pure_yaml_schema(Node  *node,
                                          Schema *schema,
-                                         yaml_document_t *yaml_doc,
-                                         yaml_node_t *yaml_node);
+                                         YAMLEventParser &parser);
+
+    // handles sequences, homogenous numeric sequences are packed into
+    // int64 or float64 arrays as they are parsed.
+    static void    walk_pure_yaml_sequence(Node  *node,
+                                           Schema *schema,
+                                           YAMLEventParser &parser);
+
+    // returns the anchor name for a scalar, mapping, or sequence event
+    // (empty if there is no anchor)
+    static std::string yaml_event_anchor(const yaml_event_t &event);
     
     // extract human readable parser errors
     static void    parse_error_details(yaml_parser_t *yaml_parser,
@@ -397,232 +410,111 @@ Generator::Parser::JSON::check_homogenous_json_array(const rapidjson::Value &jva
 }
 
 //---------------------------------------------------------------------------//
-void
-Generator::Parser::JSON::parse_json_int64_array(const rapidjson::Value &jvalue,
-                                                std::vector<int64> &res)
-{
-   res.resize(jvalue.Size(),0);
-   for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
-   {
-       res[i] = jvalue[i].GetInt64();
-   }
-}
-
-//---------------------------------------------------------------------------// 
-void
-Generator::Parser::JSON::parse_json_int64_array(const rapidjson::Value &jvalue,
-                                                int64_array &res)
-{
-    // for efficiency - assumes res is already alloced to proper size
-    for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
-    {
-       res[i] = jvalue[i].GetInt64();
-    }
-}
-
-
+// copies the entries of a json array directly into a node's data array
+// (the array is already alloced to the proper size)
 //---------------------------------------------------------------------------//
-void
-Generator::Parser::JSON::parse_json_int64_array(const rapidjson::Value &jvalue,
-                                                Node &node)
+template <typename T>
+static void
+json_array_to_data_array(const rapidjson::Value &jvalue,
+                         index_t src_id,
+                         DataArray<T> res)
 {
-    // TODO: we can make this more efficient 
-    std::vector<int64> vals;
-    parse_json_int64_array(jvalue,vals);
-    
-    switch(node.dtype().id())
+    rapidjson::SizeType num_vals = jvalue.Size();
+    if(src_id == DataType::INT64_ID)
     {
-        // signed ints
-        case DataType::INT8_ID:
-            node.as_int8_array().set(vals);
-            break;
-        case DataType::INT16_ID:
-            node.as_int16_array().set(vals);
-            break;
-        case DataType::INT32_ID:
-            node.as_int32_array().set(vals);
-            break;
-        case DataType::INT64_ID:
-            node.as_int64_array().set(vals);
-            break;
-        // unsigned ints
-        case DataType::UINT8_ID:
-            node.as_uint8_array().set(vals);
-            break;
-        case DataType::UINT16_ID:
-            node.as_uint16_array().set(vals);
-            break;
-        case DataType::UINT32_ID:
-            node.as_uint32_array().set(vals);
-            break;
-        case DataType::UINT64_ID:
-            node.as_uint64_array().set(vals);
-            break;  
-        //floats
-        case DataType::FLOAT32_ID:
-            node.as_float32_array().set(vals);
-            break;
-        case DataType::FLOAT64_ID:
-            node.as_float64_array().set(vals);
-            break;
-        default:
-            CONDUIT_ERROR("JSON Generator error:\n"
-                           << "attempting to set non-numeric Node with"
-                           << " int64 array");
-            break;
+        for (rapidjson::SizeType i = 0; i < num_vals; i++)
+        {
+            res[i] = (T)jvalue[i].GetInt64();
+        }
     }
-}
-
-//---------------------------------------------------------------------------//
-void
-Generator::Parser::JSON::parse_json_uint64_array(const rapidjson::Value &jvalue,
-                                                 std::vector<uint64> &res)
-{
-    res.resize(jvalue.Size(),0);
-    for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+    else if(src_id == DataType::UINT64_ID)
     {
-        res[i] = jvalue[i].GetUint64();
+        for (rapidjson::SizeType i = 0; i < num_vals; i++)
+        {
+            res[i] = (T)jvalue[i].GetUint64();
+        }
     }
-}
-
-//---------------------------------------------------------------------------// 
-void
-Generator::Parser::JSON::parse_json_uint64_array(const rapidjson::Value &jvalue,
-                                                 uint64_array &res)
-{
-    // for efficiency - assumes res is already alloced to proper size
-    for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
+    else
     {
-       res[i] = jvalue[i].GetUint64();
+        for (rapidjson::SizeType i = 0; i < num_vals; i++)
+        {
+            res[i] = (T)jvalue[i].GetDouble();
+        }
     }
 }
 
 //---------------------------------------------------------------------------//
-void
-Generator::Parser::JSON::parse_json_uint64_array(const rapidjson::Value &jvalue,
-                                                 Node &node)
+static void
+json_array_to_node(const rapidjson::Value &jvalue,
+                   index_t src_id,
+                   Node &node)
 {
-    // TODO: we can make this more efficient 
-    std::vector<uint64> vals;
-    parse_json_uint64_array(jvalue,vals);
-    
     switch(node.dtype().id())
     {
         // signed ints
         case DataType::INT8_ID:
-            node.as_int8_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_int8_array());
             break;
         case DataType::INT16_ID:
-            node.as_int16_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_int16_array());
             break;
         case DataType::INT32_ID:
-            node.as_int32_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_int32_array());
             break;
         case DataType::INT64_ID:
-            node.as_int64_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_int64_array());
             break;
         // unsigned ints
         case DataType::UINT8_ID:
-            node.as_uint8_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_uint8_array());
             break;
         case DataType::UINT16_ID:
-            node.as_uint16_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_uint16_array());
             break;
         case DataType::UINT32_ID:
-            node.as_uint32_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_uint32_array());
             break;
         case DataType::UINT64_ID:
-            node.as_uint64_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_uint64_array());
             break;  
         //floats
         case DataType::FLOAT32_ID:
-            node.as_float32_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_float32_array());
             break;
         case DataType::FLOAT64_ID:
-            node.as_float64_array().set(vals);
+            json_array_to_data_array(jvalue,src_id,node.as_float64_array());
             break;
         default:
             CONDUIT_ERROR("JSON Generator error:\n"
                            << "attempting to set non-numeric Node with"
-                           << " uint64 array");
+                           << " " << DataType::id_to_name(src_id)
+                           << " array");
             break;
     }
 }
 
 //---------------------------------------------------------------------------//
 void
-Generator::Parser::JSON::parse_json_float64_array(const rapidjson::Value &jvalue,
-                                                  std::vector<float64> &res)
+Generator::Parser::JSON::parse_json_int64_array(const rapidjson::Value &jvalue,
+                                                Node &node)
 {
-    res.resize(jvalue.Size(),0);
-    for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
-    {
-        res[i] = jvalue[i].GetDouble();
-    }
+    json_array_to_node(jvalue,DataType::INT64_ID,node);
 }
 
-//---------------------------------------------------------------------------// 
+//---------------------------------------------------------------------------//
 void
-Generator::Parser::JSON::parse_json_float64_array(const rapidjson::Value &jvalue,
-                                                  float64_array &res)
+Generator::Parser::JSON::parse_json_uint64_array(const rapidjson::Value &jvalue,
+                                                 Node &node)
 {
-    // for efficiency - assumes res is already alloced to proper size
-    for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
-    {
-       res[i] = jvalue[i].GetDouble();
-    }
+    json_array_to_node(jvalue,DataType::UINT64_ID,node);
 }
 
-
 //---------------------------------------------------------------------------//
 void
 Generator::Parser::JSON::parse_json_float64_array(const rapidjson::Value &jvalue,
                                                   Node &node)
 {
-    // TODO: we can make this more efficient 
-    std::vector<float64> vals;
-    parse_json_float64_array(jvalue,vals);
-    
-    switch(node.dtype().id())
-    {
-        case DataType::INT8_ID:
-            node.as_int8_array().set(vals);
-            break;
-        case DataType::INT16_ID:
-            node.as_int16_array().set(vals);
-            break;
-        case DataType::INT32_ID:
-            node.as_int32_array().set(vals);
-            break;
-        case DataType::INT64_ID:
-            node.as_int64_array().set(vals);
-            break;
-        // unsigned ints
-        case DataType::UINT8_ID:
-            node.as_uint8_array().set(vals);
-            break;
-        case DataType::UINT16_ID:
-            node.as_uint16_array().set(vals);
-            break;
-        case DataType::UINT32_ID:
-            node.as_uint32_array().set(vals);
-            break;
-        case DataType::UINT64_ID:
-            node.as_uint64_array().set(vals);
-            break;  
-        //floats
-        case DataType::FLOAT32_ID:
-            node.as_float32_array().set(vals);
-            break;
-        case DataType::FLOAT64_ID:
-            node.as_float64_array().set(vals);
-            break;
-        default:
-            CONDUIT_ERROR("JSON Generator error:\n"
-                           << "attempting to set non-numeric Node with"
-                           << " float64 array");
-            break;
-    }
+    json_array_to_node(jvalue,DataType::FLOAT64_ID,node);
 }
 
 
@@ -1076,134 +968,6 @@ Generator::Parser::JSON::walk_json_schema(Schema *schema,
     }
 }
 
-//---------------------------------------------------------------------------//
-void 
-Generator::Parser::JSON::walk_pure_json_schema(Node *node,
-                                               Schema *schema,
-                                               const rapidjson::Value &jvalue)
-{
-    // object cases
-    if(jvalue.IsObject())
-    {
-        // if we make it here and have an empty json object
-        // we still want the conduit node to take on the
-        // object role
-        schema->set(DataType::object());
-        // loop over all entries
-        for (rapidjson::Value::ConstMemberIterator itr = jvalue.MemberBegin(); 
-             itr != jvalue.MemberEnd(); ++itr)
-        {
-            std::string entry_name(itr->name.GetString());
-            
-            // json files may have duplicate object names
-            // we could provide some clear semantics, such as:
-            //   always use first instance, or always use last instance
-            // however duplicate object names are most likely a
-            // typo, so it's best to throw an error
-
-            if(schema->has_child(entry_name))
-            {
-                CONDUIT_ERROR("JSON Generator error:\n"
-                              << "Duplicate JSON object name: " 
-                              << utils::join_path(node->path(),entry_name));
-            }
-
-            Schema *curr_schema = schema->fetch_ptr(entry_name);
-
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
-            node->append_node_ptr(curr_node);
-
-            walk_pure_json_schema(curr_node,
-                                  curr_schema,
-                                  itr->value);
-        }
-    }
-    // List case 
-    else if (jvalue.IsArray()) 
-    {
-        index_t hval_type = check_homogenous_json_array(jvalue);
-        if(hval_type == DataType::INT64_ID)
-        {
-            node->set(DataType::int64(jvalue.Size()));
-            int64_array vals = node->value();
-            parse_json_int64_array(jvalue,vals);
-        }
-        else if(hval_type == DataType::FLOAT64_ID)
-        {
-            node->set(DataType::float64(jvalue.Size()));
-            float64_array vals = node->value();
-            parse_json_float64_array(jvalue,vals);
-        }
-        else // not numeric array
-        {
-            // if we make it here and have an empty json list
-            // we still want the conduit node to take on the
-            // list role
-            schema->set(DataType::list());
-            
-            for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
-            {
-                schema->append();
-                Schema *curr_schema = schema->child_ptr(i);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
-                node->append_node_ptr(curr_node);
-                walk_pure_json_schema(curr_node,curr_schema,jvalue[i]);
-            }
-        }
-    }
-    // Simplest case, handles "uint32", "float64", with extended type info
-    else if(jvalue.IsString()) // bytestr case
-    {
-        std::string sval(jvalue.GetString());
-        node->set(sval);
-    }
-    else if(jvalue.IsNull())
-    {
-        node->reset();
-    }
-    else if(jvalue.IsBool())
-    {
-        // we store bools as uint8s
-        if(jvalue.IsTrue())
-        {
-            node->set((uint8)1);
-        }
-        else
-        {
-            node->set((uint8)0);
-        }
-    }
-    else if(jvalue.IsNumber())
-    {
-        // use 64bit types by default ... 
-        if(jvalue.IsInt() || jvalue.IsInt64())
-        {
-            node->set((int64)jvalue.GetInt64());
-        }
-        else if(jvalue.IsUint() || jvalue.IsUint64())
-        {
-            node->set((uint64)jvalue.GetUint64());
-        }
-        else  // double case
-        {
-            node->set((float64)jvalue.GetDouble());
-        }
-    }
-    else
-    {
-        // not sure if can an even land here, but catch error just in case.
-        CONDUIT_ERROR("JSON Generator error:\n"
-                      << "Invalid JSON type for parsing Node from pure JSON."
-                      << " Expected: JSON Object, Array, String, Null,"
-                      << " Boolean, or Number");
-    }
-}
-
-
 //---------------------------------------------------------------------------//
 void 
 Generator::Parser::JSON::walk_json_schema(Node   *node,
@@ -1398,19 +1162,16 @@ Generator::Parser::JSON::parse_base64(Node *node,
 {
     // object case
 
-    std::string base64_str = "";
-    
     if(jvalue.IsObject())
     {
         Schema s;
-        if (jvalue.HasMember("data") && jvalue["data"].HasMember("base64"))
-        {
-            base64_str = jvalue["data"]["base64"].GetString();
-        }
-        else
+        if (!jvalue.HasMember("data") || 
+            !jvalue["data"].HasMember("base64"))
         {
             CONDUIT_ERROR("conduit_base64_json protocol error: missing data/base64");
         }
+
+        const rapidjson::Value &jb64 = jvalue["data"]["base64"];
         
         if (jvalue.HasMember("schema"))
         {
@@ -1422,23 +1183,21 @@ Generator::Parser::JSON::parse_base64(Node *node,
         {
             CONDUIT_ERROR("conduit_base64_json protocol error: missing schema");
         }
-        
-        const char *src_ptr = base64_str.c_str();
-        index_t encoded_len = (index_t) base64_str.length();
-        index_t dec_buff_size = utils::base64_decode_buffer_size(encoded_len);
 
-        // decode buffer
-        Node bb64_decode;
-        bb64_decode.set(DataType::char8_str(dec_buff_size));
-        char *decode_ptr = (char*)bb64_decode.data_ptr();
-        memset(decode_ptr,0,dec_buff_size);
+        // allocate the compact result and decode straight into it
+        node->set(s);
 
+        const char *src_ptr = jb64.GetString();
+        index_t encoded_len = (index_t) jb64.GetStringLength();
+        index_t data_nbytes = node->allocated_bytes();
+        uint8  *data_ptr    = (uint8*)node->data_ptr();
+
+        // (set() zero fills, so any data missing from a short encoded
+        //  string is left as zeros)
         utils::base64_decode(src_ptr,
                              encoded_len,
-                             decode_ptr);
-
-        node->set(s,decode_ptr);
-
+                             data_ptr,
+                             data_nbytes);
     }
     else
     {
@@ -1481,46 +1240,547 @@ Generator::Parser::JSON::parse_error_details(const std::string &json,
        << " json:\n"     << json << "\n"; 
 }
 
-//-----------------------------------------------------------------------------
-// -- end conduit::Generator::Parser::JSON --
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML --
-//-----------------------------------------------------------------------------
-
-
-//-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML::YAMLParserWrapper --
-//-----------------------------------------------------------------------------
-
-
 //---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::YAMLParserWrapper()
-: m_yaml_parser_is_valid(false),
-  m_yaml_doc_is_valid(false)
+void 
+Generator::Parser::JSON::parse_error_details(const std::string &json,
+                                             const rapidjson::ParseResult &res,
+                                             std::ostream &os)
 {
+    // provide message with line + char from rapidjson parse error offset 
+    index_t doc_offset = (index_t)res.Offset();
+    std::string json_curr = json.substr(0,doc_offset);
 
-}
-
-//---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::~YAMLParserWrapper()
-{
-    // cleanup!
-    if(m_yaml_parser_is_valid)
+    std::string curr = "";
+    std::string next = " ";
+    
+    index_t doc_line   = 0;
+    index_t doc_char   = 0;
+
+    while(!next.empty())
     {
-        yaml_parser_delete(&m_yaml_parser);
+        utils::split_string(json_curr, "\n", curr, next);
+        doc_char = curr.size();
+        json_curr = next;
+        if(!next.empty())
+        {
+            doc_line++;
+        }
     }
 
-    if(m_yaml_doc_is_valid)
+    os << " parse error message:\n"
+       << GetParseError_En(res.Code()) << "\n"
+       << " offset: "    << doc_offset << "\n"
+       << " line: "      << doc_line << "\n"
+       << " character: " << doc_char << "\n"
+       << " json:\n"     << json << "\n"; 
+}
+
+//-----------------------------------------------------------------------------
+// Generator::Parser::JSON::PureJSONSchemaHandler
+//-----------------------------------------------------------------------------
+// SAX handler for the first pure json pass. 
+//
+// Builds the schema for the parsed node, with the same rules used for 
+// pure json everywhere else:
+//  - objects become conduit objects
+//  - arrays of numbers become int64 or float64 arrays (promoted to float64
+//    if any entry is a float), other arrays become lists
+//  - numbers become int64, uint64 (if too large for int64) or float64 
+//  - bools become uint8, strings become char8_str, null becomes empty
+//
+// Array types are inferred in one pass: an array is treated as numeric
+// (tracking only the count and widest type) until it sees a value that
+// is not a number, at which point it becomes a list.
+//
+// Leaves are given compact offsets in the order they complete, which is
+// the same order used by Schema::compact_to().
+//-----------------------------------------------------------------------------
+class Generator::Parser::JSON::PureJSONSchemaHandler
+{
+public:
+    PureJSONSchemaHandler(Schema &schema)
+    : m_schema(schema),
+      m_stack(),
+      m_key(),
+      m_offset(0)
+    {}
+
+    bool Null()
     {
-        yaml_document_delete(&m_yaml_doc);
+        next_schema();
+        return true;
+    }
+
+    bool Bool(bool )
+    {
+        leaf(DataType::uint8(1));
+        return true;
+    }
+
+    bool Int(int )               { return number(DataType::INT64_ID); }
+    bool Uint(unsigned )         { return number(DataType::INT64_ID); }
+    bool Int64(int64_t )         { return number(DataType::INT64_ID); }
+    bool Uint64(uint64_t val)
+    {
+        // only values too large for an int64 are treated as uint64
+        if(val > (uint64_t)std::numeric_limits<int64>::max())
+        {
+            return number(DataType::UINT64_ID);
+        }
+        return number(DataType::INT64_ID);
+    }
+    bool Double(double )         { return number(DataType::FLOAT64_ID); }
+
+    bool RawNumber(const char *, rapidjson::SizeType, bool)
+    {
+        // not used w/o kParseNumbersAsStringsFlag
+        return false;
+    }
+
+    bool String(const char *, rapidjson::SizeType length, bool)
+    {
+        leaf(DataType::char8_str(length + 1));
+        return true;
+    }
+
+    bool StartObject()
+    {
+        Schema *schema = next_schema();
+        schema->set(DataType::object());
+        push(schema,OBJECT_FRAME);
+        return true;
+    }
+
+    bool Key(const char *str, rapidjson::SizeType length, bool)
+    {
+        m_key.assign(str,length);
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType)
+    {
+        m_stack.pop_back();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        // assume numeric until we see otherwise
+        push(next_schema(),NUMERIC_FRAME);
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType)
+    {
+        Frame &frame = m_stack.back();
+        if(frame.kind == NUMERIC_FRAME)
+        {
+            if(frame.count == 0)
+            {
+                // empty arrays become empty lists
+                frame.schema->set(DataType::list());
+            }
+            else
+            {
+                DataType dt(frame.num_id,
+                            frame.count,
+                            m_offset,
+                            8,
+                            8,
+                            Endianness::DEFAULT_ID);
+                frame.schema->set(dt);
+                m_offset += dt.bytes_compact();
+            }
+        }
+        m_stack.pop_back();
+        return true;
+    }
+
+private:
+    enum FrameKind
+    {
+        OBJECT_FRAME,
+        LIST_FRAME,
+        NUMERIC_FRAME
+    };
+
+    struct Frame
+    {
+        Schema   *schema;
+        FrameKind kind;
+        // number of entries seen in a numeric array
+        index_t   count;
+        // widest type seen in a numeric array
+        index_t   num_id;
+    };
+
+    //-----------------------------------------------------------------------
+    void push(Schema *schema, FrameKind kind)
+    {
+        Frame frame;
+        frame.schema = schema;
+        frame.kind   = kind;
+        frame.count  = 0;
+        frame.num_id = DataType::INT64_ID;
+        m_stack.push_back(frame);
+    }
+
+    //-----------------------------------------------------------------------
+    // returns the schema for the next value
+    Schema *next_schema()
+    {
+        if(m_stack.empty())
+        {
+            return &m_schema;
+        }
+
+        Frame &frame = m_stack.back();
+        if(frame.kind == OBJECT_FRAME)
+        {
+            // json files may have duplicate object names
+            // duplicate object names are most likely a typo, 
+            // so it's best to throw an error
+            if(frame.schema->has_child(m_key))
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "Duplicate JSON object name: " 
+                              << m_key);
+            }
+            return frame.schema->fetch_ptr(m_key);
+        }
+
+        if(frame.kind == NUMERIC_FRAME)
+        {
+            to_list(frame);
+        }
+
+        return &frame.schema->append();
+    }
+
+    //-----------------------------------------------------------------------
+    // converts a numeric array frame into a list, the numbers seen so far
+    // become 8 byte leaves (int64 placeholders, the second pass sets
+    // their final type)
+    void to_list(Frame &frame)
+    {
+        frame.schema->set(DataType::list());
+        for(index_t i = 0; i < frame.count; i++)
+        {
+            frame.schema->append().set(DataType::int64(1,m_offset));
+            m_offset += 8;
+        }
+        frame.kind = LIST_FRAME;
+    }
+
+    //-----------------------------------------------------------------------
+    void leaf(const DataType &dtype)
+    {
+        // note: next_schema() may convert a numeric array to a list,
+        // which moves the offset
+        Schema *schema = next_schema();
+        DataType dt(dtype);
+        dt.set_offset(m_offset);
+        schema->set(dt);
+        m_offset += dt.bytes_compact();
+    }
+
+    //-----------------------------------------------------------------------
+    bool number(index_t dtype_id)
+    {
+        if(!m_stack.empty() && m_stack.back().kind == NUMERIC_FRAME)
+        {
+            Frame &frame = m_stack.back();
+            frame.count++;
+            if(dtype_id == DataType::FLOAT64_ID)
+            {
+                frame.num_id = DataType::FLOAT64_ID;
+            }
+        }
+        else
+        {
+            leaf(DataType(dtype_id,1,0,8,8,Endianness::DEFAULT_ID));
+        }
+        return true;
     }
-}
+
+    Schema             &m_schema;
+    std::vector<Frame>  m_stack;
+    std::string         m_key;
+    index_t             m_offset;
+};
+
+//-----------------------------------------------------------------------------
+// Generator::Parser::JSON::PureJSONDataHandler
+//-----------------------------------------------------------------------------
+// SAX handler for the second pure json pass, writes values into a node
+// that was allocated using the schema from the first pass.
+//-----------------------------------------------------------------------------
+class Generator::Parser::JSON::PureJSONDataHandler
+{
+public:
+    PureJSONDataHandler(Node &node)
+    : m_node(node),
+      m_stack(),
+      m_key_node(NULL)
+    {}
+
+    bool Null()
+    {
+        next_node();
+        return true;
+    }
+
+    bool Bool(bool val)
+    {
+        uint8 uval = val ? 1 : 0;
+        memcpy(next_node()->element_ptr(0),&uval,1);
+        return true;
+    }
+
+    bool Int(int val)           { return number((int64)val); }
+    bool Uint(unsigned val)     { return number((int64)val); }
+    bool Int64(int64_t val)     { return number((int64)val); }
+    bool Uint64(uint64_t val)
+    {
+        if(val > (uint64_t)std::numeric_limits<int64>::max())
+        {
+            if(!m_stack.empty() && m_stack.back().kind == NUMERIC_FRAME)
+            {
+                // arrays store these as int64 (as before)
+                return number((int64)val);
+            }
+            Node *node = next_node();
+            set_scalar_id(node,DataType::UINT64_ID);
+            uint64 uval = (uint64)val;
+            memcpy(node->element_ptr(0),&uval,8);
+            return true;
+        }
+        return number((int64)val);
+    }
+    bool Double(double val)
+    {
+        if(!m_stack.empty() && m_stack.back().kind == NUMERIC_FRAME)
+        {
+            Frame &frame = m_stack.back();
+            // numeric arrays with floats are always float64
+            ((float64*)frame.data)[frame.idx++] = (float64)val;
+            return true;
+        }
+        Node *node = next_node();
+        set_scalar_id(node,DataType::FLOAT64_ID);
+        float64 fval = (float64)val;
+        memcpy(node->element_ptr(0),&fval,8);
+        return true;
+    }
+
+    bool RawNumber(const char *, rapidjson::SizeType, bool)
+    {
+        return false;
+    }
+
+    bool String(const char *str, rapidjson::SizeType length, bool)
+    {
+        char *dest = (char*)next_node()->element_ptr(0);
+        memcpy(dest,str,length);
+        dest[length] = 0;
+        return true;
+    }
+
+    bool StartObject()
+    {
+        push(next_node(),OBJECT_FRAME);
+        return true;
+    }
+
+    bool Key(const char *str, rapidjson::SizeType length, bool)
+    {
+        m_key_node = &m_stack.back().node->fetch_child(std::string(str,
+                                                                   length));
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType)
+    {
+        m_stack.pop_back();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        Node *node = next_node();
+        if(node->dtype().is_list())
+        {
+            push(node,LIST_FRAME);
+        }
+        else
+        {
+            push(node,NUMERIC_FRAME);
+        }
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType)
+    {
+        m_stack.pop_back();
+        return true;
+    }
+
+private:
+    enum FrameKind
+    {
+        OBJECT_FRAME,
+        LIST_FRAME,
+        NUMERIC_FRAME
+    };
+
+    struct Frame
+    {
+        Node     *node;
+        FrameKind kind;
+        // index of the next list child or array entry
+        index_t   idx;
+        // numeric arrays: start of the array's data, and if it is float64
+        void     *data;
+        bool      is_float;
+    };
+
+    //-----------------------------------------------------------------------
+    void push(Node *node, FrameKind kind)
+    {
+        Frame frame;
+        frame.node     = node;
+        frame.kind     = kind;
+        frame.idx      = 0;
+        frame.data     = NULL;
+        frame.is_float = false;
+        if(kind == NUMERIC_FRAME)
+        {
+            frame.data     = node->element_ptr(0);
+            frame.is_float = node->dtype().is_float64();
+        }
+        m_stack.push_back(frame);
+    }
+
+    //-----------------------------------------------------------------------
+    Node *next_node()
+    {
+        if(m_stack.empty())
+        {
+            return &m_node;
+        }
+
+        Frame &frame = m_stack.back();
+        if(frame.kind == OBJECT_FRAME)
+        {
+            return m_key_node;
+        }
+        return &frame.node->child(frame.idx++);
+    }
+
+    //-----------------------------------------------------------------------
+    // numbers in lists may have been given a placeholder type in the 
+    // first pass, all of these are 8 bytes so only the id changes
+    void set_scalar_id(Node *node, index_t dtype_id)
+    {
+        const DataType &dt = node->dtype();
+        if(dt.id() != dtype_id)
+        {
+            node->schema_ptr()->set(DataType(dtype_id,
+                                             1,
+                                             dt.offset(),
+                                             8,
+                                             8,
+                                             dt.endianness()));
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    bool number(int64 val)
+    {
+        if(!m_stack.empty() && m_stack.back().kind == NUMERIC_FRAME)
+        {
+            Frame &frame = m_stack.back();
+            if(frame.is_float)
+            {
+                ((float64*)frame.data)[frame.idx++] = (float64)val;
+            }
+            else
+            {
+                ((int64*)frame.data)[frame.idx++] = val;
+            }
+            return true;
+        }
+
+        Node *node = next_node();
+        set_scalar_id(node,DataType::INT64_ID);
+        memcpy(node->element_ptr(0),&val,8);
+        return true;
+    }
+
+    Node               &m_node;
+    std::vector<Frame>  m_stack;
+    Node               *m_key_node;
+};
 
 //---------------------------------------------------------------------------//
 void
-Generator::Parser::YAML::YAMLParserWrapper::parse(const char *yaml_txt)
+Generator::Parser::JSON::parse_pure_json(const std::string &json,
+                                         Node &node)
+{
+    // first pass: find the compact schema
+    Schema schema;
+    {
+        PureJSONSchemaHandler handler(schema);
+        rapidjson::Reader reader;
+        rapidjson::StringStream sstream(json.c_str());
+        rapidjson::ParseResult res = reader.Parse<RAPIDJSON_PARSE_OPTS>(sstream,
+                                                                        handler);
+        if(res.IsError())
+        {
+            std::ostringstream oss;
+            parse_error_details(json,res,oss);
+            CONDUIT_ERROR("JSON parse error: \n"
+                          << oss.str()
+                          << "\n");
+        }
+    }
+
+    // allocate, then the second pass fills in the values
+    node.set_schema(schema);
+
+    PureJSONDataHandler handler(node);
+    rapidjson::Reader reader;
+    rapidjson::StringStream sstream(json.c_str());
+    rapidjson::ParseResult res = reader.Parse<RAPIDJSON_PARSE_OPTS>(sstream,
+                                                                    handler);
+    if(res.IsError())
+    {
+        std::ostringstream oss;
+        parse_error_details(json,res,oss);
+        CONDUIT_ERROR("JSON parse error: \n"
+                      << oss.str()
+                      << "\n");
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML --
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML::YAMLEventParser --
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLEventParser::YAMLEventParser(const char *yaml_txt)
+: m_yaml_parser_is_valid(false),
+  m_yaml_event_is_valid(false)
 {
     // Initialize parser
     if(yaml_parser_initialize(&m_yaml_parser) == 0)
@@ -1537,49 +1797,96 @@ Generator::Parser::YAML::YAMLParserWrapper::parse(const char *yaml_txt)
     yaml_parser_set_input_string(&m_yaml_parser,
                                  (const unsigned char*)yaml_txt,
                                  strlen(yaml_txt));
+}
 
-    // use parser to construct document
-    if( yaml_parser_load(&m_yaml_parser, &m_yaml_doc) == 0 )
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLEventParser::~YAMLEventParser()
+{
+    // cleanup!
+    if(m_yaml_event_is_valid)
     {
-        CONDUIT_YAML_PARSE_ERROR(&m_yaml_doc,
-                                 &m_yaml_parser);
+        yaml_event_delete(&m_yaml_event);
     }
-    else
+
+    if(m_yaml_parser_is_valid)
     {
-        m_yaml_doc_is_valid = true;
+        yaml_parser_delete(&m_yaml_parser);
     }
 }
 
 //---------------------------------------------------------------------------//
-yaml_document_t *
-Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_ptr()
+yaml_event_t &
+Generator::Parser::YAML::YAMLEventParser::next()
 {
-    yaml_document_t *res = NULL;
+    if(m_yaml_event_is_valid)
+    {
+        yaml_event_delete(&m_yaml_event);
+        m_yaml_event_is_valid = false;
+    }
 
-    if(m_yaml_doc_is_valid)
+    if( yaml_parser_parse(&m_yaml_parser, &m_yaml_event) == 0 )
     {
-        res = &m_yaml_doc;
+        CONDUIT_YAML_PARSE_ERROR(NULL,
+                                 &m_yaml_parser);
     }
 
-    return res;
+    m_yaml_event_is_valid = true;
+    return m_yaml_event;
+}
+
+//---------------------------------------------------------------------------//
+yaml_event_t &
+Generator::Parser::YAML::YAMLEventParser::event()
+{
+    return m_yaml_event;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::YAMLEventParser::add_anchor(const std::string &anchor,
+                                                     const char *scalar_txt)
+{
+    m_node_anchors.erase(anchor);
+    m_scalar_anchors[anchor] = std::string(scalar_txt);
 }
 
 //---------------------------------------------------------------------------//
-yaml_node_t *
-Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_root_ptr()
+void
+Generator::Parser::YAML::YAMLEventParser::add_anchor(const std::string &anchor,
+                                                     const Node *node)
 {
-    yaml_node_t *res = NULL;
+    m_scalar_anchors.erase(anchor);
+    m_node_anchors[anchor] = node;
+}
 
-    if(m_yaml_doc_is_valid)
+//---------------------------------------------------------------------------//
+const char *
+Generator::Parser::YAML::YAMLEventParser::anchor_scalar(const std::string &anchor) const
+{
+    std::map<std::string,std::string>::const_iterator itr;
+    itr = m_scalar_anchors.find(anchor);
+    if(itr == m_scalar_anchors.end())
     {
-        res = yaml_document_get_root_node(&m_yaml_doc);
+        return NULL;
     }
+    return itr->second.c_str();
+}
 
-    return res;
+//---------------------------------------------------------------------------//
+const Node *
+Generator::Parser::YAML::YAMLEventParser::anchor_node(const std::string &anchor) const
+{
+    std::map<std::string,const Node*>::const_iterator itr;
+    itr = m_node_anchors.find(anchor);
+    if(itr == m_node_anchors.end())
+    {
+        return NULL;
+    }
+    return itr->second;
 }
 
 //-----------------------------------------------------------------------------
-// -- end conduit::Generator::YAML::YAMLParserWrapper --
+// -- end conduit::Generator::YAML::YAMLEventParser --
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
@@ -1647,173 +1954,32 @@ Generator::Parser::YAML::string_to_long(const char *txt_value)
 
 //---------------------------------------------------------------------------//
 index_t 
-Generator::Parser::YAML::yaml_leaf_to_numeric_dtype(const char *txt_value)
+Generator::Parser::YAML::parse_yaml_number(const char *txt_value,
+                                           YAMLNumber &res)
 {
-    index_t res = DataType::EMPTY_ID;
-    if(string_is_integer(txt_value))
-    {
-        res = DataType::INT64_ID;
-    }
-    else if(string_is_double(txt_value))
+    if(string_is_empty(txt_value))
     {
-        res = DataType::FLOAT64_ID;
+        return DataType::EMPTY_ID;
     }
-    //else, already inited to DataType::EMPTY_ID
 
-    return res;
-}
-
-//---------------------------------------------------------------------------//
-// NOTE: Assumes Node res is already DataType::int64, w/ proper len
-void
-Generator::Parser::YAML::parse_yaml_int64_array(yaml_document_t *yaml_doc,
-                                                yaml_node_t *yaml_node,
-                                                Node &res)
-{
-    int64_array res_vals = res.value();
-    int cld_idx = 0;
-    while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
+    // same checks as string_is_integer() and string_is_double(), 
+    // but each conversion is only done once
+    char *val_end = NULL;
+    long int ival = strtol(txt_value,&val_end,10);
+    if(*val_end == 0)
     {
-        yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                 yaml_node->data.sequence.items.start[cld_idx]);
-                                     
-        if(yaml_child == NULL || yaml_child->type != YAML_SCALAR_NODE )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid int64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
-        }
-
-
-        // check type of string contents
-        const char *yaml_value_str = (const char*)yaml_child->data.scalar.value;
-
-        if(yaml_value_str == NULL )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid int64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
-        }
-
-        res_vals[cld_idx] = (int64) string_to_long(yaml_value_str);
-
-        cld_idx++;
+        res.ival = (int64) ival;
+        return DataType::INT64_ID;
     }
-}
 
-//---------------------------------------------------------------------------//
-// NOTE: Assumes Node res is already DataType::float64, w/ proper len
-void
-Generator::Parser::YAML::parse_yaml_float64_array(yaml_document_t *yaml_doc,
-                                                  yaml_node_t *yaml_node,
-                                                  Node &res)
-{
-    float64_array res_vals = res.value();
-    int cld_idx = 0;
-    while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
+    double fval = strtod(txt_value,&val_end);
+    if(*val_end == 0)
     {
-        yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                 yaml_node->data.sequence.items.start[cld_idx]);
-                                     
-        if(yaml_child == NULL || yaml_child->type != YAML_SCALAR_NODE )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid float64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
-        }
-
-
-        // check type of string contents
-        const char *yaml_value_str = (const char*)yaml_child->data.scalar.value;
-
-        if(yaml_value_str == NULL )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid float64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
-        }
-
-        res_vals[cld_idx] = (float64) string_to_double(yaml_value_str);
-
-        cld_idx++;
+        res.fval = (float64) fval;
+        return DataType::FLOAT64_ID;
     }
-}
-
-//---------------------------------------------------------------------------//
-index_t
-Generator::Parser::YAML::check_homogenous_yaml_numeric_sequence(const Node &node,
-                                                                yaml_document_t *yaml_doc,
-                                                                yaml_node_t *yaml_node,
-                                                                index_t &seq_size)
-{
-     index_t res = DataType::EMPTY_ID;
-     seq_size = -1;
-     bool ok = true;
-     int cld_idx = 0;
-     while( ok && yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
-     {
-         yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                 yaml_node->data.sequence.items.start[cld_idx]);
-                                                 
-        if(yaml_child == NULL )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid sequence child at path: "
-                          << node.path() << "[" << cld_idx << "]");
-        }
-
-        // first make sure we only have yaml scalars
-        if(yaml_child->type == YAML_SCALAR_NODE)
-        {
-
-            // check type of string contents
-            const char *yaml_value_str = (const char*)yaml_child->data.scalar.value;
-
-            if(yaml_value_str == NULL )
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "Invalid value for sequence child at path: "
-                              << node.path() << "[" << cld_idx << "]");
-            }
-
-            // check for integers, then widen to floats
-
-            index_t child_dtype_id = yaml_leaf_to_numeric_dtype(yaml_value_str);
-
-            if(child_dtype_id == DataType::EMPTY_ID)
-            {
-                ok = false;
-            }
-            else if(res == DataType::EMPTY_ID)
-            {
-                // good so far, promote to child's dtype
-                res = child_dtype_id;
-            }
-            else if( res == DataType::INT64_ID && child_dtype_id == DataType::FLOAT64_ID)
-            {
-                // promote to float64
-                res = DataType::FLOAT64_ID;
-            }
-        }
-        else
-        {
-            ok = false;
-        }
-
-        cld_idx++;
-     }
 
-     // if we are ok, seq_size is the final cld_idx
-     if(ok)
-     {
-         seq_size = cld_idx;
-     }
-     else
-     {
-        res = DataType::EMPTY_ID;
-     }
-
-     return res;
+    return DataType::EMPTY_ID;
 }
 
 //---------------------------------------------------------------------------//
@@ -1840,30 +2006,90 @@ Generator::Parser::YAML::parse_yaml_inline_leaf(const char *yaml_txt,
 }
 
 
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::YAML::append_yaml_child(Node *node,
+                                           Schema *schema,
+                                           const std::string &name)
+{
+    Schema *curr_schema = schema->fetch_ptr(name);
+    Node *curr_node = new Node();
+    curr_node->set_schema_ptr(curr_schema);
+    curr_node->set_parent(node);
+    node->append_node_ptr(curr_node);
+    return curr_node;
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::YAML::append_yaml_child(Node *node,
+                                           Schema *schema)
+{
+    schema->append();
+    Schema *curr_schema = schema->child_ptr(schema->number_of_children() - 1);
+    Node *curr_node = new Node();
+    curr_node->set_schema_ptr(curr_schema);
+    curr_node->set_parent(node);
+    node->append_node_ptr(curr_node);
+    return curr_node;
+}
+
+//---------------------------------------------------------------------------//
+std::string
+Generator::Parser::YAML::yaml_event_anchor(const yaml_event_t &event)
+{
+    const yaml_char_t *anchor = NULL;
+    if(event.type == YAML_SCALAR_EVENT)
+    {
+        anchor = event.data.scalar.anchor;
+    }
+    else if(event.type == YAML_MAPPING_START_EVENT)
+    {
+        anchor = event.data.mapping_start.anchor;
+    }
+    else if(event.type == YAML_SEQUENCE_START_EVENT)
+    {
+        anchor = event.data.sequence_start.anchor;
+    }
+
+    if(anchor == NULL)
+    {
+        return std::string();
+    }
+    return std::string((const char*)anchor);
+}
+
 //---------------------------------------------------------------------------//
 void 
 Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
                                                Schema *schema,
                                                const char *yaml_txt)
 {
-    YAMLParserWrapper parser;
-    parser.parse(yaml_txt);
+    YAMLEventParser parser(yaml_txt);
 
-    yaml_document_t *yaml_doc  = parser.yaml_doc_ptr();
-    yaml_node_t     *yaml_node = parser.yaml_doc_root_ptr();
+    // stream start, then the start of the first document
+    parser.next();
+    yaml_event_t &event = parser.next();
 
-
-    if(yaml_doc == NULL || yaml_node == NULL)
+    if(event.type != YAML_DOCUMENT_START_EVENT)
     {
         CONDUIT_ERROR("failed to fetch yaml document root");
     }
 
+    // root value
+    parser.next();
     walk_pure_yaml_schema(node,
                           schema,
-                          yaml_doc,
-                          yaml_node);
+                          parser);
 
-    // YAMLParserWrapper cleans up for us
+    // make sure the rest of the document is valid
+    if(parser.next().type != YAML_DOCUMENT_END_EVENT)
+    {
+        CONDUIT_ERROR("YAML Generator error:\n"
+                      << "expected end of YAML document");
+    }
+
+    // YAMLEventParser cleans up for us
 }
 
 
@@ -1871,49 +2097,34 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
 void 
 Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
                                                Schema *schema,
-                                               yaml_document_t *yaml_doc,
-                                               yaml_node_t *yaml_node)
+                                               YAMLEventParser &parser)
 {
-    
+    yaml_event_t &event = parser.event();
+
     // object cases
-    if( yaml_node->type == YAML_MAPPING_NODE )
+    if( event.type == YAML_MAPPING_START_EVENT )
     {
+        std::string anchor = yaml_event_anchor(event);
+
         // if we make it here and have an empty json object
         // we still want the conduit node to take on the
         // object role
         schema->set(DataType::object());
-        // loop over all entries
-        
-        int cld_idx = 0;
-        // while (has_next) --> grab next, then process
-        while( (yaml_node->data.mapping.pairs.start + cld_idx) < yaml_node->data.mapping.pairs.top)
-        {
-            yaml_node_pair_t *yaml_pair = yaml_node->data.mapping.pairs.start + cld_idx;
-
-            if(yaml_pair == NULL)
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "failed to fetch mapping pair at path: "
-                              << node->path() << "[" << cld_idx << "]");
-            }
 
-            yaml_node_t *yaml_key = yaml_document_get_node(yaml_doc, yaml_pair->key);
-            
-            if(yaml_key == NULL)
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "failed to fetch mapping key at path: "
-                              << node->path() << "[" << cld_idx << "]");
-            }
+        index_t cld_idx = 0;
+        // loop over all entries, until we reach the end of the mapping
+        while(parser.next().type != YAML_MAPPING_END_EVENT)
+        {
+            yaml_event_t &key_event = parser.event();
 
-            if(yaml_key->type != YAML_SCALAR_NODE )
+            if(key_event.type != YAML_SCALAR_EVENT )
             {
                 CONDUIT_ERROR("YAML Generator error:\n"
                               << "Invalid mapping key type at path: "
                               << node->path() << "[" << cld_idx << "]");
             }
 
-            const char *yaml_key_str = (const char *) yaml_key->data.scalar.value;
+            const char *yaml_key_str = (const char *) key_event.data.scalar.value;
 
             if(yaml_key_str == NULL )
             {
@@ -1924,15 +2135,6 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
             
             std::string entry_name(yaml_key_str);
 
-            yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc, yaml_pair->value);
-
-            if(yaml_child == NULL )
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "Invalid mapping child at path: "
-                              << utils::join_path(node->path(),entry_name));
-            }
-
             // yaml files may have duplicate object names
             // we could provide some clear semantics, such as:
             //   always use first instance, or always use last instance
@@ -1946,74 +2148,38 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
                               << utils::join_path(node->path(),entry_name));
             }
 
-            Schema *curr_schema = schema->fetch_ptr(entry_name);
+            Node *curr_node = append_yaml_child(node,schema,entry_name);
 
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
-            node->append_node_ptr(curr_node);
-        
+            // value
+            parser.next();
             walk_pure_yaml_schema(curr_node,
-                                  curr_schema,
-                                  yaml_doc,
-                                  yaml_child);
+                                  curr_node->schema_ptr(),
+                                  parser);
             cld_idx++;
         }
+
+        if(!anchor.empty())
+        {
+            parser.add_anchor(anchor,node);
+        }
     }
     // List case
-    else if( yaml_node->type == YAML_SEQUENCE_NODE )
+    else if( event.type == YAML_SEQUENCE_START_EVENT )
     {
-        index_t seq_size  = -1;
-        index_t hval_type = check_homogenous_yaml_numeric_sequence(*node,
-                                                                   yaml_doc,
-                                                                   yaml_node,
-                                                                   seq_size);
-
-        if(hval_type == DataType::INT64_ID)
-        {
+        std::string anchor = yaml_event_anchor(event);
 
-            node->set(DataType::int64(seq_size));
-            parse_yaml_int64_array(yaml_doc, yaml_node, *node);
+        walk_pure_yaml_sequence(node,
+                                schema,
+                                parser);
 
-        }
-        else if(hval_type == DataType::FLOAT64_ID)
+        if(!anchor.empty())
         {
-            node->set(DataType::float64(seq_size));
-            parse_yaml_float64_array(yaml_doc, yaml_node, *node);
-        }
-        else
-        {
-            // general case (not a numeric array)
-            index_t cld_idx = 0;
-            while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
-            {
-                yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                        yaml_node->data.sequence.items.start[cld_idx]);
-            
-                if(yaml_child == NULL )
-                {
-                    CONDUIT_ERROR("YAML Generator error:\n"
-                                  << "Invalid sequence child at path: "
-                                  << node->path() << "[" << cld_idx << "]");
-                }
-
-                schema->append();
-                Schema *curr_schema = schema->child_ptr(cld_idx);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
-                node->append_node_ptr(curr_node);
-                walk_pure_yaml_schema(curr_node,
-                                      curr_schema,
-                                      yaml_doc,
-                                      yaml_child);
-                cld_idx++;
-            }
+            parser.add_anchor(anchor,node);
         }
     }
-    else if(yaml_node->type == YAML_SCALAR_NODE)// bytestr case
+    else if(event.type == YAML_SCALAR_EVENT)// bytestr case
     {
-        const char *yaml_value_str = (const char*)yaml_node->data.scalar.value;
+        const char *yaml_value_str = (const char*)event.data.scalar.value;
 
         if( yaml_value_str == NULL )
         {
@@ -2023,8 +2189,36 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
         }
 
         parse_yaml_inline_leaf(yaml_value_str,*node);
+
+        if(event.data.scalar.anchor != NULL)
+        {
+            parser.add_anchor((const char*)event.data.scalar.anchor,
+                              yaml_value_str);
+        }
+    }
+    else if(event.type == YAML_ALIAS_EVENT)
+    {
+        std::string anchor((const char*)event.data.alias.anchor);
+
+        const char *anchor_txt  = parser.anchor_scalar(anchor);
+        const Node *anchor_node = parser.anchor_node(anchor);
+
+        if(anchor_txt != NULL)
+        {
+            parse_yaml_inline_leaf(anchor_txt,*node);
+        }
+        else if(anchor_node != NULL)
+        {
+            node->set(*anchor_node);
+        }
+        else
+        {
+            CONDUIT_ERROR("YAML Generator error:\n"
+                          << "Undefined YAML alias: " << anchor
+                          << " at path: " << node->path());
+        }
     }
-    else // this will include unknown enum vals and YAML_NO_NODE
+    else // this will include unknown enum vals
     {
         // not sure if can an even land here, but catch error just in case.
         CONDUIT_ERROR("YAML Generator error:\n"
@@ -2034,6 +2228,118 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
     }
 }
 
+//---------------------------------------------------------------------------//
+void 
+Generator::Parser::YAML::walk_pure_yaml_sequence(Node *node,
+                                                 Schema *schema,
+                                                 YAMLEventParser &parser)
+{
+    // while the sequence only holds numbers, values are collected into 
+    // a typed buffer (no per value nodes, schemas, or strings). 
+    // If we finish with only numbers we create a numeric array,
+    // otherwise the buffered values become list children and
+    // we continue as a general list.
+    std::vector<YAMLNumber> num_vals;
+    std::vector<bool>       num_is_int;
+    bool all_ints = true;
+    bool numeric  = true;
+
+    while(parser.next().type != YAML_SEQUENCE_END_EVENT)
+    {
+        yaml_event_t &event = parser.event();
+
+        if(numeric)
+        {
+            // see if this is a number
+            const char *yaml_value_str = NULL;
+            if(event.type == YAML_SCALAR_EVENT)
+            {
+                yaml_value_str = (const char*)event.data.scalar.value;
+            }
+            else if(event.type == YAML_ALIAS_EVENT)
+            {
+                yaml_value_str = parser.anchor_scalar(
+                                    (const char*)event.data.alias.anchor);
+            }
+
+            YAMLNumber num;
+            index_t num_dtype_id = DataType::EMPTY_ID;
+            if(yaml_value_str != NULL)
+            {
+                num_dtype_id = parse_yaml_number(yaml_value_str,num);
+            }
+
+            if(num_dtype_id != DataType::EMPTY_ID)
+            {
+                bool is_int = num_dtype_id == DataType::INT64_ID;
+                num_vals.push_back(num);
+                num_is_int.push_back(is_int);
+                all_ints = all_ints && is_int;
+
+                if(event.type == YAML_SCALAR_EVENT &&
+                   event.data.scalar.anchor != NULL)
+                {
+                    parser.add_anchor((const char*)event.data.scalar.anchor,
+                                      yaml_value_str);
+                }
+                continue;
+            }
+
+            // not a number: switch to the general case, and convert
+            // what we have collected so far into list children
+            numeric = false;
+            for(size_t i=0; i < num_vals.size(); i++)
+            {
+                Node *curr_node = append_yaml_child(node,schema);
+                if(num_is_int[i])
+                {
+                    curr_node->set(num_vals[i].ival);
+                }
+                else
+                {
+                    curr_node->set(num_vals[i].fval);
+                }
+            }
+            std::vector<YAMLNumber>().swap(num_vals);
+            std::vector<bool>().swap(num_is_int);
+        }
+
+        // general case (not a numeric array)
+        Node *curr_node = append_yaml_child(node,schema);
+        walk_pure_yaml_schema(curr_node,
+                              curr_node->schema_ptr(),
+                              parser);
+    }
+
+    // if we have an empty sequence, we leave the node empty
+    if(!numeric || num_vals.empty())
+    {
+        return;
+    }
+
+    index_t seq_size = (index_t) num_vals.size();
+    if(all_ints)
+    {
+        node->set(DataType::int64(seq_size));
+        int64 *vals_ptr = node->value();
+        for(index_t i=0; i < seq_size; i++)
+        {
+            vals_ptr[i] = num_vals[(size_t)i].ival;
+        }
+    }
+    else
+    {
+        // promote ints to float64
+        node->set(DataType::float64(seq_size));
+        float64 *vals_ptr = node->value();
+        for(index_t i=0; i < seq_size; i++)
+        {
+            const YAMLNumber &num = num_vals[(size_t)i];
+            vals_ptr[i] = num_is_int[(size_t)i] ? (float64)num.ival : num.fval;
+        }
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -2188,6 +2494,15 @@ Generator::walk(Schema &schema) const
 void 
 Generator::walk(Node &node) const
 {
+    // pure json is parsed directly into compact storage
+    if(m_protocol == "json")
+    {
+        node.reset();
+        std::string res = utils::json_sanitize(m_schema);
+        Parser::JSON::parse_pure_json(res,node);
+        return;
+    }
+
     /// TODO: This is an inefficient code path, need better solution?
     Node n;
     walk_external(n);
@@ -2202,17 +2517,8 @@ Generator::walk_external(Node &node) const
     // if data is null, we can parse the schema via the other 'walk' method
     if(m_protocol == "json")
     {
-        rapidjson::Document document;
         std::string res = utils::json_sanitize(m_schema);
-                
-        if(document.Parse<Parser::JSON::RAPIDJSON_PARSE_OPTS>(res.c_str()).HasParseError())
-        {
-            CONDUIT_JSON_PARSE_ERROR(res, document);
-        }
-
-        Parser::JSON::walk_pure_json_schema(&node,
-                                            node.schema_ptr(),
-                                            document);
+        Parser::JSON::parse_pure_json(res,node);
     }
     else if(m_protocol == "yaml")
     {
@@ -55,7 +55,9 @@
 // mmap interface not available on windows
 // 
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
+#include <cerrno>
 #else
 #define NOMINMAX
 #undef min
@@ -69,6 +71,7 @@
 #include <algorithm>
 #include <iostream>
 #include <map>
+#include <utility>
 
 //-----------------------------------------------------------------------------
 // -- standard c lib includes -- 
@@ -152,6 +155,15 @@ Node::Node(const Node &node)
     set(node);
 }
 
+#ifdef CONDUIT_USE_CXX11
+//---------------------------------------------------------------------------//
+Node::Node(Node &&node) noexcept
+{
+    init_defaults();
+    set_node(std::move(node));
+}
+#endif
+
 //---------------------------------------------------------------------------//
 Node::~Node()
 {
@@ -166,6 +178,34 @@ Node::reset()
     m_schema->set(DataType::EMPTY_ID);
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::swap(Node &node)
+{
+    if(this == &node)
+    {
+        return;
+    }
+
+    if(is_descendant_of(node) || node.is_descendant_of(*this))
+    {
+        CONDUIT_ERROR("Cannot swap a Node with one of its ancestors "
+                      "or descendants");
+    }
+
+    if(has_ancestor_owned_data() || node.has_ancestor_owned_data())
+    {
+        // data may point into memory owned outside of these subtrees,
+        // we can't hand it over, so swap using copies
+        Node tmp(node);
+        node.set(*this);
+        set(tmp);
+        return;
+    }
+
+    swap_contents(node);
+}
+
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
 //-----------------------------------------------------------------------------
@@ -379,8 +419,7 @@ Node::load(const std::string &ibase,
     if(proto == "conduit_bin")
     {
         Schema s;
-        std::string ifschema = ibase + "_json";
-        s.load(ifschema);
+        s.load(conduit_bin_schema_path(ibase));
         load(ibase,s);
     }
     // single file json and yaml cases
@@ -402,6 +441,16 @@ Node::load(const std::string &ibase,
 void
 Node::save(const std::string &obase,
            const std::string &protocol) const
+{
+    Node options;
+    save(obase,protocol,options);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::save(const std::string &obase,
+           const std::string &protocol,
+           const Node &options) const
 {
     std::string proto = protocol;
     //auto detect protocol
@@ -412,12 +461,59 @@ Node::save(const std::string &obase,
 
     if(proto == "conduit_bin")
     {
-        Node res;
-        compact_to(res);
-        std::string ofschema = obase + "_json";
+        // save the compact schema, and stream the leaves directly 
+        // (avoids creating a compact copy of the whole tree)
+        Schema s_compact;
+        schema().compact_to(s_compact);
+
+        std::string schema_format = "json";
+        if(options.has_child("schema_format"))
+        {
+            schema_format = options["schema_format"].as_string();
+        }
+
+        std::string ofschema_json = obase + "_json";
+        std::string ofschema_bin  = obase + "_schema_bin";
 
-        res.schema().save(ofschema);
-        res.serialize(obase);
+        if(schema_format == "json")
+        {
+            s_compact.save(ofschema_json);
+            // remove any schema from a previous binary save, 
+            // so it can't be mistaken for this one
+            if(utils::is_file(ofschema_bin))
+            {
+                utils::remove_file(ofschema_bin);
+            }
+        }
+        else if(schema_format == "binary")
+        {
+            std::vector<uint8> s_bin;
+            s_compact.to_binary(s_bin);
+
+            std::ofstream ofs;
+            ofs.open(ofschema_bin.c_str(), std::ios::out | std::ios::binary);
+            if(!ofs.is_open())
+            {
+                CONDUIT_ERROR("<Node::save> failed to open: " 
+                              << ofschema_bin);
+            }
+            ofs.write((const char*)&s_bin[0],(std::streamsize)s_bin.size());
+            ofs.close();
+
+            // loads look for the json schema first
+            if(utils::is_file(ofschema_json))
+            {
+                utils::remove_file(ofschema_json);
+            }
+        }
+        else
+        {
+            CONDUIT_ERROR("<Node::save> unsupported conduit_bin "
+                          "schema_format: " << schema_format
+                          << " (expected json or binary)");
+        }
+
+        write_conduit_bin(obase);
     }
     else if( proto == "yaml")
     {
@@ -433,13 +529,27 @@ Node::save(const std::string &obase,
 void
 Node::mmap(const std::string &stream_path)
 {
-    std::string ifschema = stream_path + "_json";
-
     Schema s;
-    s.load(ifschema);
+    s.load(conduit_bin_schema_path(stream_path));
     mmap(stream_path,s);
 }
 
+//---------------------------------------------------------------------------//
+std::string
+Node::conduit_bin_schema_path(const std::string &stream_path)
+{
+    std::string json_schema_path = stream_path + "_json";
+    std::string bin_schema_path  = stream_path + "_schema_bin";
+
+    if(!utils::is_file(json_schema_path) &&
+        utils::is_file(bin_schema_path))
+    {
+        return bin_schema_path;
+    }
+
+    return json_schema_path;
+}
+
 
 //---------------------------------------------------------------------------//
 void 
@@ -541,6 +651,45 @@ Node::set(const Node &node)
     set_node(node);
 }
 
+#ifdef CONDUIT_USE_CXX11
+//---------------------------------------------------------------------------//
+void 
+Node::set_node(Node &&node)
+{
+    if(this == &node)
+    {
+        return;
+    }
+
+    if(is_descendant_of(node))
+    {
+        CONDUIT_ERROR("Cannot move a Node into one of its descendants");
+    }
+
+    if(node.has_ancestor_owned_data())
+    {
+        // the passed node's data may point into memory owned by its 
+        // ancestors, we can't steal it, so copy
+        set_node(static_cast<const Node&>(node));
+        return;
+    }
+
+    // steal into a temp first, so this is safe when the passed node 
+    // is one of our descendants
+    Node tmp;
+    tmp.swap_contents(node);
+    reset();
+    swap_contents(tmp);
+}
+
+//---------------------------------------------------------------------------//
+void 
+Node::set(Node &&node)
+{
+    set_node(std::move(node));
+}
+#endif
+
 //---------------------------------------------------------------------------//
 void 
 Node::set_dtype(const DataType &dtype)
@@ -607,7 +756,7 @@ Node::set_data_using_dtype(const DataType &dtype,
 {
     release();
     m_schema->set(dtype);
-    allocate(m_schema->spanned_bytes());
+    allocate_leaf(m_schema->spanned_bytes());
     memcpy(m_data, data, (size_t) m_schema->spanned_bytes());
     walk_schema(this,m_schema,m_data);
 }
@@ -6778,6 +6927,19 @@ Node::operator=(const Node &node)
     return *this;
 }
 
+#ifdef CONDUIT_USE_CXX11
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(Node &&node) noexcept
+{
+    if(this != &node)
+    {
+        set(std::move(node));
+    }
+    return *this;
+}
+#endif
+
 //---------------------------------------------------------------------------//
 Node &
 Node::operator=(const DataType &dtype)
@@ -7555,7 +7717,27 @@ void
 Node::serialize(std::vector<uint8> &data) const
 {
     data = std::vector<uint8>((size_t)total_bytes_compact(),0);
-    serialize(&data[0],0);
+
+    if(data.empty())
+    {
+        return;
+    }
+
+    // if our data is already compact and contiguous, use a single copy
+    const void *contig_data_ptr = NULL;
+    if(is_compact())
+    {
+        contig_data_ptr = contiguous_data_ptr();
+    }
+
+    if(contig_data_ptr != NULL)
+    {
+        memcpy(&data[0],contig_data_ptr,data.size());
+    }
+    else
+    {
+        serialize(&data[0],0);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -7621,12 +7803,34 @@ Node::compact_to(Node &n_dest) const
     // avoid allocation for zero-bytes cases
     if(c_size > 0)
     {
-        n_dest.allocate(c_size);
+        if(dtype().is_object() || dtype().is_list())
+        {
+            n_dest.allocate(c_size);
+        }
+        else
+        {
+            n_dest.allocate_leaf(c_size);
+        }
     }
 
     m_schema->compact_to(*n_dest.schema_ptr());
     uint8 *n_dest_data = (uint8*)n_dest.m_data;
-    compact_to(n_dest_data,0);
+
+    // if our data is already compact and contiguous, use a single copy
+    const void *contig_data_ptr = NULL;
+    if(c_size > 0 && is_compact())
+    {
+        contig_data_ptr = contiguous_data_ptr();
+    }
+
+    if(contig_data_ptr != NULL)
+    {
+        memcpy(n_dest_data,contig_data_ptr,(size_t)c_size);
+    }
+    else
+    {
+        compact_to(n_dest_data,0);
+    }
     // need node structure
     walk_schema(&n_dest,n_dest.m_schema,n_dest_data);
 }
@@ -7638,6 +7842,80 @@ Node::compact_to(Node &n_dest) const
 //---------------------------------------------------------------------------//
 void
 Node::update(const Node &n_src)
+{
+    if(!update_bulk_copy(n_src))
+    {
+        update_walk(n_src);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::update_compatible(const Node &n_src)
+{
+    if(!update_bulk_copy(n_src))
+    {
+        update_compatible_walk(n_src);
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::update_bulk_copy(const Node &n_src)
+{
+    // equal schemas imply the same leaf dtypes (including compactness), 
+    // in the same order
+    index_t num_bytes = total_bytes_compact();
+    if( num_bytes == 0 ||
+        !is_compact() ||
+        !m_schema->equals(*n_src.m_schema) )
+    {
+        return false;
+    }
+
+    void       *dest_ptr = contiguous_data_ptr();
+    const void *src_ptr  = n_src.contiguous_data_ptr();
+
+    if(dest_ptr == NULL || src_ptr == NULL)
+    {
+        return false;
+    }
+
+    if(dest_ptr != src_ptr)
+    {
+        memcpy(dest_ptr,src_ptr,(size_t)num_bytes);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::update_leaf(const Node &n_src)
+{
+    // if you have the same type dtype, but less elements in the
+    // src, it will copy them
+    if( (this->dtype().id() == n_src.dtype().id()) &&
+             (this->dtype().number_of_elements() >=  
+               n_src.dtype().number_of_elements())) 
+    {
+        // don't copy the whole span b/c we want to preserve striding holes,
+        // strided_copy uses one memcpy when both sides are compact
+        utils::strided_copy(element_ptr(0),
+                            this->dtype().stride(),
+                            n_src.element_ptr(0),
+                            n_src.dtype().stride(),
+                            n_src.dtype().number_of_elements(),
+                            this->dtype().element_bytes());
+        return true;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::update_walk(const Node &n_src)
 {
     // walk src and add it contents to this node
     /// TODO:
@@ -7648,11 +7926,9 @@ Node::update(const Node &n_src)
     {
         const std::vector<std::string> &scld_names = n_src.child_names();
 
-        for (std::vector<std::string>::const_iterator itr = scld_names.begin();
-             itr < scld_names.end(); ++itr)
+        for (size_t idx = 0; idx < scld_names.size(); idx++)
         {
-            std::string ent_name = *itr;
-            fetch(ent_name).update(n_src.fetch(ent_name));
+            fetch(scld_names[idx]).update_walk(*n_src.m_children[idx]);
         }
     }
     else if( dtype_id == DataType::LIST_ID)
@@ -7668,7 +7944,7 @@ Node::update(const Node &n_src)
                 (idx < num_children && idx < src_num_children); 
                 idx++)
             {
-                child(idx).update(n_src.child(idx));
+                child(idx).update_walk(n_src.child(idx));
                 src_idx++;
             }
         }
@@ -7676,31 +7952,13 @@ Node::update(const Node &n_src)
         // than the current node, use append to capture the nodes
         for(index_t idx = src_idx; idx < src_num_children;idx++)
         {
-            append().update(n_src.child(idx));
+            append().update_walk(n_src.child(idx));
         }
     }
     else if(dtype_id != DataType::EMPTY_ID) // TODO: Empty nodes not propagated?
     {
         // TODO: isn't this the same as a set?
-        
-        // don't use mem copy b/c we want to preserve striding holes
-        
-        // if you have the same type dtype, but less elements in the
-        // src, it will copy them
-        if( (this->dtype().id() == n_src.dtype().id()) &&
-                 (this->dtype().number_of_elements() >=  
-                   n_src.dtype().number_of_elements())) 
-        {
-            for(index_t idx = 0;
-                idx < n_src.dtype().number_of_elements();
-                idx++)
-            {
-                memcpy(element_ptr(idx),
-                       n_src.element_ptr(idx), 
-                       (size_t)this->dtype().element_bytes());
-            }
-        }
-        else // not compatible
+        if(!update_leaf(n_src)) // not compatible
         {
             n_src.compact_to(*this);
         }
@@ -7709,22 +7967,27 @@ Node::update(const Node &n_src)
 
 //---------------------------------------------------------------------------//
 void
-Node::update_compatible(const Node &n_src)
+Node::update_compatible_walk(const Node &n_src)
 {
     // walk src and copy contents to this node if their entries match
     index_t dtype_id = n_src.dtype().id();
     if( dtype_id == DataType::OBJECT_ID)
     {
+        if(!dtype().is_object())
+        {
+            return;
+        }
+
         const std::vector<std::string> &scld_names = n_src.child_names();
 
-        for (std::vector<std::string>::const_iterator itr = scld_names.begin();
-             itr < scld_names.end(); ++itr)
+        for (size_t idx = 0; idx < scld_names.size(); idx++)
         {
-            std::string ent_name = *itr;
-            if(has_path(ent_name))
+            index_t my_idx = m_schema->find_child_index(scld_names[idx]);
+            if(my_idx >= 0)
             {
-                fetch(ent_name).update_compatible(n_src.fetch(ent_name));
-                }
+                m_children[(size_t)my_idx]->update_compatible_walk(
+                                                *n_src.m_children[idx]);
+            }
         }
     }
     else if( dtype_id == DataType::LIST_ID)
@@ -7740,30 +8003,14 @@ Node::update_compatible(const Node &n_src)
                 (idx < num_children && idx < src_num_children); 
                  idx++)
             {
-                child(idx).update_compatible(n_src.child(idx));
+                child(idx).update_compatible_walk(n_src.child(idx));
                 src_idx++;
             }
         }
     }
     else if(dtype_id != DataType::EMPTY_ID) // TODO: Empty nodes not propagated?
     {   
-        // don't use mem copy b/c we want to preserve striding holes
-        
-        // if you have the same type dtype, but less elements in the
-        // src, it will copy them 
-        if( (this->dtype().id() == n_src.dtype().id()) &&
-                 (this->dtype().number_of_elements() >=  
-                   n_src.dtype().number_of_elements())) 
-        {
-            for(index_t idx = 0;
-                idx < n_src.dtype().number_of_elements();
-                idx++)
-            {
-                memcpy(element_ptr(idx),
-                       n_src.element_ptr(idx), 
-                       (size_t)this->dtype().element_bytes());
-            }
-        }
+        update_leaf(n_src);
     }
 }
 
@@ -11431,7 +11678,7 @@ Node::to_json_generic(std::ostream &os,
         for(size_t i=0; i <  nchildren;i++)
         {
             utils::indent(os,indent,depth+1,pad);
-            os << "\""<< m_schema->object_order()[i] << "\": ";
+            os << "\""<< m_schema->child_names()[i] << "\": ";
             m_children[i]->to_json_generic(os,
                                            detailed,
                                            indent,
@@ -11662,7 +11909,7 @@ Node::to_base64_json(std::ostream &os,
     Node n;
     compact_to(n);
     
-    // use libb64 to encode the data
+    // base64 encode the data
     index_t nbytes = n.schema().spanned_bytes();
     index_t enc_buff_size =  utils::base64_encode_buffer_size(nbytes);
     Node bb64_data;
@@ -11757,7 +12004,7 @@ Node::to_yaml_generic(std::ostream &os,
         for(size_t i=0; i <  nchildren;i++)
         {
             utils::indent(os,indent,depth,pad);
-            os << m_schema->object_order()[i] << ": ";
+            os << m_schema->child_names()[i] << ": ";
             m_children[i]->to_yaml_generic(os,
                                            detailed,
                                            indent,
@@ -12119,7 +12366,7 @@ Node::fetch(const std::string &path)
         Schema *schema_ptr = m_schema->fetch_ptr(p_curr);
         Node *curr_node = new Node();
         curr_node->set_schema_ptr(schema_ptr);
-        curr_node->m_parent = this;
+        curr_node->set_parent(this);
         m_children.push_back(curr_node);
         idx = m_children.size() - 1;
     }
@@ -12237,6 +12484,62 @@ Node::operator[](index_t idx) const
     return child(idx);
 }
 
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch(const NodePath &path)
+{
+    return path.fetch(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch(const NodePath &path) const
+{
+    return path.fetch_existing(*this);
+}
+
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch_child(const NodePath &path)
+{
+    return path.fetch_existing(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch_child(const NodePath &path) const
+{
+    return path.fetch_existing(*this);
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Node::fetch_ptr(const NodePath &path)
+{
+    return &path.fetch(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+Node::fetch_ptr(const NodePath &path) const
+{
+    return path.resolve(*this);
+}
+
+//---------------------------------------------------------------------------//
+Node&
+Node::operator[](const NodePath &path)
+{
+    return path.fetch(*this);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::operator[](const NodePath &path) const
+{
+    return path.fetch_existing(*this);
+}
+
 //---------------------------------------------------------------------------//
 index_t 
 Node::number_of_children() const 
@@ -12272,6 +12575,13 @@ Node::has_path(const std::string &path) const
     return m_schema->has_path(path);
 }
 
+//---------------------------------------------------------------------------//
+bool
+Node::has_path(const NodePath &path) const
+{
+    return path.resolve(*this) != NULL;
+}
+
 //---------------------------------------------------------------------------//
 const std::vector<std::string>&
 Node::child_names() const
@@ -12293,7 +12603,7 @@ Node::append()
 
     Node *res_node = new Node();
     res_node->set_schema_ptr(schema_ptr);
-    res_node->m_parent=this;
+    res_node->set_parent(this);
     m_children.push_back(res_node);
     return *res_node;
 }
@@ -14322,34 +14632,94 @@ Node::as_long_double_array() const
 
 //---------------------------------------------------------------------------//
 void
-Node::set_schema_ptr(Schema *schema_ptr)
+Node::swap_contents(Node &node)
 {
-    // if(m_schema->is_root())
-    if(m_owns_schema)
+    // schemas keep their place in their trees, only their contents move 
+    m_schema->swap(*node.m_schema);
+
+    std::swap(m_children,node.m_children);
+
+    // inline data can't be handed over by pointer
+    release_inline_data();
+    node.release_inline_data();
+
+    std::swap(m_data,node.m_data);
+    std::swap(m_data_size,node.m_data_size);
+    std::swap(m_alloced,node.m_alloced);
+    std::swap(m_mmaped,node.m_mmaped);
+    std::swap(m_mmap,node.m_mmap);
+    std::swap(m_data_allocator_id,node.m_data_allocator_id);
+
+    // relink children to their new parents
+    for(size_t i=0; i < m_children.size(); i++)
     {
-        delete m_schema;
-        m_owns_schema = false;
+        m_children[i]->m_parent = this;
+    }
+
+    for(size_t i=0; i < node.m_children.size(); i++)
+    {
+        node.m_children[i]->m_parent = &node;
     }
-    m_schema = schema_ptr;
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set_data_ptr(void *data)
+bool
+Node::has_ancestor_owned_data() const
 {
-    /// TODO: We need to audit where we actually need release
-    //release();
-    m_data    = data;
+    for(const Node *n = m_parent; n != NULL; n = n->m_parent)
+    {
+        if(n->m_alloced || n->m_mmaped)
+        {
+            return true;
+        }
+    }
+    return false;
 }
-    
-
-//-----------------------------------------------------------------------------
-//
-// -- end definition of Interface Warts --
-//
-//-----------------------------------------------------------------------------
 
-//=============================================================================
+//---------------------------------------------------------------------------//
+bool
+Node::is_descendant_of(const Node &node) const
+{
+    for(const Node *n = this; n != NULL; n = n->m_parent)
+    {
+        if(n == &node)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_schema_ptr(Schema *schema_ptr)
+{
+    // if(m_schema->is_root())
+    if(m_owns_schema)
+    {
+        delete m_schema;
+        m_owns_schema = false;
+    }
+    m_schema = schema_ptr;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_data_ptr(void *data)
+{
+    /// TODO: We need to audit where we actually need release
+    //release();
+    m_data    = data;
+}
+    
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Interface Warts --
+//
+//-----------------------------------------------------------------------------
+
+//=============================================================================
 //-----------------------------------------------------------------------------
 //
 //
@@ -14532,6 +14902,283 @@ Node::MMap::close()
 
 }
 
+//-----------------------------------------------------------------------------
+// Node::BinaryWriter helper class
+//-----------------------------------------------------------------------------
+// This private class streams leaf data to a file for conduit_bin saves.
+//
+// Compact leaves are written directly from the node's memory (on unix these 
+// are queued and written with writev), non-compact leaves are compacted 
+// through a bounded staging buffer.
+//-----------------------------------------------------------------------------
+
+// max size of the staging buffer used for non-compact leaves
+static const index_t conduit_bin_staging_bytes = 8 * 1024 * 1024;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+// max number of blocks passed to one writev call
+static const size_t  conduit_bin_max_iovs = 512;
+#endif
+
+class Node::BinaryWriter
+{
+  public:
+      BinaryWriter();
+      ~BinaryWriter();
+
+      //----------------------------------------------------------------------
+      void  open(const std::string &path);
+
+      //----------------------------------------------------------------------
+      // writes (or queues) a block of memory, which must stay valid until 
+      // the next flush() or close()
+      void  write(const void *data,
+                  index_t num_bytes);
+
+      //----------------------------------------------------------------------
+      // writes strided elements in compact form, using the staging buffer
+      void  write_strided(const void *data,
+                          index_t stride,
+                          index_t num_elements,
+                          index_t element_bytes);
+
+      //----------------------------------------------------------------------
+      void  flush();
+
+      //----------------------------------------------------------------------
+      void  close();
+
+  private:
+      void  write_fully(const void *data,
+                        size_t num_bytes);
+
+      std::string           m_path;
+      std::vector<uint8>    m_staging;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+      int                       m_fd;
+      std::vector<struct iovec> m_iovs;
+#else
+      std::ofstream             m_ofs;
+#endif
+};
+
+//-----------------------------------------------------------------------------
+Node::BinaryWriter::BinaryWriter()
+: m_path(),
+  m_staging()
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+  ,m_fd(-1),
+  m_iovs()
+#endif
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+Node::BinaryWriter::~BinaryWriter()
+{
+    // don't throw from the destructor, just release the file
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    if(m_fd != -1)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+#else
+    if(m_ofs.is_open())
+    {
+        m_ofs.close();
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::BinaryWriter::open(const std::string &path)
+{
+    m_path = path;
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    m_fd = ::open(path.c_str(),
+                  (O_WRONLY | O_CREAT | O_TRUNC),
+                  (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH));
+
+    if(m_fd == -1)
+    {
+        CONDUIT_ERROR("<Node::save> failed to open: " << path);
+    }
+#else
+    m_ofs.open(path.c_str(), std::ios_base::binary);
+    if(!m_ofs.is_open())
+    {
+        CONDUIT_ERROR("<Node::save> failed to open: " << path);
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::BinaryWriter::write(const void *data,
+                          index_t num_bytes)
+{
+    if(num_bytes <= 0)
+    {
+        return;
+    }
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    struct iovec iov;
+    iov.iov_base = const_cast<void*>(data);
+    iov.iov_len  = (size_t)num_bytes;
+    m_iovs.push_back(iov);
+
+    if(m_iovs.size() >= conduit_bin_max_iovs)
+    {
+        flush();
+    }
+#else
+    write_fully(data,(size_t)num_bytes);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::BinaryWriter::write_strided(const void *data,
+                                  index_t stride,
+                                  index_t num_elements,
+                                  index_t element_bytes)
+{
+    if(num_elements <= 0 || element_bytes <= 0)
+    {
+        return;
+    }
+
+    // keep the order of any queued blocks
+    flush();
+
+    // the staging buffer is sized lazily and reused across leaves
+    index_t staging_bytes = std::min(num_elements * element_bytes,
+                                     conduit_bin_staging_bytes);
+    if((index_t)m_staging.size() < staging_bytes)
+    {
+        m_staging.resize((size_t)staging_bytes);
+    }
+
+    index_t chunk_elements = (index_t)m_staging.size() / element_bytes;
+    if(chunk_elements < 1)
+    {
+        // element bigger than the staging buffer
+        chunk_elements = 1;
+        m_staging.resize((size_t)element_bytes);
+    }
+
+    const uint8 *src_ptr = (const uint8*)data;
+    for(index_t ele_idx = 0; ele_idx < num_elements; ele_idx += chunk_elements)
+    {
+        index_t count = std::min(chunk_elements, num_elements - ele_idx);
+        utils::strided_copy(&m_staging[0],
+                            element_bytes,
+                            src_ptr + ele_idx * stride,
+                            stride,
+                            count,
+                            element_bytes);
+        write_fully(&m_staging[0],(size_t)(count * element_bytes));
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::BinaryWriter::flush()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    size_t iov_idx = 0;
+    while(iov_idx < m_iovs.size())
+    {
+        int iov_cnt = (int)(m_iovs.size() - iov_idx);
+        ssize_t res = ::writev(m_fd, &m_iovs[iov_idx], iov_cnt);
+        if(res < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            CONDUIT_ERROR("<Node::save> failed to write to: " << m_path);
+        }
+
+        // advance past what was written, writev can return early
+        size_t written = (size_t)res;
+        while(iov_idx < m_iovs.size() && written >= m_iovs[iov_idx].iov_len)
+        {
+            written -= m_iovs[iov_idx].iov_len;
+            iov_idx++;
+        }
+
+        if(written > 0)
+        {
+            m_iovs[iov_idx].iov_base = (uint8*)m_iovs[iov_idx].iov_base
+                                        + written;
+            m_iovs[iov_idx].iov_len -= written;
+        }
+    }
+    m_iovs.clear();
+#else
+    m_ofs.flush();
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::BinaryWriter::close()
+{
+    flush();
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    if(m_fd != -1)
+    {
+        int res = ::close(m_fd);
+        m_fd = -1;
+        if(res == -1)
+        {
+            CONDUIT_ERROR("<Node::save> failed to close: " << m_path);
+        }
+    }
+#else
+    m_ofs.close();
+    if(m_ofs.fail())
+    {
+        CONDUIT_ERROR("<Node::save> failed to write to: " << m_path);
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::BinaryWriter::write_fully(const void *data,
+                                size_t num_bytes)
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    const uint8 *ptr = (const uint8*)data;
+    while(num_bytes > 0)
+    {
+        ssize_t res = ::write(m_fd, ptr, num_bytes);
+        if(res < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            CONDUIT_ERROR("<Node::save> failed to write to: " << m_path);
+        }
+        ptr       += res;
+        num_bytes -= (size_t)res;
+    }
+#else
+    m_ofs.write((const char*)data,num_bytes);
+    if(m_ofs.fail())
+    {
+        CONDUIT_ERROR("<Node::save> failed to write to: " << m_path);
+    }
+#endif
+}
+
 
 
 
@@ -14560,7 +15207,7 @@ Node::init(const DataType& dtype)
        dt_id != DataType::LIST_ID &&
        dt_id != DataType::EMPTY_ID)
     {
-        allocate(dtype);
+        allocate_leaf(dtype.spanned_bytes());
     }
 
     m_schema->set(dtype);
@@ -14578,10 +15225,53 @@ Node::allocate(const DataType &dtype)
 void
 Node::allocate(index_t dsize)
 {
-    m_data      = calloc((size_t)dsize,(size_t)1);
+    m_data      = utils::allocate(m_allocator_id,(size_t)dsize);
     m_data_size = dsize;
     m_alloced   = true;
     m_mmaped    = false;
+    m_data_allocator_id = m_allocator_id;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::allocate_leaf(index_t dsize)
+{
+    // small leaves of child nodes live inside the node, unless a custom 
+    // allocator was selected (id 0 is the built-in calloc / free allocator)
+    // root nodes are the ones that get moved and swapped, they always 
+    // use the allocator so their data_ptr() can be handed over
+    if(m_parent != NULL &&
+       dsize > 0 &&
+       dsize <= (index_t)INLINE_DATA_BYTES &&
+       m_allocator_id == 0)
+    {
+        // zero fill, to match the built-in allocator's calloc
+        memset(m_inline_data,0,INLINE_DATA_BYTES);
+        m_data      = m_inline_data;
+        m_data_size = dsize;
+        m_alloced   = true;
+        m_mmaped    = false;
+        m_data_allocator_id = m_allocator_id;
+    }
+    else
+    {
+        allocate(dsize);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::release_inline_data()
+{
+    if(!has_inline_data())
+    {
+        return;
+    }
+
+    // the inline buffer is left as is, it's reused by the next 
+    // allocate_leaf() call
+    allocate(m_data_size);
+    memcpy(m_data,m_inline_data,(size_t)m_data_size);
 }
 
 
@@ -14618,8 +15308,14 @@ Node::release()
         ///
         if(dtype().id() != DataType::EMPTY_ID)
         {   
-            // clean up our storage
-            free(m_data);
+            // clean up our storage, using the allocator that provided it
+            // (inline storage is part of the node, nothing to release)
+            if(!has_inline_data())
+            {
+                utils::release(m_data_allocator_id,
+                               m_data,
+                               (size_t)m_data_size);
+            }
             m_data = NULL;
             m_data_size = 0;
             m_alloced   = false;
@@ -14680,6 +15376,9 @@ Node::init_defaults()
     m_mmaped    = false;
     m_mmap      = NULL;
 
+    m_allocator_id      = utils::default_allocator();
+    m_data_allocator_id = m_allocator_id;
+
     m_schema = new Schema(DataType::EMPTY_ID);
     m_owns_schema = true;
     
@@ -14759,7 +15458,7 @@ Node::walk_schema(Node   *node,
         for(size_t i=0;i< schema->children().size(); i++)
         {
     
-            std::string curr_name = schema->object_order()[i];
+            std::string curr_name = schema->child_names()[i];
             Schema *curr_schema   = schema->fetch_ptr(curr_name);
             Node *curr_node = new Node();
             curr_node->set_schema_ptr(curr_schema);
@@ -14799,7 +15498,7 @@ Node::mirror_node(Node   *node,
         for(size_t i=0;i< schema->children().size(); i++)
         {
     
-            std::string curr_name = schema->object_order()[i];
+            std::string curr_name = schema->child_names()[i];
             Schema *curr_schema   = schema->fetch_ptr(curr_name);
             Node *curr_node = new Node();
             const Node *curr_src = src->child_ptr(i);
@@ -14873,18 +15572,63 @@ Node::compact_elements_to(uint8 *data) const
         // copy all elements 
         index_t num_ele   = dtype().number_of_elements();
         index_t ele_bytes = DataType::default_bytes(dtype_id);
-        uint8 *data_ptr = data;
-        for(index_t i=0;i<num_ele;i++)
+
+        if(num_ele > 0)
         {
-            memcpy(data_ptr,
-                   element_ptr(i),
-                   (size_t)ele_bytes);
-            data_ptr+=ele_bytes;
+            utils::strided_copy(data,
+                                ele_bytes,
+                                element_ptr(0),
+                                dtype().stride(),
+                                num_ele,
+                                ele_bytes);
         }
     }
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::write_conduit_bin(const std::string &path) const
+{
+    BinaryWriter writer;
+    writer.open(path);
+    write_leaves(writer);
+    writer.close();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::write_leaves(BinaryWriter &writer) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            (*itr)->write_leaves(writer);
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        const DataType &dt = dtype();
+        index_t ele_bytes  = DataType::default_bytes(dtype_id);
+        // elements are back to back, write directly from our memory
+        if(dt.stride() == ele_bytes)
+        {
+            writer.write(element_ptr(0),dt.bytes_compact());
+        }
+        else
+        {
+            writer.write_strided(element_ptr(0),
+                                 dt.stride(),
+                                 dt.number_of_elements(),
+                                 ele_bytes);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::serialize(uint8 *data,index_t curr_offset) const
@@ -14896,7 +15640,8 @@ Node::serialize(uint8 *data,index_t curr_offset) const
         for(itr = m_children.begin(); itr < m_children.end(); ++itr)
         {
             (*itr)->serialize(&data[0],curr_offset);
-            curr_offset+=(*itr)->total_strided_bytes();
+            // children are written compactly
+            curr_offset+=(*itr)->total_bytes_compact();
         }
     }
     else
@@ -14934,6 +15679,25 @@ Node::total_bytes_allocated() const
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::set_allocator(index_t allocator_id)
+{
+    if(!utils::is_allocator(allocator_id))
+    {
+        CONDUIT_ERROR("Node::set_allocator: invalid allocator id: "
+                      << allocator_id);
+    }
+
+    m_allocator_id = allocator_id;
+
+    std::vector<Node*>::iterator itr;
+    for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+    {
+        (*itr)->set_allocator(allocator_id);
+    }
+}
+
 //---------------------------------------------------------------------------//
 index_t
 Node::total_bytes_mmaped() const
@@ -15113,6 +15877,176 @@ Node::find_first_data_ptr() const
     return res;
 }
 
+//---------------------------------------------------------------------------//
+// fast diff helpers
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// true if the dtypes, number of children, child names, and number of 
+// elements of the two trees differ
+//---------------------------------------------------------------------------//
+static bool
+node_diff_structure(const Node &t,
+                    const Node &n)
+{
+    index_t t_dtid  = t.dtype().id();
+
+    if(t_dtid != n.dtype().id())
+    {
+        return true;
+    }
+
+    if(t_dtid == DataType::OBJECT_ID || t_dtid == DataType::LIST_ID)
+    {
+        index_t num_children = t.number_of_children();
+        if(num_children != n.number_of_children())
+        {
+            return true;
+        }
+
+        bool is_object = (t_dtid == DataType::OBJECT_ID);
+        for(index_t i = 0; i < num_children; i++)
+        {
+            if(is_object)
+            {
+                // object children are matched by name
+                const std::string &name = t.child_names()[(size_t)i];
+                if(!n.has_child(name) || 
+                   node_diff_structure(t.child(i),n.fetch(name)))
+                {
+                    return true;
+                }
+            }
+            else if(node_diff_structure(t.child(i),n.child(i)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    return t.dtype().number_of_elements() != n.dtype().number_of_elements();
+}
+
+//---------------------------------------------------------------------------//
+// elementwise comparison of floating point leaves, using the same
+// logic as DataArray<T>::diff()
+//---------------------------------------------------------------------------//
+template <typename T>
+static bool
+node_diff_float_values(const DataArray<T> &t_array,
+                       const DataArray<T> &n_array,
+                       const float64 epsilon)
+{
+    index_t num_elements = t_array.number_of_elements();
+    for(index_t i = 0; i < num_elements; i++)
+    {
+        T delta = t_array[i] - n_array[i];
+        if(delta > epsilon || delta < -epsilon)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+// compares the data of two trees, the structure must already match
+//---------------------------------------------------------------------------//
+static bool
+node_diff_data(const Node &t,
+               const Node &n,
+               const float64 epsilon)
+{
+    const DataType &t_dtype = t.dtype();
+    const DataType &n_dtype = n.dtype();
+    index_t t_dtid = t_dtype.id();
+
+    if(t_dtid == DataType::EMPTY_ID)
+    {
+        return false;
+    }
+
+    if(t_dtid == DataType::OBJECT_ID || t_dtid == DataType::LIST_ID)
+    {
+        bool is_object = (t_dtid == DataType::OBJECT_ID);
+        index_t num_children = t.number_of_children();
+        for(index_t i = 0; i < num_children; i++)
+        {
+            const Node &n_child = is_object ?
+                                  n.fetch(t.child_names()[(size_t)i]) :
+                                  n.child(i);
+            if(node_diff_data(t.child(i),n_child,epsilon))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    index_t num_elements = t_dtype.number_of_elements();
+    index_t ele_bytes    = t_dtype.element_bytes();
+    const uint8 *t_data  = (const uint8*)t.element_ptr(0);
+    const uint8 *n_data  = (const uint8*)n.element_ptr(0);
+
+    // identical bytes have no differences, for floating point leaves
+    // other bytes may still be within epsilon
+    bool bits_equal = false;
+    if(ele_bytes == n_dtype.element_bytes())
+    {
+        if(t_dtype.stride() == ele_bytes && n_dtype.stride() == ele_bytes)
+        {
+            bits_equal = utils::memory_equals(t_data,
+                                              n_data,
+                                              num_elements * ele_bytes);
+        }
+        else
+        {
+            bits_equal = true;
+            for(index_t i = 0; i < num_elements && bits_equal; i++)
+            {
+                bits_equal = memcmp(t.element_ptr(i),
+                                    n.element_ptr(i),
+                                    (size_t)ele_bytes) == 0;
+            }
+        }
+    }
+
+    if(bits_equal)
+    {
+        return false;
+    }
+
+    if(t_dtype.is_float32())
+    {
+        float32_array t_array = t.value();
+        float32_array n_array = n.value();
+        return node_diff_float_values(t_array,n_array,epsilon);
+    }
+    else if(t_dtype.is_float64())
+    {
+        float64_array t_array = t.value();
+        float64_array n_array = n.value();
+        return node_diff_float_values(t_array,n_array,epsilon);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::diff(const Node &n, const float64 epsilon) const
+{
+    // check the structure first, so we avoid touching any data 
+    // when the trees differ
+    if(node_diff_structure(*this,n))
+    {
+        return true;
+    }
+
+    return node_diff_data(*this,n,epsilon);
+}
+
 //---------------------------------------------------------------------------//
 bool
 Node::diff(const Node &n, Node &info, const float64 epsilon) const
@@ -15433,6 +16367,173 @@ Node::diff_compatible(const Node &n, Node &info, const float64 epsilon) const
     return res;
 }
 
+//---------------------------------------------------------------------------//
+// hash helpers
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// computes the hash of a node, and optionally fills a digest entry for it:
+//   hash:     the node's hash
+//   shape:    (objects and lists) hash of the dtype id and child names, 
+//             used to check that digest children line up
+//   children: (objects and lists) list of child digest entries
+//---------------------------------------------------------------------------//
+static uint64
+node_hash_digest(const Node &node,
+                 Node *digest)
+{
+    const DataType &dtype = node.dtype();
+    index_t dt_id = dtype.id();
+    uint64 res = 0;
+
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        index_t num_children = node.number_of_children();
+        Node *digest_children = NULL;
+        if(digest != NULL)
+        {
+            digest_children = &digest->fetch("children");
+            digest_children->set(DataType::list());
+        }
+
+        std::vector<uint64> vals;
+        vals.push_back((uint64)dt_id);
+        vals.push_back((uint64)num_children);
+
+        // shape: dtype id, number of children, and (for objects) names
+        uint64 shape_accum = utils::hash64(&vals[0],2 * sizeof(uint64));
+        uint64 accum = 0;
+
+        for(index_t i = 0; i < num_children; i++)
+        {
+            uint64 cld_hash = node_hash_digest(node.child(i),
+                                               digest_children != NULL ?
+                                                  &digest_children->append() :
+                                                  NULL);
+            if(dt_id == DataType::OBJECT_ID)
+            {
+                const std::string &name = node.child_names()[(size_t)i];
+                uint64 pair[2];
+                pair[0] = utils::hash64(name.c_str(),(index_t)name.size());
+                pair[1] = cld_hash;
+                // sum so the result does not depend on child order
+                accum += utils::hash64(pair,sizeof(pair));
+                shape_accum = utils::hash64(name.c_str(),
+                                            (index_t)name.size(),
+                                            shape_accum);
+            }
+            else
+            {
+                vals.push_back(cld_hash);
+            }
+        }
+
+        if(dt_id == DataType::OBJECT_ID)
+        {
+            vals.push_back(accum);
+        }
+
+        res = utils::hash64(&vals[0],(index_t)(vals.size() * sizeof(uint64)));
+
+        if(digest != NULL)
+        {
+            digest->fetch("shape").set_uint64(shape_accum);
+        }
+    }
+    else
+    {
+        uint64 vals[3];
+        vals[0] = (uint64) dt_id;
+        vals[1] = (uint64) dtype.number_of_elements();
+        vals[2] = 0;
+        if(dt_id != DataType::EMPTY_ID)
+        {
+            vals[2] = utils::hash64_strided(node.element_ptr(0),
+                                            dtype.number_of_elements(),
+                                            dtype.element_bytes(),
+                                            dtype.stride());
+        }
+        res = utils::hash64(vals,sizeof(vals));
+    }
+
+    if(digest != NULL)
+    {
+        digest->fetch("hash").set_uint64(res);
+    }
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+static void
+node_hash_tree_changes(const Node &node,
+                       const Node &prev,
+                       const Node &curr,
+                       const std::string &path,
+                       std::vector<std::string> &changed_paths)
+{
+    if(prev.has_child("hash") &&
+       prev["hash"].to_uint64() == curr["hash"].as_uint64())
+    {
+        return;
+    }
+
+    // if the children line up, look for the changes below this node
+    if(prev.has_child("shape") &&
+       curr.has_child("shape") &&
+       prev["shape"].to_uint64() == curr["shape"].as_uint64() &&
+       prev["children"].number_of_children() == node.number_of_children())
+    {
+        bool is_object = node.dtype().is_object();
+        for(index_t i = 0; i < node.number_of_children(); i++)
+        {
+            std::string cld_name;
+            if(is_object)
+            {
+                cld_name = node.child_names()[(size_t)i];
+            }
+            else
+            {
+                std::ostringstream oss;
+                oss << i;
+                cld_name = oss.str();
+            }
+
+            node_hash_tree_changes(node.child(i),
+                                   prev["children"].child(i),
+                                   curr["children"].child(i),
+                                   utils::join_path(path,cld_name),
+                                   changed_paths);
+        }
+        return;
+    }
+
+    changed_paths.push_back(path);
+}
+
+//---------------------------------------------------------------------------//
+uint64
+Node::hash() const
+{
+    return node_hash_digest(*this,NULL);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::hash_tree_update(Node &digests,
+                       std::vector<std::string> &changed_paths) const
+{
+    Node curr;
+    node_hash_digest(*this,&curr);
+    node_hash_tree_changes(*this,
+                           digests,
+                           curr,
+                           "",
+                           changed_paths);
+    digests.swap(curr);
+}
+
+
 //---------------------------------------------------------------------------//
 void
 Node::info(Node &res, const std::string &curr_path) const
@@ -15476,11 +16577,11 @@ Node::info(Node &res, const std::string &curr_path) const
             oss.str("");
             if(curr_path == "")
             {
-                oss << m_schema->object_order()[i];
+                oss << m_schema->child_names()[i];
             }
             else
             {
-                oss << curr_path << "/" << m_schema->object_order()[i];
+                oss << curr_path << "/" << m_schema->child_names()[i];
             }
             m_children[i]->info(res,oss.str());
         }
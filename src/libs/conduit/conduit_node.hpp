@@ -70,6 +70,7 @@
 #include "conduit_schema.hpp"
 #include "conduit_generator.hpp"
 #include "conduit_node_iterator.hpp"
+#include "conduit_node_path.hpp"
 #include "conduit_utils.hpp"
 
 
@@ -95,6 +96,11 @@ class NodeConstIterator;
 /// description:
 ///  Node is the primary class in conduit.
 ///
+///  Concurrent reads: const methods may be called from many threads on a
+///  tree that is not being modified, once the tree's cached schema sizes
+///  are filled. NodeConstView (conduit_node_view.hpp) fills them and 
+///  provides read-only access that never creates children.
+///
 //-----------------------------------------------------------------------------
 class CONDUIT_API Node
 {
@@ -117,6 +123,8 @@ public:
     friend class NodeIterator;
     friend class NodeConstIterator;
     friend class Generator;
+    ///  NodePath uses Node internals to resolve cached child indices
+    friend class NodePath;
 
 //-----------------------------------------------------------------------------
 //
@@ -139,10 +147,32 @@ public:
 //-----------------------------------------------------------------------------
     Node();
     Node(const Node &node);
+#ifdef CONDUIT_USE_CXX11
+    /// move constructor, steals the data, children and schema of the 
+    /// passed node (see set_node(Node &&)). noexcept, so containers
+    /// like std::vector<Node> move (instead of copy) when they grow.
+    /// Failures (e.g. running out of memory when the passed node's data
+    /// is owned by its ancestors and must be copied) terminate.
+    Node(Node &&node) noexcept;
+#endif
     ~Node();
 
     // returns any node to the empty state
     void reset();
+
+    /// exchanges the data, children and schema of this node with the 
+    /// passed node. The nodes keep their place in their own trees (their 
+    /// parents are unchanged) and children are relinked to their new 
+    /// parent. No data is copied unless either node's data lives in
+    /// memory owned by one of its ancestors, in which case the swap falls
+    /// back to copies.
+    ///
+    /// The one exception are small leaf values (16 bytes or less) that 
+    /// child nodes store inside the node itself (root nodes never do). 
+    /// These are copied into a heap allocation that is handed over, so 
+    /// data_ptr() values and set_external views taken before the swap
+    /// keep referring to the child's own storage, not to the moved value.
+    void swap(Node &node);
     
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
@@ -255,11 +285,27 @@ public:
     void save(const std::string &stream_path,
               const std::string &protocol="") const;
 
+    /// save with options. For conduit_bin, the "schema_format" option 
+    /// selects how the schema is saved:
+    ///   "json"   (default): json text in <stream_path>_json
+    ///   "binary": the binary schema format (Schema::to_binary()) in
+    ///             <stream_path>_schema_bin, which is faster to write and 
+    ///             read but can't be opened by older conduit versions.
+    /// load() and mmap() accept either schema file.
+    void save(const std::string &stream_path,
+              const std::string &protocol,
+              const Node &options) const;
+
     void mmap(const std::string &stream_path);
 
     void mmap(const std::string &stream_path,
               const Schema &schema);
 
+    /// returns the schema file of the conduit_bin file set at stream_path:
+    /// <stream_path>_json if it exists, otherwise <stream_path>_schema_bin
+    /// if that exists, otherwise <stream_path>_json.
+    static std::string conduit_bin_schema_path(const std::string &stream_path);
+
 //-----------------------------------------------------------------------------
 ///@}
 //-----------------------------------------------------------------------------
@@ -285,6 +331,16 @@ public:
 //-----------------------------------------------------------------------------
     void set_node(const Node &data);
     void set(const Node &data);
+
+#ifdef CONDUIT_USE_CXX11
+    /// move variants: steal the data, children and schema of the passed
+    /// node, which is left empty. If the passed node's data lives in 
+    /// memory owned by one of its ancestors, these fall back to a copy 
+    /// (and the passed node is unchanged). Small leaf values stored
+    /// inside a child node are copied (see swap()).
+    void set_node(Node &&data);
+    void set(Node &&data);
+#endif
     
     void set_dtype(const DataType &dtype);
     void set(const DataType &dtype);
@@ -2705,6 +2761,11 @@ public:
 // -- assignment operators for generic types --
 //-----------------------------------------------------------------------------
     Node &operator=(const Node &node);
+#ifdef CONDUIT_USE_CXX11
+    /// move assignment uses set(Node &&) semantics. noexcept: errors,
+    /// including moving a node into one of its descendants, terminate.
+    Node &operator=(Node &&node) noexcept;
+#endif
     Node &operator=(const DataType &dtype);
     Node &operator=(const Schema &schema);
 
@@ -2933,10 +2994,13 @@ public:
     /// update() adds children from n_src to current Node (analogous to a 
     /// python dictionary update) 
     ///
+    /// If this node and n_src have equal schemas and both are compact and
+    /// contiguous, all data is copied with a single memcpy.
     void        update(const Node &n_src);
 
     /// update_compatible() copies data from the children in n_src that match
     ///  the current Nodes children.
+    ///  (uses the same single memcpy fast path as update())
     void        update_compatible(const Node &n_src);
 
     /// update_external() sets this node to describe the data from the children 
@@ -3412,7 +3476,7 @@ public:
                         { return *m_schema;}
 
     const DataType   &dtype() const
-                        { return m_schema->dtype();}
+                        { return schema().dtype();}
 
     Schema          *schema_ptr() 
                         {return m_schema;}
@@ -3451,6 +3515,17 @@ public:
     /// total number of bytes memory mapped in this node hierarchy 
     index_t           total_bytes_mmaped() const;
 
+    /// id of the allocator used when this node allocates memory
+    /// (see conduit::utils::register_allocator)
+    index_t           allocator() const
+                         {return m_allocator_id;}
+
+    /// selects the allocator used for future allocations in this node
+    /// hierarchy. New children inherit the allocator of their parent.
+    /// Memory a node already owns is still released using the allocator
+    /// that provided it.
+    void              set_allocator(index_t allocator_id);
+
     /// Is this node using a compact data layout?
     bool              is_compact() const 
                          {return m_schema->is_compact();}
@@ -3500,6 +3575,14 @@ public:
                           Node &info,
                           const float64 epsilon = CONDUIT_EPSILON) const;
 
+    /// check for differences between this node and the given node, without
+    //  building a report. Returns the same result as the diff() variant 
+    //  above, but compares the structure of the trees before any data, 
+    //  compares identical leaves with memcmp and stops at the first 
+    //  difference
+    bool             diff(const Node &n,
+                          const float64 epsilon = CONDUIT_EPSILON) const;
+
     /// diff this node to the given node for compatibility (i.e. validate it
     //  has everything that the instance node has), storing the results
     //  digest in the provided data node
@@ -3507,6 +3590,22 @@ public:
                                      Node &info,
                                      const float64 epsilon = CONDUIT_EPSILON) const;
 
+    /// 64-bit (non-cryptographic) hash of this node's structure and data.
+    /// Leaves hash their dtype id, number of elements, and data bytes in 
+    /// element order, so the result does not depend on the memory layout
+    /// (a strided leaf and its compact copy have the same hash). Object 
+    /// children are combined independent of their order (as in diff()).
+    uint64           hash() const;
+
+    /// Computes per subtree digests for this node and appends the paths 
+    /// (relative to this node, list children use their index) of the 
+    /// subtrees that changed since `digests` was created by a previous call.
+    /// The comparison only descends into subtrees with different digests.
+    /// On return `digests` holds the new digests, ready for the next call.
+    /// If `digests` is empty, the root path ("") is reported.
+    void             hash_tree_update(Node &digests,
+                                      std::vector<std::string> &changed_paths) const;
+
     ///
     /// info() creates a node that contains metadata about the current
     /// node's memory properties
@@ -3585,6 +3684,22 @@ public:
     Node             &operator[](index_t idx);
     const Node       &operator[](index_t idx) const;
 
+    /// fetch methods that use a pre-parsed NodePath, these avoid 
+    /// splitting the path string and reuse the child indices cached in
+    /// the NodePath (see conduit_node_path.hpp)
+    Node             &fetch(const NodePath &path);
+    const Node       &fetch(const NodePath &path) const;
+
+    Node             &fetch_child(const NodePath &path);
+    const Node       &fetch_child(const NodePath &path) const;
+
+    /// the const fetch_ptr returns NULL if the path does not exist
+    Node             *fetch_ptr(const NodePath &path);
+    const Node       *fetch_ptr(const NodePath &path) const;
+
+    Node             &operator[](const NodePath &path);
+    const Node       &operator[](const NodePath &path) const;
+
     /// returns the number of children (list and object interfaces)
     index_t number_of_children() const;
 
@@ -3599,6 +3714,7 @@ public:
     bool        has_child(const std::string &name) const;
     /// checks if given path exists in the Node hierarchy 
     bool        has_path(const std::string &path) const;
+    bool        has_path(const NodePath &path) const;
     /// returns the direct child names for this node
     const std::vector<std::string> &child_names() const;
 
@@ -3626,6 +3742,10 @@ public:
     /// 
     /// the node owns the data, and the children
     /// are "set_external" to the proper location. 
+    ///
+    /// the entries share the child names of their object schemas
+    /// (see Schema_Object_Names), so the schema metadata for the names
+    /// does not grow with num_entries.
     /// 
     void list_of(const Schema &schema,
                  index_t num_entries);
@@ -3991,8 +4111,20 @@ private:
     void             append_node_ptr(Node *node)
                         {m_children.push_back(node);}
 
+    /// Note: set_parent also passes the parent's allocator on to the
+    /// new child, so children allocate from the same allocator.
     void             set_parent(Node *new_parent) 
-                        { m_parent = new_parent;}
+                        { m_parent = new_parent;
+                          m_allocator_id = new_parent->m_allocator_id;}
+
+    /// swaps data, children and schema contents with the passed node,
+    /// without any checks (used by swap and the move methods)
+    void             swap_contents(Node &node);
+    /// true if any ancestor of this node owns (allocated or mmaped) 
+    /// memory, which this node's data may point into
+    bool             has_ancestor_owned_data() const;
+    /// true if this node is the passed node or one of its descendants
+    bool             is_descendant_of(const Node &node) const;
 
 
 //-----------------------------------------------------------------------------
@@ -4035,6 +4167,14 @@ private:
     // memory allocation and mapping routines
     void             allocate(index_t dsize);
     void             allocate(const DataType &dtype);
+    // allocation for leaf data, small values are stored in m_inline_data
+    // instead of a separate heap allocation
+    void             allocate_leaf(index_t dsize);
+    // true if m_data points to this node's inline storage
+    bool             has_inline_data() const
+                        {return m_data == (const void*)m_inline_data;}
+    // moves inline data to a heap allocation, so it can be handed over
+    void             release_inline_data();
     void             mmap(const std::string &stream_path,
                           index_t dsize);
     // release any alloced or memory mapped data
@@ -4087,6 +4227,28 @@ private:
     void              serialize(uint8 *data,
                                 index_t curr_offset) const;
 
+    // private class that implements streamed writes for conduit_bin files
+    class BinaryWriter;
+
+    /// writes the data of all leaves in compact form, in the order of
+    /// the compact schema (used to save conduit_bin files without 
+    /// creating a compact copy)
+    void              write_leaves(BinaryWriter &writer) const;
+
+    /// writes the data of all leaves to the given file in compact form
+    void              write_conduit_bin(const std::string &path) const;
+
+    /// update helpers, these implement the recursive part of update() 
+    /// and update_compatible()
+    void              update_walk(const Node &n_src);
+    void              update_compatible_walk(const Node &n_src);
+    /// copies leaf data from n_src, if compatible (same dtype id and 
+    /// n_src has the same or fewer elements). Returns false if not.
+    bool              update_leaf(const Node &n_src);
+    /// if this node and n_src have equal schemas and are compact and 
+    /// contiguous, copies all data in one shot and returns true
+    bool              update_bulk_copy(const Node &n_src);
+
     /// Implements recursive check for if node is contiguous to the 
     /// passed start address. If contiguous, returns true and the 
     /// last address of the contiguous block.
@@ -4277,6 +4439,23 @@ private:
     bool      m_alloced;
     // flag that indicates if m_data is memory-mapped
     bool      m_mmaped;
+
+    // id of the allocator used for new allocations
+    index_t   m_allocator_id;
+    // id of the allocator that provided m_data (valid when m_alloced)
+    index_t   m_data_allocator_id;
+
+    // max number of bytes of leaf data stored inside the node
+    enum { INLINE_DATA_BYTES = 16 };
+
+    // inline storage for small leaf values (scalars, short strings),
+    // used in place of a heap allocation by child nodes that use the 
+    // built-in allocator. m_alloced is true when m_data points here.
+    union
+    {
+        uint64   m_inline_align;
+        uint8    m_inline_data[INLINE_DATA_BYTES];
+    };
     
     // private class that implements a cross platform memory map interface
     class MMap;
@@ -48,6 +48,7 @@
 ///
 //-----------------------------------------------------------------------------
 #include <sstream>
+#include <algorithm>
 
 #include "conduit_node_iterator.hpp"
 #include "conduit_error.hpp"
@@ -138,13 +139,13 @@ NodeIterator::name() const
     std::ostringstream oss;
 
     index_t index = m_index-1;
-    if(m_node->m_schema->dtype().is_list())
+    if(m_node->dtype().is_list())
     {
         oss << index;
     }
     else
     {
-        oss << m_node->m_schema->object_order()[(size_t)(index)];
+        oss << m_node->m_schema->child_names()[(size_t)(index)];
     }
 
     return oss.str();
@@ -388,13 +389,13 @@ NodeConstIterator::name() const
     std::ostringstream oss;
 
     index_t index = m_index-1;
-    if(m_node->m_schema->dtype().is_list())
+    if(m_node->dtype().is_list())
     {
         oss << index;
     }
     else
     {
-        oss << m_node->m_schema->object_order()[(size_t)(index)];
+        oss << m_node->m_schema->child_names()[(size_t)(index)];
     }
 
     return oss.str();
@@ -540,6 +541,376 @@ NodeConstIterator::info(Node &res) const
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Begin NodeConstLeafIterator
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// depth first walk that gathers leaves and their (concatenated) paths
+//-----------------------------------------------------------------------------
+static void
+gather_leaves(const Node &node,
+              std::string &path,
+              std::vector<const Node*> &leaves,
+              std::vector<index_t> &path_offsets,
+              std::string &paths)
+{
+    index_t dt_id = node.dtype().id();
+
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        size_t path_size = path.size();
+        index_t num_children = node.number_of_children();
+        for(index_t i = 0; i < num_children; i++)
+        {
+            if(path_size > 0)
+            {
+                path.push_back('/');
+            }
+
+            if(dt_id == DataType::OBJECT_ID)
+            {
+                path.append(node.child_names()[(size_t)i]);
+            }
+            else
+            {
+                std::ostringstream oss;
+                oss << i;
+                path.append(oss.str());
+            }
+
+            gather_leaves(node.child(i),path,leaves,path_offsets,paths);
+            path.resize(path_size);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        leaves.push_back(&node);
+        paths.append(path);
+        path_offsets.push_back((index_t)paths.size());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// orders leaves by address, with schema order as a tie breaker
+//-----------------------------------------------------------------------------
+struct LeafAddressCompare
+{
+    LeafAddressCompare(const std::vector<const Node*> &leaves)
+    : m_leaves(leaves)
+    {}
+
+    bool operator()(index_t a, index_t b) const
+    {
+        uintptr_t a_addr = (uintptr_t)m_leaves[(size_t)a]->element_ptr(0);
+        uintptr_t b_addr = (uintptr_t)m_leaves[(size_t)b]->element_ptr(0);
+        return a_addr < b_addr || (a_addr == b_addr && a < b);
+    }
+
+    const std::vector<const Node*> &m_leaves;
+};
+
+//---------------------------------------------------------------------------//
+NodeConstLeafIterator::NodeConstLeafIterator()
+: m_order(SCHEMA_ORDER),
+  m_index(0)
+{
+    m_path_offsets.push_back(0);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstLeafIterator::NodeConstLeafIterator(const Node &node,
+                                             LeafOrder order)
+: m_order(order),
+  m_index(0)
+{
+    m_path_offsets.push_back(0);
+    std::string path;
+    gather_leaves(node,path,m_leaves,m_path_offsets,m_paths);
+
+    if(m_order == ADDRESS_ORDER)
+    {
+        m_order_index.resize(m_leaves.size());
+        for(size_t i = 0; i < m_leaves.size(); i++)
+        {
+            m_order_index[i] = (index_t)i;
+        }
+        std::sort(m_order_index.begin(),
+                  m_order_index.end(),
+                  LeafAddressCompare(m_leaves));
+    }
+}
+
+//---------------------------------------------------------------------------//
+NodeConstLeafIterator::~NodeConstLeafIterator()
+{}
+
+//---------------------------------------------------------------------------//
+const Node *
+NodeConstLeafIterator::leaf(index_t idx) const
+{
+    if(idx < 0 || idx >= number_of_leaves())
+    {
+        CONDUIT_ERROR("<NodeConstLeafIterator> leaf index " << idx
+                      << " is out of bounds (number of leaves: " 
+                      << number_of_leaves() << ")");
+    }
+
+    if(m_order == ADDRESS_ORDER)
+    {
+        idx = m_order_index[(size_t)idx];
+    }
+
+    return m_leaves[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+const std::string &
+NodeConstLeafIterator::path() const
+{
+    return m_path;
+}
+
+//---------------------------------------------------------------------------//
+const Node &
+NodeConstLeafIterator::node() const
+{
+    return *leaf(m_index - 1);
+}
+
+//---------------------------------------------------------------------------//
+const DataType &
+NodeConstLeafIterator::dtype() const
+{
+    return node().dtype();
+}
+
+//---------------------------------------------------------------------------//
+const void *
+NodeConstLeafIterator::data_ptr() const
+{
+    return node().element_ptr(0);
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeConstLeafIterator::index() const
+{
+    return m_index - 1;
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeConstLeafIterator::is_contiguous_with_previous() const
+{
+    if(m_index < 2)
+    {
+        return false;
+    }
+
+    const DataType &prev_dtype = leaf(m_index - 2)->dtype();
+    const DataType &curr_dtype = dtype();
+
+    // (DataType::is_compact() also requires a zero offset)
+    if( (prev_dtype.number_of_elements() > 1 &&
+         prev_dtype.stride() != prev_dtype.element_bytes()) ||
+        (curr_dtype.number_of_elements() > 1 &&
+         curr_dtype.stride() != curr_dtype.element_bytes()) )
+    {
+        return false;
+    }
+
+    const uint8 *prev_end = (const uint8*)leaf(m_index - 2)->element_ptr(0) +
+                            prev_dtype.number_of_elements() * 
+                            prev_dtype.element_bytes();
+
+    return prev_end == (const uint8*)data_ptr();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeConstLeafIterator::number_of_leaves() const
+{
+    return (index_t)m_leaves.size();
+}
+
+//---------------------------------------------------------------------------//
+NodeConstLeafIterator::LeafOrder
+NodeConstLeafIterator::order() const
+{
+    return m_order;
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeConstLeafIterator::has_next() const
+{
+    return m_index < number_of_leaves();
+}
+
+//---------------------------------------------------------------------------//
+const Node &
+NodeConstLeafIterator::next()
+{
+    const Node *res = leaf(m_index);
+
+    index_t idx = m_index;
+    if(m_order == ADDRESS_ORDER)
+    {
+        idx = m_order_index[(size_t)idx];
+    }
+
+    // assign reuses m_path's storage once it is large enough
+    index_t path_start = m_path_offsets[(size_t)idx];
+    index_t path_end   = m_path_offsets[(size_t)idx + 1];
+    m_path.assign(m_paths, (size_t)path_start, (size_t)(path_end - path_start));
+
+    m_index++;
+    return *res;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeConstLeafIterator::to_front()
+{
+    m_index = 0;
+    m_path.clear();
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeConstLeafIterator::info(Node &res) const
+{
+    res.reset();
+    res["index"] = m_index;
+    res["number_of_leaves"] = number_of_leaves();
+    res["order"] = (m_order == ADDRESS_ORDER) ? "address" : "schema";
+    if(m_index > 0)
+    {
+        res["path"] = m_path;
+    }
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// End NodeConstLeafIterator
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Begin NodeLeafIterator
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator::NodeLeafIterator()
+: m_itr()
+{}
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator::NodeLeafIterator(Node &node,
+                                   NodeConstLeafIterator::LeafOrder order)
+: m_itr(node,order)
+{}
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator::~NodeLeafIterator()
+{}
+
+//---------------------------------------------------------------------------//
+const std::string &
+NodeLeafIterator::path() const
+{
+    return m_itr.path();
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodeLeafIterator::node()
+{
+    // the wrapped iterator was created from a non-const Node
+    return const_cast<Node&>(m_itr.node());
+}
+
+//---------------------------------------------------------------------------//
+const DataType &
+NodeLeafIterator::dtype() const
+{
+    return m_itr.dtype();
+}
+
+//---------------------------------------------------------------------------//
+void *
+NodeLeafIterator::data_ptr()
+{
+    return node().element_ptr(0);
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeLeafIterator::index() const
+{
+    return m_itr.index();
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeLeafIterator::is_contiguous_with_previous() const
+{
+    return m_itr.is_contiguous_with_previous();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeLeafIterator::number_of_leaves() const
+{
+    return m_itr.number_of_leaves();
+}
+
+//---------------------------------------------------------------------------//
+NodeConstLeafIterator::LeafOrder
+NodeLeafIterator::order() const
+{
+    return m_itr.order();
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeLeafIterator::has_next() const
+{
+    return m_itr.has_next();
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodeLeafIterator::next()
+{
+    return const_cast<Node&>(m_itr.next());
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIterator::to_front()
+{
+    m_itr.to_front();
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIterator::info(Node &res) const
+{
+    m_itr.info(res);
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// End NodeLeafIterator
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
 
 
 }
@@ -241,6 +241,182 @@ private:
 // -- end conduit::NodeIterator --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodeConstLeafIterator --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodeConstLeafIterator
+///
+/// description:
+///  Const iterator over all leaves (nodes that hold data) of a Node tree, 
+///  in a single flat pass. Leaves are visited either in schema order 
+///  (depth first, in child order) or sorted by the address of their first
+///  element, which allows callers to merge contiguous regions.
+///
+///  The leaves and their paths are gathered when the iterator is created, 
+///  so advancing the iterator does not allocate. Empty nodes are skipped.
+///  Paths are relative to the root node, list children use their index.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API NodeConstLeafIterator
+{
+public:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeConstLeafIterator public members --
+//
+//-----------------------------------------------------------------------------
+
+    /// Orders supported by leaf iterators
+    typedef enum
+    {
+        SCHEMA_ORDER = 0, // depth first, in child order
+        ADDRESS_ORDER     // by the address of the leaf's first element 
+    } LeafOrder;
+
+//-----------------------------------------------------------------------------
+/// NodeConstLeafIterator Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor.
+    NodeConstLeafIterator();
+    /// Primary iterator constructor.
+    NodeConstLeafIterator(const Node &node,
+                          LeafOrder order = SCHEMA_ORDER);
+    /// Destructor 
+    ~NodeConstLeafIterator();
+
+//-----------------------------------------------------------------------------
+/// Iterator value and property access (for the current leaf).
+//-----------------------------------------------------------------------------
+    const std::string &path() const;
+    const Node        &node() const;
+    const DataType    &dtype() const;
+    /// pointer to the leaf's first element
+    const void        *data_ptr() const;
+    /// index of the current leaf in the iteration order
+    index_t            index() const;
+    /// true if the previous and current leaves are both compact and 
+    /// the current leaf's data starts where the previous leaf's data ends
+    bool               is_contiguous_with_previous() const;
+
+    index_t            number_of_leaves() const;
+    LeafOrder          order() const;
+
+//-----------------------------------------------------------------------------
+/// Iterator forward control.
+//-----------------------------------------------------------------------------
+    bool               has_next() const;
+    const Node        &next();
+    void               to_front();
+
+//-----------------------------------------------------------------------------
+/// Human readable info about this iterator
+//-----------------------------------------------------------------------------
+    void               info(Node &res) const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeConstLeafIterator private methods --
+//
+//-----------------------------------------------------------------------------
+    const Node        *leaf(index_t idx) const;
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeConstLeafIterator private data members --
+//
+//-----------------------------------------------------------------------------
+    /// leaves, in schema order
+    std::vector<const Node*>  m_leaves;
+    /// for ADDRESS_ORDER: schema order index of each leaf, by address
+    std::vector<index_t>      m_order_index;
+    /// offsets of each leaf's path in m_paths (number of leaves + 1)
+    std::vector<index_t>      m_path_offsets;
+    /// all leaf paths, concatenated
+    std::string               m_paths;
+    /// path of the current leaf
+    std::string               m_path;
+    /// iteration order
+    LeafOrder                 m_order;
+    /// index of the next leaf
+    index_t                   m_index;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::NodeConstLeafIterator --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodeLeafIterator --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodeLeafIterator
+///
+/// description:
+///  Leaf iterator that provides non-const access to the leaves,
+///  see NodeConstLeafIterator.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API NodeLeafIterator
+{
+public:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeLeafIterator public members --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/// NodeLeafIterator Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor.
+    NodeLeafIterator();
+    /// Primary iterator constructor.
+    NodeLeafIterator(Node &node,
+                     NodeConstLeafIterator::LeafOrder order = 
+                        NodeConstLeafIterator::SCHEMA_ORDER);
+    /// Destructor 
+    ~NodeLeafIterator();
+
+//-----------------------------------------------------------------------------
+/// Iterator value and property access (for the current leaf).
+//-----------------------------------------------------------------------------
+    const std::string &path() const;
+    Node              &node();
+    const DataType    &dtype() const;
+    /// pointer to the leaf's first element
+    void              *data_ptr();
+    index_t            index() const;
+    bool               is_contiguous_with_previous() const;
+
+    index_t            number_of_leaves() const;
+    NodeConstLeafIterator::LeafOrder order() const;
+
+//-----------------------------------------------------------------------------
+/// Iterator forward control.
+//-----------------------------------------------------------------------------
+    bool               has_next() const;
+    Node              &next();
+    void               to_front();
+
+//-----------------------------------------------------------------------------
+/// Human readable info about this iterator
+//-----------------------------------------------------------------------------
+    void               info(Node &res) const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeLeafIterator private data members --
+//
+//-----------------------------------------------------------------------------
+    /// the const iterator we wrap, it was created from a non-const Node
+    NodeConstLeafIterator     m_itr;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::NodeLeafIterator --
+//-----------------------------------------------------------------------------
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
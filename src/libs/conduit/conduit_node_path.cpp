@@ -0,0 +1,310 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_path.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_node_path.hpp"
+#include "conduit_node.hpp"
+#include "conduit_error.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// cached index value used to mark parent ("..") segments
+//-----------------------------------------------------------------------------
+static const index_t NODE_PATH_PARENT_SEGMENT = -2;
+
+//-----------------------------------------------------------------------------
+// NodePath Construction and Destruction
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+NodePath::NodePath()
+: m_path(),
+  m_segments(),
+  m_indices()
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+NodePath::NodePath(const NodePath &path)
+: m_path(path.m_path),
+  m_segments(path.m_segments),
+  m_indices(path.m_indices)
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+NodePath::NodePath(const std::string &path)
+{
+    set(path);
+}
+
+//---------------------------------------------------------------------------//
+NodePath::NodePath(const char *path)
+{
+    set(std::string(path));
+}
+
+//---------------------------------------------------------------------------//
+NodePath::~NodePath()
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+NodePath &
+NodePath::operator=(const NodePath &path)
+{
+    if(this != &path)
+    {
+        m_path     = path.m_path;
+        m_segments = path.m_segments;
+        m_indices  = path.m_indices;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodePath::set(const std::string &path)
+{
+    m_path = path;
+    m_segments.clear();
+    m_indices.clear();
+
+    std::string p_curr;
+    std::string p_next;
+    std::string p_rest = path;
+
+    while(!p_rest.empty())
+    {
+        utils::split_path(p_rest,p_curr,p_next);
+        // cull empty paths
+        if(!p_curr.empty())
+        {
+            m_segments.push_back(p_curr);
+            if(p_curr == "..")
+            {
+                m_indices.push_back(NODE_PATH_PARENT_SEGMENT);
+            }
+            else
+            {
+                m_indices.push_back(-1);
+            }
+        }
+        p_rest = p_next;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Path info
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+const std::string &
+NodePath::path() const
+{
+    return m_path;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodePath::number_of_segments() const
+{
+    return (index_t) m_segments.size();
+}
+
+//---------------------------------------------------------------------------//
+const std::string &
+NodePath::segment(index_t idx) const
+{
+    if( idx < 0 || ((size_t) idx) >= m_segments.size())
+    {
+        CONDUIT_ERROR("Invalid path segment index: " << idx <<
+                      " (number of segments: " << m_segments.size() << ")");
+    }
+    return m_segments[(size_t)idx];
+}
+
+//-----------------------------------------------------------------------------
+// Path resolution
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Node &
+NodePath::fetch(Node &node) const
+{
+    if(m_segments.empty())
+    {
+        CONDUIT_ERROR("Cannot fetch empty path string");
+    }
+
+    Node *curr = &node;
+    for(size_t i=0; i < m_segments.size(); i++)
+    {
+        if(m_indices[i] == NODE_PATH_PARENT_SEGMENT)
+        {
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch from NULL parent" << m_path);
+            }
+            curr = curr->m_parent;
+            continue;
+        }
+
+        Node *child = resolve_segment(*curr,(index_t)i);
+        if(child == NULL)
+        {
+            // slow path: create the child and cache its index
+            child = &curr->fetch(m_segments[i]);
+            m_indices[i] = curr->m_schema->find_child_index(m_segments[i]);
+        }
+        curr = child;
+    }
+
+    return *curr;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodePath::fetch_existing(Node &node) const
+{
+    Node *res = resolve(node);
+    if(res == NULL)
+    {
+        // use the string path for the standard error message
+        return node.fetch_child(m_path);
+    }
+    return *res;
+}
+
+//---------------------------------------------------------------------------//
+const Node &
+NodePath::fetch_existing(const Node &node) const
+{
+    const Node *res = resolve(node);
+    if(res == NULL)
+    {
+        // use the string path for the standard error message
+        return node.fetch_child(m_path);
+    }
+    return *res;
+}
+
+//---------------------------------------------------------------------------//
+Node *
+NodePath::resolve(Node &node) const
+{
+    Node *curr = &node;
+    for(size_t i=0; i < m_segments.size() && curr != NULL; i++)
+    {
+        if(m_indices[i] == NODE_PATH_PARENT_SEGMENT)
+        {
+            curr = curr->m_parent;
+        }
+        else
+        {
+            curr = resolve_segment(*curr,(index_t)i);
+        }
+    }
+    return curr;
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+NodePath::resolve(const Node &node) const
+{
+    // resolve does not modify the node hierarchy
+    return resolve(const_cast<Node&>(node));
+}
+
+//-----------------------------------------------------------------------------
+// Private methods
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Node *
+NodePath::resolve_segment(Node &node, index_t seg_idx) const
+{
+    if(!node.dtype().is_object())
+    {
+        return NULL;
+    }
+
+    const Schema *schema = node.m_schema;
+    const std::vector<std::string> &names = schema->object_order();
+    const std::string &name = m_segments[(size_t)seg_idx];
+    index_t idx = m_indices[(size_t)seg_idx];
+
+    // fast path: the cached index still refers to a child with our name
+    if(idx < 0 ||
+       ((size_t) idx) >= names.size() ||
+       names[(size_t)idx] != name)
+    {
+        // slow path: the tree changed shape, lookup by name
+        idx = schema->find_child_index(name);
+        if(idx < 0)
+        {
+            return NULL;
+        }
+        m_indices[(size_t)seg_idx] = idx;
+    }
+
+    return node.m_children[(size_t)idx];
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
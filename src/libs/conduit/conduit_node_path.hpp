@@ -0,0 +1,188 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_path.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_NODE_PATH_HPP
+#define CONDUIT_NODE_PATH_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+// forward declare Node 
+class Node;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodePath --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodePath
+///
+/// description:
+///  A pre-parsed path used to repeatedly fetch the same path from a Node
+///  hierarchy. 
+///
+///  The path is split into segments once, and the child index found for
+///  each segment is cached. When a NodePath is used again, each cached
+///  index is checked against the name of the child at that index and 
+///  the slow (by name) lookup is only used if the tree changed shape.
+///  Resolving a NodePath does not allocate.
+///
+///  Fetching with a NodePath follows the same rules as fetching with a
+///  path string: empty segments are ignored and ".." moves to the parent.
+///
+///  Since lookups update the cached indices, a NodePath instance should
+///  not be shared across threads. 
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API NodePath
+{
+public:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodePath public members --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/// NodePath Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor (empty path).
+    NodePath();
+    /// Copy constructor.
+    NodePath(const NodePath &path);
+    /// Primary constructors.
+    explicit NodePath(const std::string &path);
+    explicit NodePath(const char *path);
+    /// Destructor 
+    ~NodePath();
+
+    /// Assignment operator.
+    NodePath &operator=(const NodePath &path);
+
+    /// parses a new path, and clears the cached child indices
+    void                set(const std::string &path);
+
+//-----------------------------------------------------------------------------
+/// Path info
+//-----------------------------------------------------------------------------
+    /// returns the path string this NodePath was created from
+    const std::string  &path() const;
+    /// returns the number of (non empty) path segments
+    index_t             number_of_segments() const;
+    /// returns the name of given segment
+    const std::string  &segment(index_t idx) const;
+
+//-----------------------------------------------------------------------------
+/// Path resolution
+//-----------------------------------------------------------------------------
+    /// these methods match the Node fetch methods:
+    ///  Node::fetch(const NodePath &), Node::fetch_child(const NodePath &),
+    ///  Node::fetch_ptr(const NodePath &) and Node::has_path(const NodePath &)
+    /// are implemented using them.
+
+    /// fetches the node at this path relative to the given node, creating
+    /// any nodes that don't exist (like Node::fetch)
+    Node               &fetch(Node &node) const;
+
+    /// fetches the node at this path relative to the given node, 
+    /// throws an Error if the path doesn't exist (like Node::fetch_child)
+    Node               &fetch_existing(Node &node) const;
+    const Node         &fetch_existing(const Node &node) const;
+
+    /// returns a pointer to the node at this path relative to the given
+    /// node, or NULL if the path doesn't exist
+    Node               *resolve(Node &node) const;
+    const Node         *resolve(const Node &node) const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodePath private methods --
+//
+//-----------------------------------------------------------------------------
+    /// returns the child of node for the given segment (using and updating
+    /// the cached index) or NULL if no such child exists
+    Node               *resolve_segment(Node &node, index_t seg_idx) const;
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodePath private data members --
+//
+//-----------------------------------------------------------------------------
+    /// original path string
+    std::string                  m_path;
+    /// path segments (empty segments are removed)
+    std::vector<std::string>     m_segments;
+    /// cached child index for each segment (-1 when unknown,
+    /// -2 for parent ("..") segments) 
+    mutable std::vector<index_t> m_indices;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::NodePath --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
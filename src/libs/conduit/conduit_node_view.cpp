@@ -0,0 +1,267 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_view.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_node_view.hpp"
+#include "conduit_error.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//---------------------------------------------------------------------------//
+NodeConstView::NodeConstView()
+: m_node(NULL)
+{}
+
+//---------------------------------------------------------------------------//
+NodeConstView::NodeConstView(const NodeConstView &view)
+: m_node(view.m_node)
+{}
+
+//---------------------------------------------------------------------------//
+NodeConstView::NodeConstView(const Node &node)
+: m_node(&node)
+{
+    // fill the cached sizes of every schema in the tree up front (the
+    // root's cache is only valid once all of its descendants' caches are)
+    const Node *root = &node;
+    while(root->parent() != NULL)
+    {
+        root = root->parent();
+    }
+    root->schema().total_bytes_compact();
+}
+
+//---------------------------------------------------------------------------//
+NodeConstView::NodeConstView(const Node *node, bool)
+: m_node(node)
+{}
+
+//---------------------------------------------------------------------------//
+NodeConstView::~NodeConstView()
+{}
+
+//---------------------------------------------------------------------------//
+NodeConstView &
+NodeConstView::operator=(const NodeConstView &view)
+{
+    m_node = view.m_node;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeConstView::is_empty_view() const
+{
+    return m_node == NULL;
+}
+
+//---------------------------------------------------------------------------//
+const Node &
+NodeConstView::node() const
+{
+    if(m_node == NULL)
+    {
+        CONDUIT_ERROR("<NodeConstView> empty view does not wrap a Node");
+    }
+    return *m_node;
+}
+
+//---------------------------------------------------------------------------//
+const Schema &
+NodeConstView::schema() const
+{
+    return node().schema();
+}
+
+//---------------------------------------------------------------------------//
+const DataType &
+NodeConstView::dtype() const
+{
+    return node().dtype();
+}
+
+//---------------------------------------------------------------------------//
+std::string
+NodeConstView::name() const
+{
+    return node().name();
+}
+
+//---------------------------------------------------------------------------//
+std::string
+NodeConstView::path() const
+{
+    return node().path();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeConstView::number_of_children() const
+{
+    return node().number_of_children();
+}
+
+//---------------------------------------------------------------------------//
+const std::vector<std::string> &
+NodeConstView::child_names() const
+{
+    return node().child_names();
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeConstView::has_child(const std::string &name) const
+{
+    return node().has_child(name);
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeConstView::has_path(const std::string &path) const
+{
+    return node().has_path(path);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstView
+NodeConstView::child(index_t idx) const
+{
+    return NodeConstView(&node().child(idx),true);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstView
+NodeConstView::child(const std::string &name) const
+{
+    if(!node().has_child(name))
+    {
+        CONDUIT_ERROR("<NodeConstView> Node(" << node().path() << ")"
+                      << " has no child named: " << name);
+    }
+    return NodeConstView(&node().child(node().schema().child_index(name)),
+                         true);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstView
+NodeConstView::fetch(const std::string &path) const
+{
+    // the const fetch throws if the path does not exist
+    return NodeConstView(&node().fetch_child(path),true);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstView
+NodeConstView::fetch(const NodePath &path) const
+{
+    return NodeConstView(&node().fetch_child(path),true);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstView
+NodeConstView::operator[](index_t idx) const
+{
+    return child(idx);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstView
+NodeConstView::operator[](const std::string &path) const
+{
+    return fetch(path);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstIterator
+NodeConstView::children() const
+{
+    return node().children();
+}
+
+//---------------------------------------------------------------------------//
+NodeConstLeafIterator
+NodeConstView::leaves(NodeConstLeafIterator::LeafOrder order) const
+{
+    return NodeConstLeafIterator(node(),order);
+}
+
+//---------------------------------------------------------------------------//
+const void *
+NodeConstView::data_ptr() const
+{
+    return node().element_ptr(0);
+}
+
+//---------------------------------------------------------------------------//
+const void *
+NodeConstView::element_ptr(index_t idx) const
+{
+    return node().element_ptr(idx);
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeConstView::total_strided_bytes() const
+{
+    return node().total_strided_bytes();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeConstView::total_bytes_compact() const
+{
+    return node().total_bytes_compact();
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
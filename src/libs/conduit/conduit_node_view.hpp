@@ -0,0 +1,189 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_view.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_NODE_VIEW_HPP
+#define CONDUIT_NODE_VIEW_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodeConstView --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodeConstView
+///
+/// description:
+///  A read-only handle to a Node that can be shared by many threads.
+///
+///  Const Node methods can be called from many threads at once (Schemas
+///  lazily fill their cached byte sizes, these caches are atomic). Creating
+///  a NodeConstView fills these caches for the whole tree up front.
+///
+///  Unlike operator[] on a non-const Node, fetching a path that does not
+///  exist from a view never creates it, it throws an Error.
+///
+///  The contract: while views of a tree are in use, the tree must not be
+///  modified (through any non-const Node or Schema method). Views of 
+///  children (from fetch(), child(), operator[]) are cheap and can be 
+///  created concurrently. NodePath instances cache lookups and must not be
+///  shared across threads.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API NodeConstView
+{
+public:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeConstView public members --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/// NodeConstView Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor (an empty view).
+    NodeConstView();
+    /// Copy constructor.
+    NodeConstView(const NodeConstView &view);
+    /// Primary constructor, fills the cached sizes for the tree that 
+    /// holds the given node.
+    explicit NodeConstView(const Node &node);
+    /// Destructor 
+    ~NodeConstView();
+
+    /// Assignment operator.
+    NodeConstView &operator=(const NodeConstView &view);
+
+//-----------------------------------------------------------------------------
+/// Access to the wrapped Node
+//-----------------------------------------------------------------------------
+    /// true if this view does not wrap a node
+    bool                            is_empty_view() const;
+    /// the wrapped node, throws an Error for an empty view
+    const Node                     &node() const;
+
+    const Schema                   &schema() const;
+    const DataType                 &dtype() const;
+    std::string                     name() const;
+    std::string                     path() const;
+
+//-----------------------------------------------------------------------------
+/// Hierarchy access (never modifies the tree)
+//-----------------------------------------------------------------------------
+    index_t                         number_of_children() const;
+    const std::vector<std::string> &child_names() const;
+    bool                            has_child(const std::string &name) const;
+    bool                            has_path(const std::string &path) const;
+
+    /// these throw an Error if the child or path does not exist
+    NodeConstView                   child(index_t idx) const;
+    NodeConstView                   child(const std::string &name) const;
+    NodeConstView                   fetch(const std::string &path) const;
+    NodeConstView                   fetch(const NodePath &path) const;
+
+    NodeConstView                   operator[](index_t idx) const;
+    NodeConstView                   operator[](const std::string &path) const;
+
+    NodeConstIterator               children() const;
+    NodeConstLeafIterator           leaves(NodeConstLeafIterator::LeafOrder 
+                                              order = 
+                                        NodeConstLeafIterator::SCHEMA_ORDER) const;
+
+//-----------------------------------------------------------------------------
+/// Data access
+//-----------------------------------------------------------------------------
+    /// pointer to the first element of a leaf
+    const void                     *data_ptr() const;
+    const void                     *element_ptr(index_t idx) const;
+
+    index_t                         total_strided_bytes() const;
+    index_t                         total_bytes_compact() const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeConstView private methods --
+//
+//-----------------------------------------------------------------------------
+    /// wraps a node whose tree's sizes are already cached 
+    NodeConstView(const Node *node, bool);
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeConstView private data members --
+//
+//-----------------------------------------------------------------------------
+    /// the wrapped node
+    const Node *m_node;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::NodeConstView --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
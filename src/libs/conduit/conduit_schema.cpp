@@ -53,6 +53,11 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <algorithm>
+#include <cstring>
+#ifdef CONDUIT_USE_CXX11
+#include <atomic>
+#endif
 
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
@@ -70,6 +75,72 @@ namespace conduit
 
 std::vector<std::string> Schema::m_empty_child_names;
 
+//-----------------------------------------------------------------------------
+//
+// -- Schema_Object_Names and Schema_Object_Hierarchy --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+struct Schema::Schema_Object_Names
+{
+    Schema_Object_Names()
+    : m_refs(1)
+    {}
+
+    std::vector<std::string>        object_order;
+    Schema_Object_Index             object_index;
+
+    index_t use_count() const
+    {
+        return m_refs;
+    }
+
+    void acquire()
+    {
+        m_refs++;
+    }
+
+    // deletes this instance when the last reference is released
+    void release()
+    {
+        if(--m_refs == 0)
+        {
+            delete this;
+        }
+    }
+
+private:
+    // copies of a shared tree can be made from many threads (see 
+    // NodeConstView), so the count is atomic when C++11 is available
+#ifdef CONDUIT_USE_CXX11
+    std::atomic<index_t>            m_refs;
+#else
+    index_t                         m_refs;
+#endif
+};
+
+//---------------------------------------------------------------------------//
+Schema::Schema_Object_Hierarchy::Schema_Object_Hierarchy(
+                                        Schema_Object_Names *shared_names)
+: names(shared_names)
+{
+    if(names != NULL)
+    {
+        names->acquire();
+    }
+    else
+    {
+        names = new Schema_Object_Names();
+    }
+}
+
+//---------------------------------------------------------------------------//
+Schema::Schema_Object_Hierarchy::~Schema_Object_Hierarchy()
+{
+    names->release();
+}
+
 //=============================================================================
 //-----------------------------------------------------------------------------
 //
@@ -99,6 +170,15 @@ Schema::Schema(const Schema &schema)
     set(schema);
 }
 
+#ifdef CONDUIT_USE_CXX11
+//---------------------------------------------------------------------------//
+Schema::Schema(Schema &&schema) noexcept
+{
+    init_defaults();
+    swap(schema);
+}
+#endif
+
 //---------------------------------------------------------------------------//
 Schema::Schema(index_t dtype_id)
 {
@@ -137,9 +217,62 @@ Schema::~Schema()
 void
 Schema::reset()
 {
+    invalidate_sizes();
     release();
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::swap(Schema &schema)
+{
+    if(this == &schema)
+    {
+        return;
+    }
+
+    // swapping with an ancestor would create a cycle
+    for(const Schema *s = m_parent; s != NULL; s = s->m_parent)
+    {
+        if(s == &schema)
+        {
+            CONDUIT_ERROR("Cannot swap a Schema with one of its ancestors");
+        }
+    }
+
+    for(const Schema *s = schema.m_parent; s != NULL; s = s->m_parent)
+    {
+        if(s == this)
+        {
+            CONDUIT_ERROR("Cannot swap a Schema with one of its descendants");
+        }
+    }
+
+    invalidate_sizes();
+    schema.invalidate_sizes();
+
+    std::swap(m_dtype,schema.m_dtype);
+    std::swap(m_hierarchy_data,schema.m_hierarchy_data);
+
+    // relink children to their new parents
+    if(m_dtype.is_object() || m_dtype.is_list())
+    {
+        std::vector<Schema*> &chld = children();
+        for(size_t i=0; i < chld.size(); i++)
+        {
+            chld[i]->m_parent = this;
+        }
+    }
+
+    if(schema.m_dtype.is_object() || schema.m_dtype.is_list())
+    {
+        std::vector<Schema*> &chld = schema.children();
+        for(size_t i=0; i < chld.size(); i++)
+        {
+            chld[i]->m_parent = &schema;
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 //
 // Schema set methods
@@ -155,11 +288,8 @@ Schema::set(const Schema &schema)
     index_t dt_id = schema.m_dtype.id();
     if (dt_id == DataType::OBJECT_ID)
     {
-       init_object();
+       init_object(schema);
        init_children = true;
-
-       object_map()   = schema.object_map();
-       object_order() = schema.object_order();
     } 
     else if (dt_id == DataType::LIST_ID)
     {
@@ -183,6 +313,17 @@ Schema::set(const Schema &schema)
            my_children.push_back(child_schema);
        }
     }
+
+    // our children were copied along with their cached sizes, 
+    // so we can reuse the source's cached sizes as well
+    if(schema.m_sizes_valid.load(std::memory_order_acquire))
+    {
+        store_sizes(schema.m_total_strided_bytes.load(
+                                                std::memory_order_relaxed),
+                    schema.m_total_bytes_compact.load(
+                                                std::memory_order_relaxed),
+                    schema.m_spanned_bytes.load(std::memory_order_relaxed));
+    }
 }
 
 
@@ -235,6 +376,24 @@ Schema::operator=(const Schema &schema)
     return *this;
 }
 
+#ifdef CONDUIT_USE_CXX11
+//---------------------------------------------------------------------------//
+Schema &
+Schema::operator=(Schema &&schema) noexcept
+{
+    if(this != &schema)
+    {
+        // steal into a temp first, so this is safe when the passed 
+        // schema is one of our descendants
+        Schema tmp;
+        tmp.swap(schema);
+        reset();
+        swap(tmp);
+    }
+    return *this;
+}
+#endif
+
 //---------------------------------------------------------------------------//
 Schema &
 Schema::operator=(const DataType &dtype)
@@ -262,44 +421,22 @@ Schema::operator=(const std::string &json_schema)
 index_t
 Schema::total_strided_bytes() const
 {
-    index_t res = 0;
-    index_t dt_id = m_dtype.id();
-    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    if(!m_sizes_valid.load(std::memory_order_acquire))
     {
-        const std::vector<Schema*> &lst = children();
-        for (std::vector<Schema*>::const_iterator itr = lst.begin();
-             itr < lst.end(); ++itr)
-        {
-            res += (*itr)->total_strided_bytes();
-        }
+        update_sizes();
     }
-    else if (dt_id != DataType::EMPTY_ID)
-    {
-        res = m_dtype.strided_bytes();
-    }
-    return res;
+    return m_total_strided_bytes.load(std::memory_order_relaxed);
 }
 
 //---------------------------------------------------------------------------//
 index_t
 Schema::total_bytes_compact() const
 {
-    index_t res = 0;
-    index_t dt_id = m_dtype.id();
-    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    if(!m_sizes_valid.load(std::memory_order_acquire))
     {
-        const std::vector<Schema*> &lst = children();
-        for (std::vector<Schema*>::const_iterator itr = lst.begin();
-             itr < lst.end(); ++itr)
-        {
-            res += (*itr)->total_bytes_compact();
-        }
+        update_sizes();
     }
-    else if (dt_id != DataType::EMPTY_ID)
-    {
-        res = m_dtype.bytes_compact();
-    }
-    return res;
+    return m_total_bytes_compact.load(std::memory_order_relaxed);
 }
 
 //---------------------------------------------------------------------------//
@@ -313,29 +450,11 @@ Schema::is_compact() const
 index_t
 Schema::spanned_bytes() const
 {
-    index_t res = 0;
-
-    index_t dt_id = m_dtype.id();
-    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
-    {
-        const std::vector<Schema*> &lst = children();
-        for (std::vector<Schema*>::const_iterator itr = lst.begin();
-             itr < lst.end(); ++itr)
-        {
-            // spanned bytes is the max of the spanned bytes of 
-            // all children
-            index_t curr_span = (*itr)->spanned_bytes();
-            if(curr_span > res)
-            {
-                res = curr_span;
-            }
-        }
-    }
-    else
+    if(!m_sizes_valid.load(std::memory_order_acquire))
     {
-        res = m_dtype.spanned_bytes();
+        update_sizes();
     }
-    return res;
+    return m_spanned_bytes.load(std::memory_order_relaxed);
 }
 
 
@@ -354,20 +473,18 @@ Schema::compatible(const Schema &s) const
     if(dt_id == DataType::OBJECT_ID)
     {
         // each of s's entries that match paths must have dtypes that match
+        const std::vector<std::string> &s_names = s.object_order();
         
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
+        for(size_t s_idx = 0; s_idx < s_names.size() && res; s_idx++)
         {
             // make sure we actually have the path
-            if(has_path(itr->first))
+            index_t idx = find_child_index(s_names[s_idx]);
+            if(idx >= 0)
             {
                 // use index to fetch the child from the other schema
-                const Schema &s_chld = s.child(itr->second);
-                // fetch our child by name
-                const Schema &chld = fetch_child(itr->first);
+                const Schema &s_chld = s.child((index_t)s_idx);
+                // fetch our child by index
+                const Schema &chld = child(idx);
                 // do compat check
                 res = chld.compatible(s_chld);
             }
@@ -412,32 +529,20 @@ Schema::equals(const Schema &s) const
     if(dt_id == DataType::OBJECT_ID)
     {
         // all entries must be equal
-        
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
-        {
-            if(has_path(itr->first))
-            {
-                size_t s_idx = (size_t) itr->second;
-                res = s.children()[s_idx]->equals(fetch_child(itr->first));
-            }
-            else
-            {
-                res = false;
-            }
-        }
-        
-        for(itr  = object_map().begin(); 
-            itr != object_map().end() && res;
-            itr++)
+
+        // if we have the same number of children, checking that each of 
+        // s's children exists and equals ours covers both directions
+        const std::vector<std::string> &s_names = s.object_order();
+
+        if(s_names.size() != object_order().size())
+            return false;
+
+        for(size_t s_idx = 0; s_idx < s_names.size() && res; s_idx++)
         {
-            if(s.has_path(itr->first))
+            index_t idx = find_child_index(s_names[s_idx]);
+            if(idx >= 0)
             {
-                size_t idx = (size_t) itr->second;
-                res = children()[idx]->equals(s.fetch_child(itr->first));
+                res = s.children()[s_idx]->equals(*children()[(size_t)idx]);
             }
             else
             {
@@ -470,6 +575,54 @@ Schema::equals(const Schema &s) const
     return res;
 }
 
+//---------------------------------------------------------------------------//
+uint64
+Schema::hash() const
+{
+    index_t dt_id = m_dtype.id();
+    uint64 vals[6];
+    vals[0] = (uint64) dt_id;
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        // combine (name, child) pairs with a sum, so the result does
+        // not depend on the order of the children
+        uint64 accum = 0;
+        const std::vector<std::string> &names = object_order();
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            uint64 pair[2];
+            pair[0] = utils::hash64(names[i].c_str(),
+                                    (index_t)names[i].size());
+            pair[1] = children()[i]->hash();
+            accum  += utils::hash64(pair,sizeof(pair));
+        }
+        vals[1] = (uint64) names.size();
+        vals[2] = accum;
+        return utils::hash64(vals,3 * sizeof(uint64));
+    }
+    else if(dt_id == DataType::LIST_ID) 
+    {
+        const std::vector<Schema*> &lst = children();
+        std::vector<uint64> cld_vals(lst.size() + 2);
+        cld_vals[0] = (uint64) dt_id;
+        cld_vals[1] = (uint64) lst.size();
+        for(size_t i = 0; i < lst.size(); i++)
+        {
+            cld_vals[i+2] = lst[i]->hash();
+        }
+        return utils::hash64(&cld_vals[0],
+                             (index_t)(cld_vals.size() * sizeof(uint64)));
+    }
+
+    vals[1] = (uint64) m_dtype.number_of_elements();
+    vals[2] = (uint64) m_dtype.offset();
+    vals[3] = (uint64) m_dtype.stride();
+    vals[4] = (uint64) m_dtype.element_bytes();
+    vals[5] = (uint64) m_dtype.endianness();
+    return utils::hash64(vals,sizeof(vals));
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -575,6 +728,332 @@ Schema::to_json_default() const
    return to_json();
 }
 
+//-----------------------------------------------------------------------------
+//
+/// Binary transformations
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Binary schema format (version 1)
+//
+//  header (8 bytes):
+//    magic:       'C' 'S' 'C' 'B'
+//    version:     uint8 (1)
+//    endianness:  uint8 (Endianness::BIG_ID or LITTLE_ID), byte order of
+//                 the int64 values that follow
+//    reserved:    2 bytes (0)
+//
+//  name table (each object child name is stored once):
+//    int64 number of names
+//    per name: int64 length, followed by the name's chars (no terminator)
+//
+//  schema tree (depth first):
+//    int64 dtype id
+//    object: int64 number of children, 
+//            per child: int64 name table index, followed by the child tree
+//    list:   int64 number of children, followed by the child trees
+//    leaf:   int64 number of elements, offset, stride, element bytes and
+//            endianness
+//    empty:  nothing else
+//-----------------------------------------------------------------------------
+
+static const uint8   schema_binary_magic[4]   = {'C','S','C','B'};
+static const uint8   schema_binary_version    = 1;
+static const index_t schema_binary_header_len = 8;
+
+//---------------------------------------------------------------------------//
+static void
+schema_binary_append_int64(std::vector<uint8> &data,
+                           int64 val)
+{
+    size_t curr_size = data.size();
+    data.resize(curr_size + sizeof(int64));
+    memcpy(&data[curr_size],&val,sizeof(int64));
+}
+
+//---------------------------------------------------------------------------//
+static int64
+schema_binary_read_int64(const uint8 *&data,
+                         const uint8 *data_end,
+                         bool swap_bytes)
+{
+    if(data_end - data < (ptrdiff_t)sizeof(int64))
+    {
+        CONDUIT_ERROR("<Schema::from_binary> unexpected end of data");
+    }
+
+    int64 res = 0;
+    memcpy(&res,data,sizeof(int64));
+    data += sizeof(int64);
+
+    if(swap_bytes)
+    {
+        Endianness::swap64(&res);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+static void
+schema_binary_walk(const Schema &schema,
+                   std::map<std::string,int64> &name_ids,
+                   std::vector<const std::string*> &names,
+                   std::vector<uint8> &data)
+{
+    const DataType &dt = schema.dtype();
+    index_t dt_id = dt.id();
+    schema_binary_append_int64(data,dt_id);
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        const std::vector<std::string> &child_names = schema.child_names();
+        schema_binary_append_int64(data,(int64)child_names.size());
+        for(size_t i = 0; i < child_names.size(); i++)
+        {
+            // intern the name
+            std::map<std::string,int64>::iterator itr;
+            itr = name_ids.find(child_names[i]);
+            if(itr == name_ids.end())
+            {
+                itr = name_ids.insert(std::make_pair(child_names[i],
+                                             (int64)names.size())).first;
+                names.push_back(&itr->first);
+            }
+            schema_binary_append_int64(data,itr->second);
+            schema_binary_walk(schema.child((index_t)i),name_ids,names,data);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        index_t num_children = schema.number_of_children();
+        schema_binary_append_int64(data,num_children);
+        for(index_t i = 0; i < num_children; i++)
+        {
+            schema_binary_walk(schema.child(i),name_ids,names,data);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        schema_binary_append_int64(data,dt.number_of_elements());
+        schema_binary_append_int64(data,dt.offset());
+        schema_binary_append_int64(data,dt.stride());
+        schema_binary_append_int64(data,dt.element_bytes());
+        schema_binary_append_int64(data,dt.endianness());
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::to_binary(std::vector<uint8> &data) const
+{
+    std::map<std::string,int64>     name_ids;
+    std::vector<const std::string*> names;
+    std::vector<uint8>              tree;
+    schema_binary_walk(*this,name_ids,names,tree);
+
+    data.clear();
+    data.insert(data.end(),
+                schema_binary_magic,
+                schema_binary_magic + 4);
+    data.push_back(schema_binary_version);
+    data.push_back((uint8)Endianness::machine_default());
+    data.push_back(0);
+    data.push_back(0);
+
+    schema_binary_append_int64(data,(int64)names.size());
+    for(size_t i = 0; i < names.size(); i++)
+    {
+        const std::string &name = *names[i];
+        schema_binary_append_int64(data,(int64)name.size());
+        data.insert(data.end(),name.begin(),name.end());
+    }
+
+    data.insert(data.end(),tree.begin(),tree.end());
+}
+
+//---------------------------------------------------------------------------//
+bool
+Schema::is_binary(const void *data,
+                  index_t num_bytes)
+{
+    return data != NULL &&
+           num_bytes >= schema_binary_header_len &&
+           memcmp(data,schema_binary_magic,4) == 0;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::from_binary(const std::vector<uint8> &data)
+{
+    if(data.empty())
+    {
+        CONDUIT_ERROR("<Schema::from_binary> missing binary schema header");
+    }
+    from_binary(&data[0],(index_t)data.size());
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::from_binary(const void *data,
+                    index_t num_bytes)
+{
+    if(!is_binary(data,num_bytes))
+    {
+        CONDUIT_ERROR("<Schema::from_binary> missing binary schema header");
+    }
+
+    const uint8 *data_ptr = (const uint8*)data;
+    const uint8 *data_end = data_ptr + num_bytes;
+
+    if(data_ptr[4] != schema_binary_version)
+    {
+        CONDUIT_ERROR("<Schema::from_binary> unsupported binary schema "
+                      "version: " << (int)data_ptr[4]);
+    }
+
+    index_t data_endianness = (index_t)data_ptr[5];
+    if(data_endianness != Endianness::BIG_ID &&
+       data_endianness != Endianness::LITTLE_ID)
+    {
+        CONDUIT_ERROR("<Schema::from_binary> invalid binary schema "
+                      "endianness: " << data_endianness);
+    }
+    bool swap_bytes = data_endianness != Endianness::machine_default();
+
+    data_ptr += schema_binary_header_len;
+
+    int64 num_names = schema_binary_read_int64(data_ptr,
+                                               data_end,
+                                               swap_bytes);
+    // each name takes at least 8 bytes
+    if(num_names < 0 ||
+       num_names > (int64)(data_end - data_ptr) / (int64)sizeof(int64))
+    {
+        CONDUIT_ERROR("<Schema::from_binary> invalid name table size: "
+                      << num_names);
+    }
+
+    std::vector<std::string> names((size_t)num_names);
+    for(size_t i = 0; i < names.size(); i++)
+    {
+        int64 name_len = schema_binary_read_int64(data_ptr,
+                                                  data_end,
+                                                  swap_bytes);
+        if(name_len < 0 || name_len > (int64)(data_end - data_ptr))
+        {
+            CONDUIT_ERROR("<Schema::from_binary> unexpected end of data");
+        }
+        names[i].assign((const char*)data_ptr,(size_t)name_len);
+        data_ptr += name_len;
+    }
+
+    reset();
+    m_dtype.reset();
+    from_binary_walk(data_ptr,data_end,swap_bytes,names);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::from_binary_walk(const uint8 *&data,
+                         const uint8 *data_end,
+                         bool swap_bytes,
+                         const std::vector<std::string> &names)
+{
+    index_t dt_id = (index_t)schema_binary_read_int64(data,
+                                                       data_end,
+                                                       swap_bytes);
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        init_object();
+        int64 num_children = schema_binary_read_int64(data,
+                                                      data_end,
+                                                      swap_bytes);
+        // each child takes at least 16 bytes
+        if(num_children < 0 ||
+           num_children > (int64)(data_end - data) / 16)
+        {
+            CONDUIT_ERROR("<Schema::from_binary> invalid number of "
+                          "children: " << num_children);
+        }
+
+        children().reserve((size_t)num_children);
+        Schema_Object_Names &obj_names = unique_object_names();
+        obj_names.object_order.reserve((size_t)num_children);
+        for(int64 i = 0; i < num_children; i++)
+        {
+            int64 name_id = schema_binary_read_int64(data,
+                                                     data_end,
+                                                     swap_bytes);
+            if(name_id < 0 || name_id >= (int64)names.size())
+            {
+                CONDUIT_ERROR("<Schema::from_binary> invalid name index: "
+                              << name_id);
+            }
+
+            const std::string &name = names[(size_t)name_id];
+            if(find_child_index(name) >= 0)
+            {
+                CONDUIT_ERROR("<Schema::from_binary> duplicate child name: "
+                              << name);
+            }
+
+            Schema *child_schema = new Schema();
+            child_schema->m_parent = this;
+            children().push_back(child_schema);
+            obj_names.object_index.insert(name,(index_t)i);
+            obj_names.object_order.push_back(name);
+            child_schema->from_binary_walk(data,data_end,swap_bytes,names);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        init_list();
+        int64 num_children = schema_binary_read_int64(data,
+                                                      data_end,
+                                                      swap_bytes);
+        // each child takes at least 8 bytes
+        if(num_children < 0 ||
+           num_children > (int64)(data_end - data) / (int64)sizeof(int64))
+        {
+            CONDUIT_ERROR("<Schema::from_binary> invalid number of "
+                          "children: " << num_children);
+        }
+
+        children().reserve((size_t)num_children);
+        for(int64 i = 0; i < num_children; i++)
+        {
+            Schema *child_schema = new Schema();
+            child_schema->m_parent = this;
+            children().push_back(child_schema);
+            child_schema->from_binary_walk(data,data_end,swap_bytes,names);
+        }
+    }
+    else if(dt_id == DataType::EMPTY_ID)
+    {
+        m_dtype.reset();
+    }
+    else if(dt_id > DataType::EMPTY_ID && 
+            dt_id <= DataType::CHAR8_STR_ID)
+    {
+        int64 vals[5];
+        for(int i = 0; i < 5; i++)
+        {
+            vals[i] = schema_binary_read_int64(data,data_end,swap_bytes);
+        }
+        m_dtype.set(dt_id,
+                    (index_t)vals[0],
+                    (index_t)vals[1],
+                    (index_t)vals[2],
+                    (index_t)vals[3],
+                    (index_t)vals[4]);
+    }
+    else
+    {
+        CONDUIT_ERROR("<Schema::from_binary> invalid dtype id: " << dt_id);
+    }
+}
+
 //-----------------------------------------------------------------------------
 //
 /// Basic I/O methods
@@ -607,12 +1086,21 @@ void
 Schema::load(const std::string &ifname)
 {
     std::ifstream ifile;
-    ifile.open(ifname.c_str());
+    ifile.open(ifname.c_str(), std::ios::in | std::ios::binary);
     if(!ifile.is_open())
         CONDUIT_ERROR("<Schema::load> failed to open: " << ifname);
     std::string res((std::istreambuf_iterator<char>(ifile)),
                      std::istreambuf_iterator<char>());
-    set(res);
+
+    // binary schemas start with a header that can't be valid json
+    if(is_binary(res.c_str(),(index_t)res.size()))
+    {
+        from_binary(res.c_str(),(index_t)res.size());
+    }
+    else
+    {
+        set(res);
+    }
 }
 
 
@@ -685,19 +1173,18 @@ Schema::remove(index_t idx)
 
     if(dtype_id == DataType::OBJECT_ID)
     {
-        // any index above the current needs to shift down by one
-        for (size_t i = (size_t)idx; i < object_order().size(); i++)
-        {
-            object_map()[object_order()[i]]--;
-        }
-        
-        object_map().erase(object_order()[(size_t)idx]);
-        object_order().erase(object_order().begin() + (size_t)idx);
+        Schema_Object_Names &names = unique_object_names();
+        // any index above the current is shifted down by one
+        names.object_index.remove(names.object_order[(size_t)idx],
+                                  names.object_order,
+                                  true);
+        names.object_order.erase(names.object_order.begin() + (size_t)idx);
     }
 
     Schema* child = chldrn[(size_t)idx];
     delete child;
     chldrn.erase(chldrn.begin() + (size_t)idx);
+    invalidate_sizes();
 }
 
 //---------------------------------------------------------------------------//
@@ -793,14 +1280,10 @@ Schema::fetch_child(const std::string &path) const
 index_t
 Schema::child_index(const std::string &path) const
 {
-    index_t res=0;
-
-    // find p_curr with an iterator
-    std::map<std::string, index_t>::const_iterator itr;
-    itr = object_map().find(path);
+    index_t res = find_child_index(path);
 
     // error if child does not exist. 
-    if(itr == object_map().end())
+    if(res < 0)
     {
         ///
         /// TODO: Full path errors would be nice here. 
@@ -808,10 +1291,6 @@ Schema::child_index(const std::string &path) const
         CONDUIT_ERROR("<Schema::child_index[OBJECT_ID]>"
                     << "Attempt to access invalid child:" << path);
     }
-    else
-    {
-        res = itr->second;
-    }
 
     return res;
 }
@@ -859,18 +1338,18 @@ Schema::rename_child(const std::string &current_name,
                       " already exists.");
     }
 
-    std::map<std::string,index_t> &obj_map = object_map();
-    index_t idx = obj_map[current_name];
+    index_t idx = find_child_index(current_name);
+    Schema_Object_Names &names = unique_object_names();
 
     // update string to index map
 
     // remove current_name
-    obj_map.erase(current_name);
+    names.object_index.remove(current_name,names.object_order,false);
     // link new_name to the idx
-    obj_map[new_name] = idx;
+    names.object_index.insert(new_name,idx);
 
     // update index to string lookup
-    object_order()[(size_t)idx] = new_name;
+    names.object_order[(size_t)idx] = new_name;
 
     // we don't need to modify children(), we are not changing the
     // child schema 
@@ -896,16 +1375,20 @@ Schema::fetch(const std::string &path)
            return m_parent->fetch(p_next);
     }
     
-    if (!has_path(p_curr)) 
+    index_t fetch_idx = find_child_index(p_curr);
+    if(fetch_idx < 0)
     {
         Schema* my_schema = new Schema();
         my_schema->m_parent = this;
         children().push_back(my_schema);
-        object_map()[p_curr] = children().size() - 1;
-        object_order().push_back(p_curr);
+        invalidate_sizes();
+        fetch_idx = (index_t) children().size() - 1;
+        Schema_Object_Names &names = unique_object_names();
+        names.object_index.insert(p_curr,fetch_idx);
+        names.object_order.push_back(p_curr);
     }
 
-    size_t idx = (size_t) child_index(p_curr);
+    size_t idx = (size_t) fetch_idx;
     if(p_next.empty())
     {
         return *children()[idx];
@@ -1026,16 +1509,7 @@ Schema::has_child(const std::string &name) const
     if(m_dtype.id() != DataType::OBJECT_ID)
         return false;
 
-    const std::map<std::string,index_t> &ents = object_map();
-
-    if(ents.find(name) == ents.end())
-    {
-        return false;
-    }
-    else
-    {
-        return true;
-    }
+    return find_child_index(name) >= 0;
 }
 
 
@@ -1053,17 +1527,16 @@ Schema::has_path(const std::string &path) const
     
     // handle parent case (..)
     
-    const std::map<std::string,index_t> &ents = object_map();
+    index_t idx = find_child_index(p_curr);
 
-    if(ents.find(p_curr) == ents.end())
+    if(idx < 0)
     {
         return false;
     }
 
     if(!p_next.empty())
     {
-        size_t idx = (size_t) ents.find(p_curr)->second;
-        return children()[idx]->has_path(p_next);
+        return children()[(size_t)idx]->has_path(p_next);
     }
     else
     {
@@ -1105,15 +1578,13 @@ Schema::remove(const std::string &path)
     }
     else
     {
-        // any index above the current needs to shift down by one
-        for (size_t i = idx; i < object_order().size(); i++)
-        {
-            object_map()[object_order()[i]]--;
-        }
-        object_map().erase(p_curr);
-        object_order().erase(object_order().begin() + idx);
+        Schema_Object_Names &names = unique_object_names();
+        // any index above the current is shifted down by one
+        names.object_index.remove(p_curr,names.object_order,true);
+        names.object_order.erase(names.object_order.begin() + idx);
         children().erase(children().begin() + idx);
         delete child;
+        invalidate_sizes();
     }    
 }
 
@@ -1125,6 +1596,7 @@ Schema::append()
     Schema *sch = new Schema();
     sch->m_parent = this;
     children().push_back(sch);
+    invalidate_sizes();
     return *sch;
 }
 
@@ -1153,13 +1625,17 @@ Schema::init_defaults()
     m_dtype  = DataType::empty();
     m_hierarchy_data = NULL;
     m_parent = NULL;
+    m_total_strided_bytes.store(0, std::memory_order_relaxed);
+    m_total_bytes_compact.store(0, std::memory_order_relaxed);
+    m_spanned_bytes.store(0, std::memory_order_relaxed);
+    m_sizes_valid.store(false, std::memory_order_relaxed);
 }
 
 //---------------------------------------------------------------------------//
 void
 Schema::init_object()
 {
-    if(dtype().id() != DataType::OBJECT_ID)
+    if(m_dtype.id() != DataType::OBJECT_ID)
     {
         reset();
         m_dtype  = DataType::object();
@@ -1167,11 +1643,28 @@ Schema::init_object()
     }
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::init_object(const Schema &names_schema)
+{
+    if(m_dtype.id() != DataType::OBJECT_ID)
+    {
+        reset();
+        m_dtype  = DataType::object();
+        m_hierarchy_data = new Schema_Object_Hierarchy(
+                                names_schema.object_hierarchy()->names);
+    }
+    else
+    {
+        share_object_names(names_schema);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Schema::init_list()
 {
-    if(dtype().id() != DataType::LIST_ID)
+    if(m_dtype.id() != DataType::LIST_ID)
     {
         reset();
         m_dtype  = DataType::list();
@@ -1184,8 +1677,8 @@ Schema::init_list()
 void
 Schema::release()
 {
-    if(dtype().id() == DataType::OBJECT_ID ||
-       dtype().id() == DataType::LIST_ID)
+    if(m_dtype.id() == DataType::OBJECT_ID ||
+       m_dtype.id() == DataType::LIST_ID)
     {
         std::vector<Schema*> &chld = children();
         for(size_t i=0; i< chld.size(); i++)
@@ -1194,11 +1687,11 @@ Schema::release()
         }
     }
     
-    if(dtype().id() == DataType::OBJECT_ID)
+    if(m_dtype.id() == DataType::OBJECT_ID)
     { 
         delete object_hierarchy();
     }
-    else if(dtype().id() == DataType::LIST_ID)
+    else if(m_dtype.id() == DataType::LIST_ID)
     { 
         delete list_hierarchy();
     }
@@ -1207,6 +1700,75 @@ Schema::release()
     m_hierarchy_data = NULL;
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::invalidate_sizes()
+{
+    // (changing a schema is not thread safe, relaxed is enough here)
+    m_sizes_valid.store(false, std::memory_order_relaxed);
+    // if an ancestor's cache is invalid, so are the caches of all of 
+    // its ancestors
+    for(Schema *s = m_parent;
+        s != NULL && s->m_sizes_valid.load(std::memory_order_relaxed);
+        s = s->m_parent)
+    {
+        s->m_sizes_valid.store(false, std::memory_order_relaxed);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::update_sizes() const
+{
+    index_t strided_bytes = 0;
+    index_t bytes_compact = 0;
+    index_t spanned = 0;
+
+    index_t dt_id = m_dtype.id();
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        const std::vector<Schema*> &lst = children();
+        for (std::vector<Schema*>::const_iterator itr = lst.begin();
+             itr < lst.end(); ++itr)
+        {
+            const Schema *cld = *itr;
+            strided_bytes += cld->total_strided_bytes();
+            bytes_compact += cld->total_bytes_compact();
+            // spanned bytes is the max of the spanned bytes of 
+            // all children
+            index_t cld_spanned = cld->spanned_bytes();
+            if(cld_spanned > spanned)
+            {
+                spanned = cld_spanned;
+            }
+        }
+    }
+    else
+    {
+        if(dt_id != DataType::EMPTY_ID)
+        {
+            strided_bytes = m_dtype.strided_bytes();
+            bytes_compact = m_dtype.bytes_compact();
+        }
+        spanned = m_dtype.spanned_bytes();
+    }
+
+    store_sizes(strided_bytes, bytes_compact, spanned);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::store_sizes(index_t strided_bytes,
+                    index_t bytes_compact,
+                    index_t spanned) const
+{
+    m_total_strided_bytes.store(strided_bytes, std::memory_order_relaxed);
+    m_total_bytes_compact.store(bytes_compact, std::memory_order_relaxed);
+    m_spanned_bytes.store(spanned, std::memory_order_relaxed);
+    // publish the sizes
+    m_sizes_valid.store(true, std::memory_order_release);
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -1225,15 +1787,21 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
     
     if(dtype_id == DataType::OBJECT_ID )
     {
-        s_dest.init_object();
+        // the compact schema has the same child names, share them
+        s_dest.init_object(*this);
+        std::vector<Schema*> &dest_children = s_dest.children();
         size_t nchildren = children().size();
+        dest_children.reserve(nchildren);
         for(size_t i=0; i < nchildren;i++)
         {
             Schema  *cld_src = children()[i];
-            Schema &cld_dest = s_dest.fetch(object_order()[i]);
-            cld_src->compact_to(cld_dest,curr_offset);
-            curr_offset += cld_dest.total_bytes_compact();
+            Schema *cld_dest = new Schema();
+            cld_dest->m_parent = &s_dest;
+            dest_children.push_back(cld_dest);
+            cld_src->compact_to(*cld_dest,curr_offset);
+            curr_offset += cld_dest->total_bytes_compact();
         }
+        s_dest.invalidate_sizes();
     }
     else if(dtype_id == DataType::LIST_ID)
     {
@@ -1252,6 +1820,7 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
         // create a compact data type
         m_dtype.compact_to(s_dest.m_dtype);
         s_dest.m_dtype.set_offset(curr_offset);
+        s_dest.invalidate_sizes();
     }
 }
 
@@ -1347,10 +1916,10 @@ Schema::children()
 }
 
 //---------------------------------------------------------------------------//
-std::map<std::string, index_t> &
-Schema::object_map()
+Schema::Schema_Object_Index &
+Schema::object_index()
 {
-    return object_hierarchy()->object_map;
+    return unique_object_names().object_index;
 }
 
 
@@ -1358,7 +1927,38 @@ Schema::object_map()
 std::vector<std::string> &
 Schema::object_order()
 {
-    return object_hierarchy()->object_order;
+    return unique_object_names().object_order;
+}
+
+//---------------------------------------------------------------------------//
+Schema::Schema_Object_Names &
+Schema::unique_object_names()
+{
+    Schema_Object_Hierarchy *obj_hier = object_hierarchy();
+    Schema_Object_Names *names = obj_hier->names;
+    if(names->use_count() > 1)
+    {
+        Schema_Object_Names *unique_names = new Schema_Object_Names();
+        unique_names->object_order = names->object_order;
+        unique_names->object_index = names->object_index;
+        names->release();
+        obj_hier->names = unique_names;
+    }
+    return *obj_hier->names;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::share_object_names(const Schema &schema)
+{
+    Schema_Object_Hierarchy *obj_hier = object_hierarchy();
+    Schema_Object_Names *names = schema.object_hierarchy()->names;
+    if(obj_hier->names != names)
+    {
+        names->acquire();
+        obj_hier->names->release();
+        obj_hier->names = names;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1376,10 +1976,18 @@ Schema::children() const
 }
 
 //---------------------------------------------------------------------------//
-const std::map<std::string, index_t> &
-Schema::object_map() const
+const Schema::Schema_Object_Index &
+Schema::object_index() const
+{
+    return object_hierarchy()->names->object_index;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::find_child_index(const std::string &name) const
 {
-    return object_hierarchy()->object_map;
+    const Schema_Object_Names *names = object_hierarchy()->names;
+    return names->object_index.find(name,names->object_order);
 }
 
 
@@ -1387,7 +1995,7 @@ Schema::object_map() const
 const std::vector<std::string> &
 Schema::object_order() const
 {
-    return object_hierarchy()->object_order;
+    return object_hierarchy()->names->object_order;
 }
 
 //---------------------------------------------------------------------------//
@@ -1407,16 +2015,241 @@ Schema::object_map_print() const
 void
 Schema::object_order_print() const
 {
-    std::map<std::string, index_t>::const_iterator itr; 
-        
-    for(itr = object_map().begin(); itr != object_map().end();itr++)
+    const std::vector<std::string> &names = object_order();
+    for(size_t i=0; i < names.size(); i++)
     {
-       std::cout << itr->first << ":" << itr->second << " ";
+       std::cout << names[i] << ":" << find_child_index(names[i]) << " ";
     }
     std::cout << std::endl;
 }
 
 
+//-----------------------------------------------------------------------------
+//
+// -- Schema_Object_Index methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Schema::Schema_Object_Index::Schema_Object_Index()
+: m_slots(),
+  m_size(0),
+  m_tombstones()
+{
+    // empty
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::Schema_Object_Index::find(const std::string &name,
+                                  const std::vector<std::string> &names) const
+{
+    if(m_size == 0)
+    {
+        return -1;
+    }
+
+    unsigned int h = utils::hash(name);
+    size_t mask = m_slots.size() - 1;
+    size_t pos  = h & mask;
+
+    // probe until we find an empty slot
+    while(m_slots[pos].id >= 0)
+    {
+        const Slot &slot = m_slots[pos];
+        if(slot.hash == h)
+        {
+            index_t idx = id_to_index(slot.id);
+            if(names[(size_t)idx] == name)
+            {
+                return idx;
+            }
+        }
+        pos = (pos + 1) & mask;
+    }
+
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Index::insert(const std::string &name,
+                                    index_t idx)
+{
+    // keep the load factor at or below 1/2, so probe runs stay short
+    if( (size_t)(m_size + 1) * 2 > m_slots.size())
+    {
+        grow();
+    }
+
+    Slot slot;
+    slot.id   = index_to_id(idx);
+    slot.hash = utils::hash(name);
+    insert_slot(slot);
+    m_size++;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Index::remove(const std::string &name,
+                                    const std::vector<std::string> &names,
+                                    bool shift)
+{
+    if(m_size == 0)
+    {
+        return;
+    }
+
+    unsigned int h = utils::hash(name);
+    size_t mask = m_slots.size() - 1;
+    size_t pos  = h & mask;
+
+    while(m_slots[pos].id >= 0 &&
+          !(m_slots[pos].hash == h && 
+            names[(size_t)id_to_index(m_slots[pos].id)] == name))
+    {
+        pos = (pos + 1) & mask;
+    }
+
+    index_t removed_id = m_slots[pos].id;
+
+    if(removed_id < 0)
+    {
+        // name is not in the index
+        return;
+    }
+
+    // backward shift deletion: move any following entries of the probe
+    // run that could live closer to their home slot into the hole
+    size_t hole = pos;
+    size_t next = (hole + 1) & mask;
+    while(m_slots[next].id >= 0)
+    {
+        size_t home = m_slots[next].hash & mask;
+        // distance from home to next vs. distance from home to hole
+        if( ((next - home) & mask) >= ((next - hole) & mask) )
+        {
+            m_slots[hole] = m_slots[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+
+    m_slots[hole].id   = -1;
+    m_slots[hole].hash = 0;
+    m_size--;
+
+    if(shift)
+    {
+        // any index above the removed index shifts down by one: record a
+        // tombstone instead of visiting every entry
+        m_tombstones.insert(std::upper_bound(m_tombstones.begin(),
+                                             m_tombstones.end(),
+                                             removed_id),
+                            removed_id);
+
+        // fold the tombstones in once there are enough of them to pay 
+        // for a pass over the slots (this keeps lookups cheap and 
+        // inserting a tombstone short)
+        if( m_tombstones.size() > 32 &&
+            (index_t)m_tombstones.size() * 32 > m_size)
+        {
+            renumber();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Index::clear()
+{
+    m_slots.clear();
+    m_size = 0;
+    m_tombstones.clear();
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::Schema_Object_Index::id_to_index(index_t id) const
+{
+    if(m_tombstones.empty())
+    {
+        return id;
+    }
+
+    // number of removed ids below this id
+    return id - (index_t)(std::lower_bound(m_tombstones.begin(),
+                                           m_tombstones.end(),
+                                           id) - m_tombstones.begin());
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::Schema_Object_Index::index_to_id(index_t idx) const
+{
+    // skip over the removed ids at or below the result
+    index_t id = idx;
+    for(size_t i = 0; i < m_tombstones.size() && m_tombstones[i] <= id; i++)
+    {
+        id++;
+    }
+    return id;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Index::renumber()
+{
+    for(size_t i = 0; i < m_slots.size(); i++)
+    {
+        if(m_slots[i].id >= 0)
+        {
+            m_slots[i].id = id_to_index(m_slots[i].id);
+        }
+    }
+    m_tombstones.clear();
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Index::insert_slot(const Slot &slot)
+{
+    size_t mask = m_slots.size() - 1;
+    size_t pos  = slot.hash & mask;
+    while(m_slots[pos].id >= 0)
+    {
+        pos = (pos + 1) & mask;
+    }
+    m_slots[pos] = slot;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Index::grow()
+{
+    Slot empty_slot;
+    empty_slot.id   = -1;
+    empty_slot.hash = 0;
+
+    size_t new_size = m_slots.size() * 2;
+    if(new_size < 8)
+    {
+        new_size = 8;
+    }
+
+    std::vector<Slot> old_slots(new_size,empty_slot);
+    old_slots.swap(m_slots);
+
+    // rehash using the cached hashes
+    for(size_t i = 0; i < old_slots.size(); i++)
+    {
+        if(old_slots[i].id >= 0)
+        {
+            insert_slot(old_slots[i]);
+        }
+    }
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
@@ -58,6 +58,7 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <atomic>
 
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
@@ -92,6 +93,7 @@ public:
     friend class Node;
     friend class NodeIterator;
     friend class NodeConstIterator;
+    friend class NodePath;
 
 //----------------------------------------------------------------------------
 //
@@ -109,6 +111,10 @@ public:
     Schema(); 
     /// schema copy constructor
     explicit Schema(const Schema &schema);
+#ifdef CONDUIT_USE_CXX11
+    /// schema move constructor (noexcept, errors terminate)
+    Schema(Schema &&schema) noexcept;
+#endif
     /// create a schema for a leaf type given a data type id
     explicit Schema(index_t dtype_id);
     /// create a schema from a DataType
@@ -123,6 +129,10 @@ public:
     /// return a schema to the default (empty) state
     void  reset();
 
+    /// exchanges the dtype and children of this schema with the passed
+    /// schema. Both schemas keep their parents, children are relinked.
+    void  swap(Schema &schema);
+
 //-----------------------------------------------------------------------------
 //
 // Schema set methods
@@ -141,6 +151,11 @@ public:
 //
 //-----------------------------------------------------------------------------
     Schema &operator=(const Schema &schema);
+#ifdef CONDUIT_USE_CXX11
+    /// move assignment (noexcept: errors, including moving a schema 
+    /// into one of its descendants, terminate)
+    Schema &operator=(Schema &&schema) noexcept;
+#endif
     Schema &operator=(index_t dtype_id);
     Schema &operator=(const DataType &dtype);
     Schema &operator=(const std::string &json_schema);
@@ -154,8 +169,10 @@ public:
     const DataType &dtype() const 
                         {return m_dtype;}
 
+    /// non-const access to the dtype clears the cached sizes of this 
+    /// schema and its ancestors, prefer set() to change a schema's dtype
     DataType       &dtype() 
-                        {return m_dtype;}
+                        {invalidate_sizes(); return m_dtype;}
 
     index_t         element_index(index_t idx) const 
                         {return m_dtype.element_index(idx);}
@@ -172,9 +189,17 @@ public:
     /// is this schema equal to given schema
     bool            equals(const Schema &s) const;
 
+    /// 64-bit (non-cryptographic) hash of this schema, including the leaf 
+    /// layouts (dtype id, number of elements, offset, stride, element
+    /// bytes, and endianness). Object children are combined independent
+    /// of their order, list children in order.
+    uint64          hash() const;
+
     /// sum of the strided bytes of all leaves
+    /// (cached, see invalidate_sizes())
     index_t         total_strided_bytes() const;
     /// sum of the bytes of the compact form of all leaves
+    /// (cached, see invalidate_sizes())
     index_t         total_bytes_compact() const;
 
 
@@ -220,6 +245,24 @@ public:
     // difficulty allocating default string parameters.
     std::string         to_json_default() const;
 
+//-----------------------------------------------------------------------------
+//
+/// Binary transformations
+//
+//-----------------------------------------------------------------------------
+    /// encodes this schema into conduit's compact binary schema format,
+    /// which is much faster to create and parse than json
+    void            to_binary(std::vector<uint8> &data) const;
+
+    /// replaces this schema with one decoded from the binary schema format
+    void            from_binary(const void *data,
+                                index_t num_bytes);
+    void            from_binary(const std::vector<uint8> &data);
+
+    /// checks if the given bytes start with a binary schema header
+    static bool     is_binary(const void *data,
+                              index_t num_bytes);
+
 //-----------------------------------------------------------------------------
 //
 /// Basic I/O methods
@@ -232,6 +275,8 @@ public:
                          const std::string &pad=" ",
                          const std::string &eoe="\n") const;
 
+    /// loads a schema saved as json or in the binary schema format
+    /// (see Node::conduit_bin_schema_path() for conduit_bin file sets)
     void            load(const std::string &stream_path);
 
 
@@ -322,9 +367,25 @@ private:
     void        init_list();
     // setup schema to represent an object
     void        init_object();
+    // setup schema to represent an object that shares the child names
+    // of the given object schema
+    void        init_object(const Schema &names_schema);
     // cleanup any allocated memory.
     void        release();
 
+    /// total_strided_bytes(), total_bytes_compact() and spanned_bytes()
+    /// are computed in one pass and cached on each schema. 
+    /// 
+    /// A schema's cache is only valid when the caches of all of its 
+    /// descendants are valid, so invalidation walks up the parent chain 
+    /// and stops at the first ancestor that is already invalid. 
+    /// Methods that change a schema's layout call invalidate_sizes().
+    void        invalidate_sizes();
+    void        update_sizes() const;
+    void        store_sizes(index_t strided_bytes,
+                            index_t bytes_compact,
+                            index_t spanned) const;
+
     /// helps with proper alloc size for:
     /// Node::set_using_schema()and Node::set_data_using_schema
     ///
@@ -344,18 +405,104 @@ private:
     void        walk_schema(const std::string &json_schema);
 //-----------------------------------------------------------------------------
 //
+// -- conduit::Schema::Schema_Object_Index --
+//
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+/// Maps child names to child indices for schemas that describe an object.
+///
+/// This is an open addressing hash table (linear probing, backward shift
+/// deletion) that stores each child's id and the hash of its name.
+/// The names themselves are only held in object_order, so the index 
+/// compares strings only when hashes match. 
+///
+/// Ids are the child indices at the time of the last renumbering. Removing
+/// a child doesn't renumber the following entries, the removed id is 
+/// recorded as a tombstone instead, and a child's index is its id minus
+/// the number of tombstones below it. Tombstones are folded into the ids
+/// once enough of them pile up, so removal is amortized O(1) for the index.
+//-----------------------------------------------------------------------------
+    class Schema_Object_Index
+    {
+    public:
+        Schema_Object_Index();
+
+        /// returns the index of the child with the given name, or -1 
+        /// if no such child exists.
+        index_t find(const std::string &name,
+                     const std::vector<std::string> &names) const;
+
+        /// adds a name that is not already in the index
+        void    insert(const std::string &name,
+                       index_t idx);
+
+        /// removes a name from the index. When shift is true, all
+        /// indices above the removed index are shifted down by one
+        /// (to mirror removing the name from object_order).
+        void    remove(const std::string &name,
+                       const std::vector<std::string> &names,
+                       bool shift);
+
+        void    clear();
+
+    private:
+        struct Slot
+        {
+            // child id, -1 for an empty slot
+            index_t      id;
+            unsigned int hash;
+        };
+
+        /// maps between ids and child indices, using the tombstones
+        index_t id_to_index(index_t id) const;
+        index_t index_to_id(index_t idx) const;
+
+        /// folds the tombstones into the ids
+        void    renumber();
+
+        void    insert_slot(const Slot &slot);
+        void    grow();
+
+        std::vector<Slot>    m_slots;
+        index_t              m_size;
+        // sorted ids of removed children, not yet folded into the ids
+        std::vector<index_t> m_tombstones;
+    };
+
+//-----------------------------------------------------------------------------
+//
 // -- conduit::Schema::Schema_Object_Hierarchy --
 //
 //-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+/// Holds the child names and name index of an object. 
+///
+/// Copies of a schema (for example, the many domains of a mesh created 
+/// with Schema::set(), Node::set() or Node::list_of()) share one 
+/// reference counted instance. Methods that change the names make a 
+/// private copy first (copy-on-write).
+//-----------------------------------------------------------------------------
+    struct Schema_Object_Names;
+
 //-----------------------------------------------------------------------------
 /// Holds hierarchy data for schemas that describe an object.
 //-----------------------------------------------------------------------------
 
     struct Schema_Object_Hierarchy 
     {
+        /// shares the given names, or creates new names when NULL
+        explicit Schema_Object_Hierarchy(
+                    Schema_Object_Names *shared_names = NULL);
+        ~Schema_Object_Hierarchy();
+
         std::vector<Schema*>            children;
-        std::vector<std::string>        object_order;
-        std::map<std::string, index_t>  object_map;
+        /// shared child names, see Schema_Object_Names
+        Schema_Object_Names            *names;
+
+    private:
+        // not copyable
+        Schema_Object_Hierarchy(const Schema_Object_Hierarchy &);
+        Schema_Object_Hierarchy &operator=(const Schema_Object_Hierarchy &);
     };
 
     // this is used to return a ref to an empty list of strings as 
@@ -381,14 +528,31 @@ private:
 //
 //-----------------------------------------------------------------------------
     // for obj and list interfaces
+    // (the non-const object_index() and object_order() make the names 
+    //  unique to this schema, use the const versions for lookups)
     std::vector<Schema*>                   &children();
-    std::map<std::string, index_t>         &object_map();
+    Schema_Object_Index                    &object_index();
     std::vector<std::string>               &object_order();
+    Schema_Object_Names                    &unique_object_names();
+    /// shares the names of the given object schema with this one
+    void                                    share_object_names(
+                                                const Schema &schema);
 
     const std::vector<Schema*>             &children()  const;    
-    const std::map<std::string, index_t>   &object_map()   const;
+    const Schema_Object_Index              &object_index() const;
     const std::vector<std::string>         &object_order() const;
 
+    /// returns the index of the named child, or -1 if it doesn't exist
+    index_t                                 find_child_index(
+                                                const std::string &name) const;
+
+    /// recursive helper for from_binary()
+    void                                   from_binary_walk(
+                                     const uint8 *&data,
+                                     const uint8 *data_end,
+                                     bool swap_bytes,
+                                     const std::vector<std::string> &names);
+
     void                                   object_map_print()   const;
     void                                   object_order_print() const;
 //-----------------------------------------------------------------------------
@@ -409,7 +573,7 @@ private:
     DataType    m_dtype;
     /// holds the schema hierarchy data.
     /// Instead of accessing this directly, use the private methods:
-    ///   children(), object_map(), object_order
+    ///   children(), object_index(), object_order
     /// concretely, this will be:
     /// - NULL for leaf type
     /// - A Schema_Object_Hierarchy instance for schemas describing an object
@@ -418,6 +582,14 @@ private:
     /// if this schema instance has a parent, this holds the pointer to that
     /// parent
     Schema     *m_parent;
+    /// cached sizes (see invalidate_sizes()). const methods fill these
+    /// lazily, so they are atomics: threads that find the cache invalid
+    /// may compute the sizes concurrently (they store the same values),
+    /// and m_sizes_valid publishes them (release store, acquire load).
+    mutable std::atomic<index_t> m_total_strided_bytes;
+    mutable std::atomic<index_t> m_total_bytes_compact;
+    mutable std::atomic<index_t> m_spanned_bytes;
+    mutable std::atomic<bool>    m_sizes_valid;
 
 
 };
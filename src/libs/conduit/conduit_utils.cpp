@@ -80,6 +80,10 @@
 #include <limits>
 #include <fstream>
 
+#ifdef CONDUIT_USE_OPENMP
+#include <omp.h>
+#endif
+
 
 // define proper path sep
 #if defined(CONDUIT_PLATFORM_WINDOWS)
@@ -92,12 +96,21 @@ static const std::string file_path_sep_string(CONDUIT_UTILS_FILE_PATH_SEPARATOR)
 
 
 //-----------------------------------------------------------------------------
-// -- libb64 includes -- 
+// -- x86 simd includes (used by the base64 codec) --
+//-----------------------------------------------------------------------------
+// the ssse3 and avx2 kernels are compiled using function target attributes
+// and selected at runtime, so no special compiler flags are required.
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define CONDUIT_UTILS_BASE64_X86
+#include <immintrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- rapidjson number formatting includes --
 //-----------------------------------------------------------------------------
-#define BUFFERSIZE 65536
-#include "b64/encode.h"
-#include "b64/decode.h"
-using namespace base64;
+#include "rapidjson/internal/dtoa.h"
+#include "rapidjson/internal/itoa.h"
 
 
 //-----------------------------------------------------------------------------
@@ -223,6 +236,326 @@ handle_error(const std::string &msg,
     conduit_on_error(msg,file,line);
 }
 
+//-----------------------------------------------------------------------------
+// Allocator registry
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Private namespace members that hold the registered allocator callbacks.
+// Entry 0 is the built-in calloc / free allocator.
+struct ConduitAllocator
+{
+    void *(*allocate)(size_t, void *);
+    void  (*release)(void *, size_t, void *);
+    void  *context;
+};
+
+//-----------------------------------------------------------------------------
+static void *
+builtin_allocate(size_t num_bytes,
+                 void * // context -- unused
+                 )
+{
+    return calloc(num_bytes,1);
+}
+
+//-----------------------------------------------------------------------------
+static void
+builtin_release(void *data_ptr,
+                size_t, // num_bytes -- unused
+                void *  // context -- unused
+                )
+{
+    free(data_ptr);
+}
+
+//-----------------------------------------------------------------------------
+static std::vector<ConduitAllocator> &
+conduit_allocators()
+{
+    static std::vector<ConduitAllocator> allocators;
+    if(allocators.empty())
+    {
+        ConduitAllocator builtin;
+        builtin.allocate = builtin_allocate;
+        builtin.release  = builtin_release;
+        builtin.context  = NULL;
+        allocators.push_back(builtin);
+    }
+    return allocators;
+}
+
+//-----------------------------------------------------------------------------
+static index_t conduit_default_allocator_id = 0;
+
+//-----------------------------------------------------------------------------
+index_t
+register_allocator(void *(*allocate)(size_t, void *),
+                   void  (*release)(void *, size_t, void *),
+                   void *context)
+{
+    if(allocate == NULL || release == NULL)
+    {
+        CONDUIT_ERROR("register_allocator: allocate and release callbacks"
+                      " must not be NULL");
+    }
+
+    ConduitAllocator alloc;
+    alloc.allocate = allocate;
+    alloc.release  = release;
+    alloc.context  = context;
+
+    std::vector<ConduitAllocator> &allocators = conduit_allocators();
+    allocators.push_back(alloc);
+    return (index_t)(allocators.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+bool
+is_allocator(index_t allocator_id)
+{
+    return allocator_id >= 0 &&
+           (size_t)allocator_id < conduit_allocators().size();
+}
+
+//-----------------------------------------------------------------------------
+void
+set_default_allocator(index_t allocator_id)
+{
+    if(!is_allocator(allocator_id))
+    {
+        CONDUIT_ERROR("set_default_allocator: invalid allocator id: "
+                      << allocator_id);
+    }
+    conduit_default_allocator_id = allocator_id;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+default_allocator()
+{
+    return conduit_default_allocator_id;
+}
+
+//-----------------------------------------------------------------------------
+void *
+allocate(index_t allocator_id,
+         size_t num_bytes)
+{
+    if(!is_allocator(allocator_id))
+    {
+        CONDUIT_ERROR("allocate: invalid allocator id: " << allocator_id);
+    }
+    const ConduitAllocator &alloc = conduit_allocators()[(size_t)allocator_id];
+    return alloc.allocate(num_bytes,alloc.context);
+}
+
+//-----------------------------------------------------------------------------
+void
+release(index_t allocator_id,
+        void *data_ptr,
+        size_t num_bytes)
+{
+    if(!is_allocator(allocator_id))
+    {
+        CONDUIT_ERROR("release: invalid allocator id: " << allocator_id);
+    }
+    const ConduitAllocator &alloc = conduit_allocators()[(size_t)allocator_id];
+    alloc.release(data_ptr,num_bytes,alloc.context);
+}
+
+//-----------------------------------------------------------------------------
+// copies at or above this many bytes are split across threads 
+// (when OpenMP support is enabled)
+//-----------------------------------------------------------------------------
+static const index_t strided_copy_parallel_min_bytes = 4 * 1024 * 1024;
+
+//-----------------------------------------------------------------------------
+// strided copy kernel for a fixed element size, the fixed size memcpy 
+// compiles to single (unaligned) loads and stores.
+//-----------------------------------------------------------------------------
+template<size_t ELE_BYTES>
+static void
+strided_copy_kernel(uint8 *dest,
+                    index_t dest_stride,
+                    const uint8 *src,
+                    index_t src_stride,
+                    index_t num_elements)
+{
+    for(index_t i=0; i < num_elements; i++)
+    {
+        memcpy(dest,src,ELE_BYTES);
+        dest += dest_stride;
+        src  += src_stride;
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+strided_copy_serial(uint8 *dest,
+                    index_t dest_stride,
+                    const uint8 *src,
+                    index_t src_stride,
+                    index_t num_elements,
+                    index_t element_bytes)
+{
+    // contiguous on both sides: one bulk copy
+    if(dest_stride == element_bytes && src_stride == element_bytes)
+    {
+        memcpy(dest,src,(size_t)(num_elements * element_bytes));
+        return;
+    }
+
+    switch(element_bytes)
+    {
+        case 1:
+            strided_copy_kernel<1>(dest,dest_stride,src,src_stride,
+                                   num_elements);
+            break;
+        case 2:
+            strided_copy_kernel<2>(dest,dest_stride,src,src_stride,
+                                   num_elements);
+            break;
+        case 4:
+            strided_copy_kernel<4>(dest,dest_stride,src,src_stride,
+                                   num_elements);
+            break;
+        case 8:
+            strided_copy_kernel<8>(dest,dest_stride,src,src_stride,
+                                   num_elements);
+            break;
+        default:
+        {
+            for(index_t i=0; i < num_elements; i++)
+            {
+                memcpy(dest,src,(size_t)element_bytes);
+                dest += dest_stride;
+                src  += src_stride;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+strided_copy(void *dest,
+             index_t dest_stride,
+             const void *src,
+             index_t src_stride,
+             index_t num_elements,
+             index_t element_bytes)
+{
+    if(num_elements <= 0 || element_bytes <= 0)
+    {
+        return;
+    }
+
+    uint8       *dest_ptr = (uint8*)dest;
+    const uint8 *src_ptr  = (const uint8*)src;
+
+#ifdef CONDUIT_USE_OPENMP
+    int num_threads = omp_get_max_threads();
+    if(num_threads > 1 &&
+       !omp_in_parallel() &&
+       num_elements * element_bytes >= strided_copy_parallel_min_bytes)
+    {
+        // split into one chunk of elements per thread
+        index_t chunk_size = (num_elements + num_threads - 1) / num_threads;
+        #pragma omp parallel for num_threads(num_threads) schedule(static)
+        for(int t=0; t < num_threads; t++)
+        {
+            index_t start = t * chunk_size;
+            index_t count = std::min(chunk_size, num_elements - start);
+            if(count > 0)
+            {
+                strided_copy_serial(dest_ptr + start * dest_stride,
+                                    dest_stride,
+                                    src_ptr + start * src_stride,
+                                    src_stride,
+                                    count,
+                                    element_bytes);
+            }
+        }
+        return;
+    }
+#endif
+
+    strided_copy_serial(dest_ptr,
+                        dest_stride,
+                        src_ptr,
+                        src_stride,
+                        num_elements,
+                        element_bytes);
+}
+
+//-----------------------------------------------------------------------------
+// memory_equals compares in blocks, so threads can stop soon after any
+// of them finds a mismatch
+static const index_t memory_equals_block_bytes = 64 * 1024;
+static const index_t memory_equals_parallel_min_bytes = 4 * 1024 * 1024;
+
+//-----------------------------------------------------------------------------
+bool
+memory_equals(const void *a,
+              const void *b,
+              index_t nbytes)
+{
+    if(nbytes <= 0 || a == b)
+    {
+        return true;
+    }
+
+    const uint8 *a_ptr = (const uint8*)a;
+    const uint8 *b_ptr = (const uint8*)b;
+
+#ifdef CONDUIT_USE_OPENMP
+    int num_threads = omp_get_max_threads();
+    if(num_threads > 1 &&
+       !omp_in_parallel() &&
+       nbytes >= memory_equals_parallel_min_bytes)
+    {
+        // split into one chunk per thread
+        index_t chunk_bytes = (nbytes + num_threads - 1) / num_threads;
+        int mismatch = 0;
+        #pragma omp parallel for num_threads(num_threads) schedule(static)
+        for(int t=0; t < num_threads; t++)
+        {
+            index_t start = t * chunk_bytes;
+            index_t end   = std::min(start + chunk_bytes, nbytes);
+            for(index_t i = start; i < end; i += memory_equals_block_bytes)
+            {
+                int found = 0;
+                #pragma omp atomic read
+                found = mismatch;
+                if(found != 0)
+                {
+                    break;
+                }
+
+                index_t count = std::min(memory_equals_block_bytes, end - i);
+                if(memcmp(a_ptr + i, b_ptr + i, (size_t)count) != 0)
+                {
+                    #pragma omp atomic write
+                    mismatch = 1;
+                    break;
+                }
+            }
+        }
+        return mismatch == 0;
+    }
+#endif
+
+    for(index_t i = 0; i < nbytes; i += memory_equals_block_bytes)
+    {
+        index_t count = std::min(memory_equals_block_bytes, nbytes - i);
+        if(memcmp(a_ptr + i, b_ptr + i, (size_t)count) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
 
 //-----------------------------------------------------------------------------
 void     
@@ -890,29 +1223,666 @@ unescape_special_chars(const std::string &input)
 }
 
 
+//-----------------------------------------------------------------------------
+// Base64 codec
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// buffers at or above this many bytes are split across threads
+// (when OpenMP support is enabled)
+//-----------------------------------------------------------------------------
+static const index_t base64_parallel_min_bytes = 4 * 1024 * 1024;
+
+static const char base64_enc_chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// maps chars to their 6 bit value, 255 for chars outside the alphabet
+static const uint8 base64_dec_table[256] =
+{
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255, 255,  63,
+     52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 255, 255, 255,
+    255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+     15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255, 255,
+    255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+     41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+};
+
+//-----------------------------------------------------------------------------
+// Block kernels
+//
+// Encode kernels process whole 3 byte groups and return the number of source
+// bytes consumed. Decode kernels process whole 4 char groups, stop at the
+// first group that contains a char outside the alphabet (padding, whitespace,
+// etc), and return the number of source chars consumed. Callers finish any
+// remainder with the scalar code.
+//-----------------------------------------------------------------------------
+typedef index_t (*base64_encode_kernel)(const uint8 *src,
+                                        index_t src_nbytes,
+                                        char *dest);
+
+typedef index_t (*base64_decode_kernel)(const char *src,
+                                        index_t src_nbytes,
+                                        uint8 *dest);
+
+//-----------------------------------------------------------------------------
+static index_t
+base64_encode_kernel_scalar(const uint8 *src,
+                            index_t src_nbytes,
+                            char *dest)
+{
+    index_t nbytes = (src_nbytes / 3) * 3;
+    for(index_t i=0; i < nbytes; i+=3)
+    {
+        uint32 v = ((uint32)src[i] << 16) |
+                   ((uint32)src[i+1] << 8) |
+                    (uint32)src[i+2];
+        dest[0] = base64_enc_chars[(v >> 18) & 0x3F];
+        dest[1] = base64_enc_chars[(v >> 12) & 0x3F];
+        dest[2] = base64_enc_chars[(v >> 6)  & 0x3F];
+        dest[3] = base64_enc_chars[v & 0x3F];
+        dest += 4;
+    }
+    return nbytes;
+}
+
+//-----------------------------------------------------------------------------
+static index_t
+base64_decode_kernel_scalar(const char *src,
+                            index_t src_nbytes,
+                            uint8 *dest)
+{
+    const uint8 *usrc = (const uint8*)src;
+    index_t nchars = (src_nbytes / 4) * 4;
+    index_t i = 0;
+    for(; i < nchars; i+=4)
+    {
+        uint32 a = base64_dec_table[usrc[i]];
+        uint32 b = base64_dec_table[usrc[i+1]];
+        uint32 c = base64_dec_table[usrc[i+2]];
+        uint32 d = base64_dec_table[usrc[i+3]];
+        // any invalid char has the high bit set
+        if( (a | b | c | d) & 0x80 )
+        {
+            break;
+        }
+        uint32 v = (a << 18) | (b << 12) | (c << 6) | d;
+        dest[0] = (uint8)(v >> 16);
+        dest[1] = (uint8)(v >> 8);
+        dest[2] = (uint8)v;
+        dest += 3;
+    }
+    return i;
+}
+
+#ifdef CONDUIT_UTILS_BASE64_X86
+
+//-----------------------------------------------------------------------------
+// The simd kernels follow the approach described by Wojciech Mula and
+// Daniel Lemire ("Faster Base64 Encoding and Decoding using AVX2
+// Instructions"). 12 (ssse3) or 24 (avx2) source bytes are shuffled so each
+// 32 bit lane holds one 3 byte group, the 6 bit values are extracted with
+// multiplies, and chars are mapped to and from values with small shuffle
+// lookup tables.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+__attribute__((target("ssse3")))
+static inline __m128i
+base64_enc_reshuffle_ssse3(__m128i in)
+{
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11,  9, 10,
+                                            7,  8,  6,  7,
+                                            4,  5,  3,  4,
+                                            1,  2,  0,  1));
+
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+    return _mm_or_si128(t1, t3);
+}
+
+//-----------------------------------------------------------------------------
+__attribute__((target("ssse3")))
+static inline __m128i
+base64_enc_translate_ssse3(__m128i in)
+{
+    const __m128i lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                      '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                      '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                      '/' - 63, 'A', 0, 0);
+
+    __m128i idx = _mm_subs_epu8(in, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), in);
+    idx = _mm_or_si128(idx, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+    return _mm_add_epi8(_mm_shuffle_epi8(lut, idx), in);
+}
+
+//-----------------------------------------------------------------------------
+__attribute__((target("ssse3")))
+static index_t
+base64_encode_kernel_ssse3(const uint8 *src,
+                           index_t src_nbytes,
+                           char *dest)
+{
+    index_t i = 0;
+    // each step loads 16 bytes and consumes 12
+    for(; i + 16 <= src_nbytes; i += 12)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i out = base64_enc_translate_ssse3(
+                                            base64_enc_reshuffle_ssse3(in));
+        _mm_storeu_si128((__m128i*)dest, out);
+        dest += 16;
+    }
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+__attribute__((target("ssse3")))
+static index_t
+base64_decode_kernel_ssse3(const char *src,
+                           index_t src_nbytes,
+                           uint8 *dest)
+{
+    const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                         0x11, 0x11, 0x11, 0x11,
+                                         0x11, 0x11, 0x13, 0x1A,
+                                         0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                         0x04, 0x08, 0x04, 0x08,
+                                         0x10, 0x10, 0x10, 0x10,
+                                         0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll = _mm_setr_epi8(0,  16,  19,   4,
+                                         -65, -65, -71, -71,
+                                           0,   0,   0,   0,
+                                           0,   0,   0,   0);
+    const __m128i mask_2f = _mm_set1_epi8(0x2f);
+    const __m128i pack_shuffle = _mm_setr_epi8( 2,  1,  0,  6,
+                                                5,  4, 10,  9,
+                                                8, 14, 13, 12,
+                                               -1, -1, -1, -1);
+    uint8 res[16];
+    index_t i = 0;
+    for(; i + 16 <= src_nbytes; i += 16)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i*)(src + i));
+
+        // validate and map chars to 6 bit values
+        const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4),
+                                                 mask_2f);
+        const __m128i lo_nibbles = _mm_and_si128(in, mask_2f);
+        const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+        const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi),
+                                            _mm_setzero_si128())) != 0xFFFF)
+        {
+            break;
+        }
+
+        const __m128i eq_2f = _mm_cmpeq_epi8(in, mask_2f);
+        const __m128i roll  = _mm_shuffle_epi8(lut_roll,
+                                               _mm_add_epi8(eq_2f,
+                                                            hi_nibbles));
+        in = _mm_add_epi8(in, roll);
+
+        // pack 4 x 6 bits into 3 bytes per 32 bit lane
+        const __m128i ab_bc = _mm_maddubs_epi16(in,
+                                                _mm_set1_epi32(0x01400140));
+        __m128i out = _mm_madd_epi16(ab_bc, _mm_set1_epi32(0x00011000));
+        out = _mm_shuffle_epi8(out, pack_shuffle);
+
+        // only 12 of the 16 bytes are valid, stage them so we never
+        // write past the decoded data
+        _mm_storeu_si128((__m128i*)res, out);
+        memcpy(dest, res, 12);
+        dest += 12;
+    }
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static index_t
+base64_encode_kernel_avx2(const uint8 *src,
+                          index_t src_nbytes,
+                          char *dest)
+{
+    const __m256i shuffle = _mm256_set_epi8(10, 11,  9, 10,
+                                             7,  8,  6,  7,
+                                             4,  5,  3,  4,
+                                             1,  2,  0,  1,
+                                            10, 11,  9, 10,
+                                             7,  8,  6,  7,
+                                             4,  5,  3,  4,
+                                             1,  2,  0,  1);
+    const __m256i lut = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                         '0' - 52, '0' - 52, '0' - 52,
+                                         '0' - 52, '0' - 52, '0' - 52,
+                                         '0' - 52, '0' - 52, '+' - 62,
+                                         '/' - 63, 'A', 0, 0,
+                                         'a' - 26, '0' - 52, '0' - 52,
+                                         '0' - 52, '0' - 52, '0' - 52,
+                                         '0' - 52, '0' - 52, '0' - 52,
+                                         '0' - 52, '0' - 52, '+' - 62,
+                                         '/' - 63, 'A', 0, 0);
+    index_t i = 0;
+    // each step loads 12 + 16 bytes and consumes 24
+    for(; i + 28 <= src_nbytes; i += 24)
+    {
+        __m256i in = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(
+                        _mm_loadu_si128((const __m128i*)(src + i))),
+                    _mm_loadu_si128((const __m128i*)(src + i + 12)),
+                    1);
+
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        const __m256i t0 = _mm256_and_si256(in,
+                                            _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0,
+                                            _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in,
+                                            _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2,
+                                            _mm256_set1_epi32(0x01000010));
+        const __m256i vals = _mm256_or_si256(t1, t3);
+
+        __m256i idx = _mm256_subs_epu8(vals, _mm256_set1_epi8(51));
+        const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), vals);
+        idx = _mm256_or_si256(idx,
+                              _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+        __m256i out = _mm256_add_epi8(_mm256_shuffle_epi8(lut, idx), vals);
+        _mm256_storeu_si256((__m256i*)dest, out);
+        dest += 32;
+    }
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static index_t
+base64_decode_kernel_avx2(const char *src,
+                          index_t src_nbytes,
+                          uint8 *dest)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1A,
+                                            0x1B, 0x1B, 0x1B, 0x1A,
+                                            0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1A,
+                                            0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(0,  16,  19,   4,
+                                            -65, -65, -71, -71,
+                                              0,   0,   0,   0,
+                                              0,   0,   0,   0,
+                                              0,  16,  19,   4,
+                                            -65, -65, -71, -71,
+                                              0,   0,   0,   0,
+                                              0,   0,   0,   0);
+    const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+    const __m256i pack_shuffle = _mm256_setr_epi8( 2,  1,  0,  6,
+                                                   5,  4, 10,  9,
+                                                   8, 14, 13, 12,
+                                                  -1, -1, -1, -1,
+                                                   2,  1,  0,  6,
+                                                   5,  4, 10,  9,
+                                                   8, 14, 13, 12,
+                                                  -1, -1, -1, -1);
+    const __m256i pack_perm = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    uint8 res[32];
+    index_t i = 0;
+    for(; i + 32 <= src_nbytes; i += 32)
+    {
+        __m256i in = _mm256_loadu_si256((const __m256i*)(src + i));
+
+        const __m256i hi_nibbles = _mm256_and_si256(
+                                                _mm256_srli_epi32(in, 4),
+                                                mask_2f);
+        const __m256i lo_nibbles = _mm256_and_si256(in, mask_2f);
+        const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+
+        if(!_mm256_testz_si256(lo, hi))
+        {
+            break;
+        }
+
+        const __m256i eq_2f = _mm256_cmpeq_epi8(in, mask_2f);
+        const __m256i roll  = _mm256_shuffle_epi8(lut_roll,
+                                                  _mm256_add_epi8(eq_2f,
+                                                                  hi_nibbles));
+        in = _mm256_add_epi8(in, roll);
+
+        const __m256i ab_bc = _mm256_maddubs_epi16(in,
+                                        _mm256_set1_epi32(0x01400140));
+        __m256i out = _mm256_madd_epi16(ab_bc,
+                                        _mm256_set1_epi32(0x00011000));
+        out = _mm256_shuffle_epi8(out, pack_shuffle);
+        // move the 12 valid bytes of each 128 bit lane together
+        out = _mm256_permutevar8x32_epi32(out, pack_perm);
+
+        _mm256_storeu_si256((__m256i*)res, out);
+        memcpy(dest, res, 24);
+        dest += 24;
+    }
+    return i;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// kernels used by the codec, and their name
+//-----------------------------------------------------------------------------
+struct Base64Kernels
+{
+    base64_encode_kernel encode;
+    base64_decode_kernel decode;
+    const char          *name;
+};
+
+//-----------------------------------------------------------------------------
+// finds the named kernels, returns false if they aren't supported by the cpu
+// we are running on
+//-----------------------------------------------------------------------------
+static bool
+base64_find_kernels(const std::string &name,
+                    Base64Kernels &res)
+{
+    if(name == "scalar")
+    {
+        res.encode = base64_encode_kernel_scalar;
+        res.decode = base64_decode_kernel_scalar;
+        res.name   = "scalar";
+        return true;
+    }
+#ifdef CONDUIT_UTILS_BASE64_X86
+    __builtin_cpu_init();
+    if(name == "avx2" && __builtin_cpu_supports("avx2"))
+    {
+        res.encode = base64_encode_kernel_avx2;
+        res.decode = base64_decode_kernel_avx2;
+        res.name   = "avx2";
+        return true;
+    }
+    if(name == "ssse3" && __builtin_cpu_supports("ssse3"))
+    {
+        res.encode = base64_encode_kernel_ssse3;
+        res.decode = base64_decode_kernel_ssse3;
+        res.name   = "ssse3";
+        return true;
+    }
+#endif
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// selects the fastest kernels supported by the cpu we are running on
+//-----------------------------------------------------------------------------
+static Base64Kernels
+base64_select_kernels()
+{
+    Base64Kernels res;
+    if(!base64_find_kernels("avx2",res) &&
+       !base64_find_kernels("ssse3",res))
+    {
+        base64_find_kernels("scalar",res);
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static Base64Kernels &
+base64_kernels()
+{
+    static Base64Kernels kernels = base64_select_kernels();
+    return kernels;
+}
+
+//-----------------------------------------------------------------------------
+bool
+base64_set_kernel(const std::string &kernel)
+{
+    if(kernel != "scalar" && kernel != "ssse3" && kernel != "avx2")
+    {
+        CONDUIT_ERROR("Unknown base64 kernel: " << kernel 
+                      << " (expected: scalar, ssse3 or avx2)");
+    }
+
+    Base64Kernels res;
+    if(!base64_find_kernels(kernel,res))
+    {
+        return false;
+    }
+
+    base64_kernels() = res;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+std::string
+base64_kernel()
+{
+    return base64_kernels().name;
+}
+
+//-----------------------------------------------------------------------------
+// encodes whole 3 byte groups, using the simd kernel first
+//-----------------------------------------------------------------------------
+static void
+base64_encode_groups(const uint8 *src,
+                     index_t src_nbytes,
+                     char *dest)
+{
+    index_t done = base64_kernels().encode(src,src_nbytes,dest);
+    base64_encode_kernel_scalar(src + done,
+                                src_nbytes - done,
+                                dest + (done / 3) * 4);
+}
+
+//-----------------------------------------------------------------------------
+// decodes whole 4 char groups up to the first invalid char, using the simd
+// kernel first. returns the number of chars consumed.
+//-----------------------------------------------------------------------------
+static index_t
+base64_decode_groups(const char *src,
+                     index_t src_nbytes,
+                     uint8 *dest)
+{
+    index_t done = base64_kernels().decode(src,src_nbytes,dest);
+    done += base64_decode_kernel_scalar(src + done,
+                                        src_nbytes - done,
+                                        dest + (done / 4) * 3);
+    return done;
+}
+
+//-----------------------------------------------------------------------------
+// decode that skips chars outside of the alphabet (padding, whitespace),
+// matching the previous libb64 based decoder. writes at most dest_nbytes, returns the bytes written.
+//-----------------------------------------------------------------------------
+static index_t
+base64_decode_tolerant(const char *src,
+                       index_t src_nbytes,
+                       uint8 *dest,
+                       index_t dest_nbytes)
+{
+    const uint8 *usrc = (const uint8*)src;
+    index_t res = 0;
+    uint32 accum = 0;
+    int    nbits = 0;
+    for(index_t i=0; i < src_nbytes && res < dest_nbytes; i++)
+    {
+        uint32 v = base64_dec_table[usrc[i]];
+        if(v & 0x80)
+        {
+            continue;
+        }
+        accum = (accum << 6) | v;
+        nbits += 6;
+        if(nbits >= 8)
+        {
+            nbits -= 8;
+            dest[res++] = (uint8)(accum >> nbits);
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static index_t
+base64_decode_bounded(const char *src,
+                      index_t src_nbytes,
+                      uint8 *dest,
+                      index_t dest_nbytes)
+{
+    // the strict (fast) path covers all but the last group, which may hold
+    // padding, and must not produce more than dest_nbytes
+    index_t strict_nbytes = (src_nbytes / 4) * 4 - 4;
+    strict_nbytes = std::min(strict_nbytes, (dest_nbytes / 3) * 4);
+
+    index_t done = 0;
+    if(strict_nbytes > 0)
+    {
+#ifdef CONDUIT_USE_OPENMP
+        int num_threads = omp_get_max_threads();
+        if(num_threads > 1 &&
+           !omp_in_parallel() &&
+           strict_nbytes >= base64_parallel_min_bytes)
+        {
+            // split into one chunk of whole groups per thread
+            index_t ngroups = strict_nbytes / 4;
+            index_t chunk_groups = (ngroups + num_threads - 1) / num_threads;
+            std::vector<index_t> chunk_done((size_t)num_threads,0);
+            #pragma omp parallel for num_threads(num_threads) schedule(static)
+            for(int t=0; t < num_threads; t++)
+            {
+                index_t start = t * chunk_groups;
+                index_t count = std::min(chunk_groups, ngroups - start);
+                if(count > 0)
+                {
+                    chunk_done[t] = base64_decode_groups(src + start * 4,
+                                                         count * 4,
+                                                         dest + start * 3);
+                }
+            }
+
+            // find how far the valid prefix extends, anything after an 
+            // invalid char is redone by the tolerant decode below
+            for(int t=0; t < num_threads; t++)
+            {
+                index_t start = t * chunk_groups;
+                index_t count = std::min(chunk_groups, ngroups - start);
+                if(count <= 0)
+                {
+                    break;
+                }
+                done += chunk_done[t];
+                if(chunk_done[t] != count * 4)
+                {
+                    break;
+                }
+            }
+        }
+        else
+#endif
+        {
+            done = base64_decode_groups(src,strict_nbytes,dest);
+        }
+    }
+
+    index_t res = (done / 4) * 3;
+    res += base64_decode_tolerant(src + done,
+                                  src_nbytes - done,
+                                  dest + res,
+                                  dest_nbytes - res);
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 void
 base64_encode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    int nbytes = (int)src_nbytes;
-    base64_encodestate enc_state;
-    base64_init_encodestate(&enc_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr       = (char*)dest;
-    memset(des_ptr,0,(size_t)base64_encode_buffer_size(src_nbytes));
-    
-    int code_len = base64_encode_block(src_ptr,
-                                       nbytes,
-                                       des_ptr,
-                                       &enc_state);
-    des_ptr += code_len;
-    code_len = base64_encode_blockend(des_ptr, &enc_state);
-    des_ptr += code_len;
+    const uint8 *src_ptr = (const uint8*)src;
+    char *des_ptr        = (char*)dest;
+
+    index_t group_nbytes = (src_nbytes / 3) * 3;
+
+#ifdef CONDUIT_USE_OPENMP
+    int num_threads = omp_get_max_threads();
+    if(num_threads > 1 &&
+       !omp_in_parallel() &&
+       group_nbytes >= base64_parallel_min_bytes)
+    {
+        // split into one chunk of whole groups per thread
+        index_t ngroups = group_nbytes / 3;
+        index_t chunk_groups = (ngroups + num_threads - 1) / num_threads;
+        #pragma omp parallel for num_threads(num_threads) schedule(static)
+        for(int t=0; t < num_threads; t++)
+        {
+            index_t start = t * chunk_groups;
+            index_t count = std::min(chunk_groups, ngroups - start);
+            if(count > 0)
+            {
+                base64_encode_groups(src_ptr + start * 3,
+                                     count * 3,
+                                     des_ptr + start * 4);
+            }
+        }
+    }
+    else
+#endif
+    {
+        base64_encode_groups(src_ptr,group_nbytes,des_ptr);
+    }
+
+    des_ptr += (group_nbytes / 3) * 4;
+
+    // remaining 1 or 2 bytes, with padding
+    index_t rem = src_nbytes - group_nbytes;
+    if(rem > 0)
+    {
+        const uint8 *tail = src_ptr + group_nbytes;
+        uint32 v = (uint32)tail[0] << 16;
+        if(rem == 2)
+        {
+            v |= (uint32)tail[1] << 8;
+        }
+        des_ptr[0] = base64_enc_chars[(v >> 18) & 0x3F];
+        des_ptr[1] = base64_enc_chars[(v >> 12) & 0x3F];
+        des_ptr[2] = rem == 2 ? base64_enc_chars[(v >> 6) & 0x3F] : '=';
+        des_ptr[3] = '=';
+        des_ptr += 4;
+    }
 
-    // for some reason libb64 adds a newline
-    des_ptr[-1] = 0;
+    // null terminate
+    des_ptr[0] = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -936,15 +1906,23 @@ base64_decode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    base64_decodestate dec_state;
-    int src_len = (int)src_nbytes;
-    base64_init_decodestate(&dec_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr = (char*)dest;
-    base64_decode_block(src_ptr,
-                        src_len,
-                        des_ptr,
-                        &dec_state);
+    base64_decode_bounded((const char*)src,
+                          src_nbytes,
+                          (uint8*)dest,
+                          base64_decode_buffer_size(src_nbytes));
+}
+
+//-----------------------------------------------------------------------------
+index_t
+base64_decode(const void *src,
+              index_t src_nbytes,
+              void *dest,
+              index_t dest_nbytes)
+{
+    return base64_decode_bounded((const char*)src,
+                                 src_nbytes,
+                                 (uint8*)dest,
+                                 dest_nbytes);
 }
 
 //-----------------------------------------------------------------------------
@@ -971,6 +1949,386 @@ float64_to_string(float64 value)
     return res;
 }
 
+//-----------------------------------------------------------------------------
+char *
+int64_to_chars(int64 value, char *buffer)
+{
+    return rapidjson::internal::i64toa(value,buffer);
+}
+
+//-----------------------------------------------------------------------------
+char *
+uint64_to_chars(uint64 value, char *buffer)
+{
+    return rapidjson::internal::u64toa(value,buffer);
+}
+
+//-----------------------------------------------------------------------------
+// helper that handles the cases shared by the float32 and float64 paths
+// (zero, inf, and nan). Returns NULL if the value needs to be formatted.
+//-----------------------------------------------------------------------------
+static char *
+special_float_to_chars(bool neg,
+                       bool zero,
+                       bool inf,
+                       bool nan,
+                       char *buffer)
+{
+    if(nan)
+    {
+        memcpy(buffer,"nan",3);
+        return buffer + 3;
+    }
+
+    if(neg)
+    {
+        *buffer++ = '-';
+    }
+
+    if(inf)
+    {
+        memcpy(buffer,"inf",3);
+        return buffer + 3;
+    }
+
+    if(zero)
+    {
+        memcpy(buffer,"0.0",3);
+        return buffer + 3;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+char *
+float64_to_chars(float64 value, char *buffer)
+{
+    uint64 bits;
+    memcpy(&bits,&value,sizeof(bits));
+
+    bool  neg    = (bits >> 63) != 0;
+    uint64 bexp  = (bits >> 52) & 0x7FF;
+    uint64 mant  = bits & 0x000FFFFFFFFFFFFFULL;
+
+    char *res = special_float_to_chars(neg,
+                                       bexp == 0 && mant == 0,
+                                       bexp == 0x7FF && mant == 0,
+                                       bexp == 0x7FF && mant != 0,
+                                       buffer);
+    if(res != NULL)
+    {
+        return res;
+    }
+
+    // non-zero finite value
+    if(neg)
+    {
+        *buffer++ = '-';
+        value = -value;
+    }
+
+    int length = 0;
+    int k = 0;
+    rapidjson::internal::Grisu2(value,buffer,&length,&k);
+    return rapidjson::internal::Prettify(buffer,length,k);
+}
+
+//-----------------------------------------------------------------------------
+char *
+float32_to_chars(float32 value, char *buffer)
+{
+    using rapidjson::internal::DiyFp;
+
+    uint32 bits;
+    memcpy(&bits,&value,sizeof(bits));
+
+    bool  neg    = (bits >> 31) != 0;
+    uint32 bexp  = (bits >> 23) & 0xFF;
+    uint32 mant  = bits & 0x007FFFFF;
+
+    char *res = special_float_to_chars(neg,
+                                       bexp == 0 && mant == 0,
+                                       bexp == 0xFF && mant == 0,
+                                       bexp == 0xFF && mant != 0,
+                                       buffer);
+    if(res != NULL)
+    {
+        return res;
+    }
+
+    if(neg)
+    {
+        *buffer++ = '-';
+    }
+
+    // Grisu2 using the float32 rounding boundaries, so we get the
+    // shortest digits that round trip as a float32 (not as a float64,
+    // which would produce things like 0.10000000149011612)
+    const uint32 hidden_bit = 0x00800000;
+    uint64 f = mant;
+    int    e = 1 - 150;
+    if(bexp != 0)
+    {
+        f += hidden_bit;
+        e  = (int)bexp - 150;
+    }
+
+    DiyFp w_p = DiyFp((f << 1) + 1, e - 1).Normalize();
+    DiyFp w_m = (f == hidden_bit && bexp > 1) ?
+                    DiyFp((f << 2) - 1, e - 2) :
+                    DiyFp((f << 1) - 1, e - 1);
+    w_m.f <<= w_m.e - w_p.e;
+    w_m.e = w_p.e;
+
+    int k = 0;
+    const DiyFp c_mk = rapidjson::internal::GetCachedPower(w_p.e,&k);
+    const DiyFp W  = DiyFp(f,e).Normalize() * c_mk;
+    DiyFp Wp = w_p * c_mk;
+    DiyFp Wm = w_m * c_mk;
+    Wm.f++;
+    Wp.f--;
+
+    int length = 0;
+    rapidjson::internal::DigitGen(W,Wp,Wp.f - Wm.f,buffer,&length,&k);
+    return rapidjson::internal::Prettify(buffer,length,k);
+}
+
+//----------------------------------------------------------------------------- 
+// 64-bit buffer hash functions
+//-----------------------------------------------------------------------------
+namespace hashing64
+{
+
+static const uint64 prime64_1 = 0x9E3779B185EBCA87ULL;
+static const uint64 prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64 prime64_3 = 0x165667B19E3779F9ULL;
+static const uint64 prime64_4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64 prime64_5 = 0x27D4EB2F165667C5ULL;
+
+// size of the staging buffer used to hash strided data
+static const index_t strided_staging_bytes = 64 * 1024;
+
+//-----------------------------------------------------------------------------
+static inline uint64
+rotl(uint64 v, int r)
+{
+    return (v << r) | (v >> (64 - r));
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+read64(const uint8 *p)
+{
+    uint64 v;
+    memcpy(&v,p,8);
+    return v;
+}
+
+//-----------------------------------------------------------------------------
+static inline uint32
+read32(const uint8 *p)
+{
+    uint32 v;
+    memcpy(&v,p,4);
+    return v;
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+round(uint64 acc, uint64 input)
+{
+    acc += input * prime64_2;
+    acc  = rotl(acc,31);
+    return acc * prime64_1;
+}
+
+//-----------------------------------------------------------------------------
+static inline uint64
+merge_round(uint64 acc, uint64 val)
+{
+    acc ^= round(0,val);
+    return acc * prime64_1 + prime64_4;
+}
+
+//-----------------------------------------------------------------------------
+// incremental hash state, so data can be fed in pieces
+//-----------------------------------------------------------------------------
+class State
+{
+public:
+    State(uint64 seed)
+    : m_seed(seed),
+      m_total_len(0),
+      m_mem_size(0)
+    {
+        m_v[0] = seed + prime64_1 + prime64_2;
+        m_v[1] = seed + prime64_2;
+        m_v[2] = seed;
+        m_v[3] = seed - prime64_1;
+    }
+
+    //-------------------------------------------------------------------------
+    void update(const uint8 *p, index_t nbytes)
+    {
+        m_total_len += (uint64)nbytes;
+        const uint8 *end = p + nbytes;
+
+        // fill partial stripe first
+        if(m_mem_size > 0)
+        {
+            index_t fill = std::min((index_t)(32 - m_mem_size), nbytes);
+            memcpy(m_mem + m_mem_size, p, (size_t)fill);
+            m_mem_size += (int)fill;
+            p += fill;
+            if(m_mem_size < 32)
+            {
+                return;
+            }
+            stripe(m_mem);
+            m_mem_size = 0;
+        }
+
+        // the four independent lanes let the compiler keep several
+        // multiplies in flight
+        while(end - p >= 32)
+        {
+            stripe(p);
+            p += 32;
+        }
+
+        if(p < end)
+        {
+            m_mem_size = (int)(end - p);
+            memcpy(m_mem, p, (size_t)m_mem_size);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    uint64 digest() const
+    {
+        uint64 h;
+        if(m_total_len >= 32)
+        {
+            h = rotl(m_v[0],1) + rotl(m_v[1],7) +
+                rotl(m_v[2],12) + rotl(m_v[3],18);
+            h = merge_round(h,m_v[0]);
+            h = merge_round(h,m_v[1]);
+            h = merge_round(h,m_v[2]);
+            h = merge_round(h,m_v[3]);
+        }
+        else
+        {
+            h = m_seed + prime64_5;
+        }
+
+        h += m_total_len;
+
+        const uint8 *p   = m_mem;
+        const uint8 *end = m_mem + m_mem_size;
+
+        while(end - p >= 8)
+        {
+            h ^= round(0,read64(p));
+            h  = rotl(h,27) * prime64_1 + prime64_4;
+            p += 8;
+        }
+
+        if(end - p >= 4)
+        {
+            h ^= (uint64)read32(p) * prime64_1;
+            h  = rotl(h,23) * prime64_2 + prime64_3;
+            p += 4;
+        }
+
+        while(p < end)
+        {
+            h ^= (uint64)(*p) * prime64_5;
+            h  = rotl(h,11) * prime64_1;
+            p++;
+        }
+
+        // final avalanche
+        h ^= h >> 33;
+        h *= prime64_2;
+        h ^= h >> 29;
+        h *= prime64_3;
+        h ^= h >> 32;
+        return h;
+    }
+
+private:
+    //-------------------------------------------------------------------------
+    void stripe(const uint8 *p)
+    {
+        m_v[0] = round(m_v[0],read64(p));
+        m_v[1] = round(m_v[1],read64(p+8));
+        m_v[2] = round(m_v[2],read64(p+16));
+        m_v[3] = round(m_v[3],read64(p+24));
+    }
+
+    uint64 m_seed;
+    uint64 m_v[4];
+    uint64 m_total_len;
+    uint8  m_mem[32];
+    int    m_mem_size;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::hashing64 --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+uint64
+hash64(const void *data,
+       index_t nbytes,
+       uint64 seed)
+{
+    hashing64::State state(seed);
+    state.update((const uint8*)data,nbytes);
+    return state.digest();
+}
+
+//-----------------------------------------------------------------------------
+uint64
+hash64_strided(const void *data,
+               index_t num_elements,
+               index_t element_bytes,
+               index_t stride,
+               uint64 seed)
+{
+    if(stride == element_bytes || num_elements <= 1)
+    {
+        return hash64(data,num_elements * element_bytes,seed);
+    }
+
+    hashing64::State state(seed);
+
+    // gather elements into a bounded staging buffer
+    index_t chunk_elements = std::max((index_t)1,
+                                      hashing64::strided_staging_bytes / 
+                                      element_bytes);
+    chunk_elements = std::min(chunk_elements,num_elements);
+
+    std::vector<uint8> staging((size_t)(chunk_elements * element_bytes));
+    const uint8 *src = (const uint8*)data;
+
+    for(index_t start = 0; start < num_elements; start += chunk_elements)
+    {
+        index_t count = std::min(chunk_elements, num_elements - start);
+        strided_copy(&staging[0],
+                     element_bytes,
+                     src + start * stride,
+                     stride,
+                     count,
+                     element_bytes);
+        state.update(&staging[0],count * element_bytes);
+    }
+
+    return state.digest();
+}
+
 //----------------------------------------------------------------------------- 
 // String hash functions
 //-----------------------------------------------------------------------------
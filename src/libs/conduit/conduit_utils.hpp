@@ -276,6 +276,78 @@ namespace utils
                                           const std::string &file,
                                           int line);
 
+//-----------------------------------------------------------------------------
+/// Allocator registry used by conduit::Node for the memory it owns.
+///
+/// An allocator is a pair of callbacks plus a user context pointer that 
+/// is passed to both callbacks (for example, the arena or pool to use):
+///
+///   void *allocate(size_t num_bytes, void *context);
+///   void  release(void *data_ptr, size_t num_bytes, void *context);
+///
+/// allocate must return zero initialized memory (like calloc). release
+/// receives the size that was passed to allocate for data_ptr, so pools
+/// and arenas don't need to track the size of each allocation.
+///
+/// register_allocator() returns an id that can be passed to
+/// Node::set_allocator() to select the allocator for a node hierarchy, or
+/// to set_default_allocator() to select the allocator used by new nodes.
+///
+/// Id 0 is the built-in allocator, which uses calloc and free.
+///
+/// Note: Registration is not thread safe, register allocators before
+/// using them.
+//-----------------------------------------------------------------------------
+    index_t CONDUIT_API register_allocator(void *(*allocate)(size_t num_bytes,
+                                                             void *context),
+                                           void  (*release)(void *data_ptr,
+                                                            size_t num_bytes,
+                                                            void *context),
+                                           void *context = NULL);
+
+    /// sets the allocator used by newly created root nodes
+    void    CONDUIT_API set_default_allocator(index_t allocator_id);
+
+    /// returns the allocator used by newly created root nodes
+    index_t CONDUIT_API default_allocator();
+
+    /// true if the given id refers to a registered allocator
+    bool    CONDUIT_API is_allocator(index_t allocator_id);
+
+    /// allocate and release memory using a registered allocator
+    CONDUIT_API void *allocate(index_t allocator_id,
+                               size_t num_bytes);
+
+    void    CONDUIT_API release(index_t allocator_id,
+                                void *data_ptr,
+                                size_t num_bytes);
+
+//-----------------------------------------------------------------------------
+/// Copies num_elements elements of element_bytes bytes each from src to 
+/// dest. Consecutive elements are src_stride bytes apart in src and 
+/// dest_stride bytes apart in dest. 
+///
+/// When both strides equal element_bytes this is a single memcpy, otherwise
+/// a copy kernel specialized for the element size is used. When conduit is
+/// built with OpenMP support, large copies are split across threads.
+//-----------------------------------------------------------------------------
+    void    CONDUIT_API strided_copy(void *dest,
+                                     index_t dest_stride,
+                                     const void *src,
+                                     index_t src_stride,
+                                     index_t num_elements,
+                                     index_t element_bytes);
+
+//-----------------------------------------------------------------------------
+/// Returns true if the first nbytes bytes of a and b are identical.
+/// 
+/// When conduit is built with OpenMP support, large buffers are compared
+/// in parallel and all threads stop once a mismatch is found.
+//-----------------------------------------------------------------------------
+    bool    CONDUIT_API memory_equals(const void *a,
+                                      const void *b,
+                                      index_t nbytes);
+
 //-----------------------------------------------------------------------------
 /// Helpers for common string splitting operations. 
 //-----------------------------------------------------------------------------
@@ -400,6 +472,18 @@ namespace utils
 
 //-----------------------------------------------------------------------------
 /// Base64 Encoding of Buffers 
+///
+/// Uses simd (ssse3 or avx2) kernels when the cpu supports them, and splits
+/// large buffers across threads when OpenMP support is enabled.
+///
+/// base64_encode() writes a null terminated string, dest must hold
+/// base64_encode_buffer_size(src_nbytes) bytes.
+///
+/// Decoding skips chars that are not part of the base64 alphabet (padding,
+/// whitespace, etc). The three argument base64_decode() requires dest to 
+/// hold base64_decode_buffer_size(src_nbytes) bytes, the four argument
+/// variant writes at most dest_nbytes and returns the number of bytes 
+/// decoded.
 //-----------------------------------------------------------------------------
     void CONDUIT_API base64_encode(const void *src,
                                    index_t src_nbytes,
@@ -414,6 +498,23 @@ namespace utils
                                    index_t src_nbytes,
                                    void *dest);
 
+    index_t CONDUIT_API base64_decode(const void *src,
+                                      index_t src_nbytes,
+                                      void *dest,
+                                      index_t dest_nbytes);
+
+//-----------------------------------------------------------------------------
+/// Selects the base64 kernels ("scalar", "ssse3" or "avx2") used by 
+/// base64_encode() and base64_decode(), for testing and benchmarking.
+/// Returns false and keeps the current kernels when the cpu doesn't support
+/// the requested ones. This is not thread safe, it must not be called while
+/// other threads encode or decode.
+//-----------------------------------------------------------------------------
+    bool CONDUIT_API base64_set_kernel(const std::string &kernel);
+
+    /// returns the name of the base64 kernels in use
+    std::string CONDUIT_API base64_kernel();
+
 //-----------------------------------------------------------------------------
      std::string CONDUIT_API json_sanitize(const std::string &json);
      
@@ -436,6 +537,22 @@ namespace utils
 //-----------------------------------------------------------------------------
     std::string CONDUIT_API float64_to_string(float64 value);
 
+//-----------------------------------------------------------------------------
+// fast number to chars helpers, used to emit json and yaml.
+//
+// These write into the passed buffer (which must have room for at least 32
+// chars, no null terminator is written) and return a pointer to the char
+// following the last char written.
+//
+// Floating point values are written using the shortest form that round
+// trips to the same value (Grisu2), with ".0" appended to integral values.
+// inf and nan are written as "inf", "-inf", and "nan".
+//-----------------------------------------------------------------------------
+    char CONDUIT_API *int64_to_chars(int64 value, char *buffer);
+    char CONDUIT_API *uint64_to_chars(uint64 value, char *buffer);
+    char CONDUIT_API *float32_to_chars(float32 value, char *buffer);
+    char CONDUIT_API *float64_to_chars(float64 value, char *buffer);
+
 //-----------------------------------------------------------------------------
      void CONDUIT_API indent(std::ostream &os,
                              index_t indent,
@@ -456,6 +573,22 @@ namespace utils
      unsigned int CONDUIT_API hash(const std::string &k, 
                                    unsigned int initval = 0);
 
+//----------------------------------------------------------------------------- 
+// Fast 64-bit (non-cryptographic) hash functions for buffers
+// (these implement the XXH64 algorithm)
+//----------------------------------------------------------------------------- 
+     uint64 CONDUIT_API hash64(const void *data,
+                               index_t nbytes,
+                               uint64 seed = 0);
+
+     // hashes strided elements in element order, the result matches
+     // hash64() of the compact (contiguous) elements
+     uint64 CONDUIT_API hash64_strided(const void *data,
+                                       index_t num_elements,
+                                       index_t element_bytes,
+                                       index_t stride,
+                                       uint64 seed = 0);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::utils --
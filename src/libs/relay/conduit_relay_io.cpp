@@ -320,26 +320,27 @@ save(const Node &node,
        protocol == "conduit_base64_json" ||
        protocol == "yaml" )
     {
-        node.save(path,protocol);
+        // conduit_bin options select the schema format
+        if(protocol == "conduit_bin" && options.has_child("conduit_bin"))
+        {
+            node.save(path,protocol,options["conduit_bin"]);
+        }
+        else
+        {
+            node.save(path,protocol);
+        }
     }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        // hdf5 is the only protocol that currently takes "options"
-        Node prev_options;
         if(options.has_child("hdf5"))
         {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
+            hdf5_save(node,path,options["hdf5"]);
         }
-
-        hdf5_save(node,path);
-
-        if(!prev_options.dtype().is_empty())
+        else
         {
-            hdf5_set_options(prev_options);
+            hdf5_save(node,path);
         }
-
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " << 
                       "Failed to save conduit node to path " << path);
@@ -438,18 +439,13 @@ save_merged(const Node &node,
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
         // hdf5 is the only protocol that currently takes "options"
-        Node prev_options;
         if(options.has_child("hdf5"))
         {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
+            hdf5_append(node,path,options["hdf5"]);
         }
-        
-        hdf5_append(node,path);
-        
-        if(!prev_options.dtype().is_empty())
+        else
         {
-            hdf5_set_options(prev_options);
+            hdf5_append(node,path);
         }
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " << 
@@ -623,6 +619,64 @@ load(const std::string &path,
     load(path, protocol, 0, 0, options, node);
 }
 
+//---------------------------------------------------------------------------//
+void
+load_schema(const std::string &path,
+            Schema &schema)
+{
+    std::string protocol;
+    identify_protocol(path,protocol);
+    load_schema(path,protocol,schema);
+}
+
+//---------------------------------------------------------------------------//
+void
+load_schema(const std::string &path,
+            const std::string &protocol_,
+            Schema &schema)
+{
+    std::string protocol = protocol_;
+    // allow empty protocol to be used for auto detect
+    if(protocol.empty())
+    {
+        identify_protocol(path,protocol);
+    }
+
+    if(protocol == "conduit_bin")
+    {
+        // the schema is stored in its own file, as json or binary
+        Schema s_res;
+        s_res.load(Node::conduit_bin_schema_path(path));
+        schema.reset();
+        s_res.compact_to(schema);
+    }
+    else if(protocol == "json" ||
+            protocol == "conduit_json" ||
+            protocol == "conduit_base64_json" ||
+            protocol == "yaml" )
+    {
+        // text files hold the data inline, they need to be parsed
+        Node n;
+        n.load(path,protocol);
+        schema.reset();
+        n.schema().compact_to(schema);
+    }
+    else if( protocol == "hdf5")
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        hdf5_read_schema(path,schema);
+#else
+        CONDUIT_ERROR("conduit_relay lacks HDF5 support: " << 
+                      "Failed to load schema from path " << path);
+#endif
+    }
+    else
+    {
+        CONDUIT_ERROR("conduit_relay protocol " << protocol 
+                      << " does not support \"load_schema\"");
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 load_merged(const std::string &path,
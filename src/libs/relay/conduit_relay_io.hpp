@@ -97,6 +97,9 @@ void CONDUIT_RELAY_API finalize();
 ///
 /// ``save`` works like a 'set' to the file.
 ///
+/// options["conduit_bin/schema_format"] selects "json" (default) or 
+/// "binary" schema files for conduit_bin (see Node::save()).
+///
 
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API save(const Node &node,
@@ -187,6 +190,22 @@ void CONDUIT_RELAY_API load(const std::string &path,
                             const Node &options,
                             Node &node);
 
+///
+/// ``load_schema`` reads the (compact) schema of the data at path, 
+///  without reading the data itself. Supported for conduit_bin, hdf5 and
+///  the text protocols (json, yaml, etc). Text files hold their data 
+///  inline, so they are still parsed in full.
+///
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API load_schema(const std::string &path,
+                                   Schema &schema);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API load_schema(const std::string &path,
+                                   const std::string &protocol,
+                                   Schema &schema);
+
 ///
 /// ``load_merged`` works like an update, for the object case, entries are read
 ///  into the node. If the node is already in the OBJECT_T role, children are 
@@ -65,6 +65,7 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <fstream>
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -114,14 +115,27 @@ public:
     virtual void read(Node &node) = 0;
     virtual void read(const std::string &path,
                       Node &node) = 0;
+    virtual void read(Node &node,
+                      const Node &opts) = 0;
+    virtual void read(const std::string &path,
+                      Node &node,
+                      const Node &opts) = 0;
     virtual void write(const Node &node) = 0;
     virtual void write(const Node &node,
                const std::string &path) = 0;
+    virtual void write(const Node &node,
+                       const Node &opts) = 0;
+    virtual void write(const Node &node,
+                       const std::string &path,
+                       const Node &opts) = 0;
     virtual void list_child_names(std::vector<std::string> &res) const = 0;
     virtual void list_child_names(const std::string &path,
                           std::vector<std::string> &res) const = 0;
     virtual void remove(const std::string &path) = 0;
     virtual bool has_path(const std::string &path) const = 0;
+    virtual void read_schema(Schema &schema) = 0;
+    virtual void read_schema(const std::string &path,
+                             Schema &schema) = 0;
     virtual void close() = 0;
 
     // factory helper methods used by interface class 
@@ -166,10 +180,20 @@ public:
     void read(Node &node);
     void read(const std::string &path,
               Node &node);
+    void read(Node &node,
+              const Node &opts);
+    void read(const std::string &path,
+              Node &node,
+              const Node &opts);
 
     void write(const Node &node);
     void write(const Node &node,
                const std::string &path);
+    void write(const Node &node,
+               const Node &opts);
+    void write(const Node &node,
+               const std::string &path,
+               const Node &opts);
 
     void remove(const std::string &path);
 
@@ -178,13 +202,32 @@ public:
                           std::vector<std::string> &res) const;
 
     bool has_path(const std::string &path) const;
+
+    void read_schema(Schema &schema);
+    void read_schema(const std::string &path,
+                     Schema &schema);
     
     void close();
     
 private:
+    // hyperslab options are only supported by hdf5 handles
+    void check_hyperslab_options(const Node &opts);
+
+    // lazy conduit_bin helpers
+    void open_lazy();
+    void load_leaves(const Schema &schema,
+                     Node &node);
+    void load_all();
+
     Node m_node;
     bool m_open;
 
+    // conduit_bin files are read lazily: open() only reads the schema, 
+    // and leaves are read from the file when first requested.
+    // m_lazy is true until the handle is modified
+    bool          m_lazy;
+    Schema        m_schema;
+    std::ifstream m_ifs;
 };
 
 
@@ -209,10 +252,20 @@ public:
     void read(Node &node);
     void read(const std::string &path,
               Node &node);
+    void read(Node &node,
+              const Node &opts);
+    void read(const std::string &path,
+              Node &node,
+              const Node &opts);
 
     void write(const Node &node);
     void write(const Node &node,
                const std::string &path);
+    void write(const Node &node,
+               const Node &opts);
+    void write(const Node &node,
+               const std::string &path,
+               const Node &opts);
 
     void remove(const std::string &path);
 
@@ -221,10 +274,18 @@ public:
                           std::vector<std::string> &res) const;
 
     bool has_path(const std::string &path) const;
+
+    void read_schema(Schema &schema);
+    void read_schema(const std::string &path,
+                     Schema &schema);
     
     void close();
     
 private:
+    // combines the handle's hdf5 options with the given write options
+    void write_options(const Node &opts,
+                       Node &res);
+
     hid_t m_h5_id;
     
 };
@@ -365,7 +426,10 @@ BasicHandle::BasicHandle(const std::string &path,
                          const Node &options)
 : HandleInterface(path,protocol,options),
   m_node(),
-  m_open(false)
+  m_open(false),
+  m_lazy(false),
+  m_schema(),
+  m_ifs()
 {
     // empty
 }
@@ -385,7 +449,16 @@ BasicHandle::open()
 
     // read from file if it already exists, other wise
     // we start out with a blank slate
-    if( utils::is_file( path() ) )
+    // (conduit_bin schemas are saved as <path>_json or <path>_schema_bin)
+    if( protocol() == "conduit_bin" &&
+        utils::is_file( path() ) &&
+        ( utils::is_file( path() + "_json" ) ||
+          utils::is_file( path() + "_schema_bin" ) ) )
+    {
+        // only read the schema, data is read on demand
+        open_lazy();
+    }
+    else if( utils::is_file( path() ) )
     {
         // read from file 
         io::load(path(),
@@ -415,6 +488,10 @@ BasicHandle::is_open() const
 void 
 BasicHandle::read(Node &node)
 {
+    if(m_lazy)
+    {
+        load_leaves(m_schema,m_node);
+    }
     node.update(m_node);
 }
 
@@ -425,14 +502,39 @@ BasicHandle::read(const std::string &path,
 {
     if(m_node.has_path(path))
     {
+        if(m_lazy)
+        {
+            load_leaves(m_schema.fetch_child(path),
+                        m_node.fetch_child(path));
+        }
         node.update(m_node[path]);
     }
 }
 
+//-----------------------------------------------------------------------------
+void 
+BasicHandle::read(Node &node,
+                  const Node &opts)
+{
+    check_hyperslab_options(opts);
+    read(node);
+}
+
+//-----------------------------------------------------------------------------
+void 
+BasicHandle::read(const std::string &path,
+                  Node &node,
+                  const Node &opts)
+{
+    check_hyperslab_options(opts);
+    read(path,node);
+}
+
 //-----------------------------------------------------------------------------
 void 
 BasicHandle::write(const Node &node)
 {
+    load_all();
     m_node.update(node);
 }
 
@@ -442,9 +544,29 @@ void
 BasicHandle::write(const Node &node,
                    const std::string &path)
 {
+    load_all();
     m_node[path].update(node);
 }
 
+//-----------------------------------------------------------------------------
+void 
+BasicHandle::write(const Node &node,
+                   const Node &opts)
+{
+    check_hyperslab_options(opts);
+    write(node);
+}
+
+//-----------------------------------------------------------------------------
+void 
+BasicHandle::write(const Node &node,
+                   const std::string &path,
+                   const Node &opts)
+{
+    check_hyperslab_options(opts);
+    write(node,path);
+}
+
 //-----------------------------------------------------------------------------
 void
 BasicHandle::list_child_names(std::vector<std::string> &res) const
@@ -466,6 +588,7 @@ BasicHandle::list_child_names(const std::string &path,
 void 
 BasicHandle::remove(const std::string &path)
 {
+    load_all();
     m_node.remove(path);
 }
 
@@ -476,22 +599,188 @@ BasicHandle::has_path(const std::string &path) const
     return m_node.has_path(path);
 }
 
+//-----------------------------------------------------------------------------
+void
+BasicHandle::read_schema(Schema &schema)
+{
+    schema.reset();
+    // for lazy conduit_bin handles, no leaves need to be read
+    if(m_lazy)
+    {
+        m_schema.compact_to(schema);
+    }
+    else
+    {
+        m_node.schema().compact_to(schema);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+BasicHandle::read_schema(const std::string &path,
+                         Schema &schema)
+{
+    if(!m_node.has_path(path))
+    {
+        CONDUIT_ERROR("Cannot read schema, path does not exist: " << path);
+    }
+
+    schema.reset();
+    if(m_lazy)
+    {
+        m_schema.fetch_child(path).compact_to(schema);
+    }
+    else
+    {
+        m_node.fetch_child(path).schema().compact_to(schema);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void 
 BasicHandle::close()
 {
     if(m_open)
     {
-        // here is where it actually gets realized on disk
-        io::save(m_node,
-                 path(),
-                 protocol(),
-                 options());
+        // a lazy handle was never modified, so there is nothing to save
+        if(m_lazy)
+        {
+            m_ifs.close();
+            m_schema.reset();
+            m_lazy = false;
+        }
+        else
+        {
+            // here is where it actually gets realized on disk
+            io::save(m_node,
+                     path(),
+                     protocol(),
+                     options());
+        }
         m_node.reset();
         m_open = false;
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+BasicHandle::check_hyperslab_options(const Node &opts)
+{
+    if( opts.has_child("offset") ||
+        opts.has_child("stride") ||
+        opts.has_child("count")  ||
+        opts.has_child("dims") )
+    {
+        CONDUIT_ERROR("IOHandle: hyperslab options (offset, stride, "
+                      "count, dims) are not supported for protocol: " 
+                      << protocol());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+BasicHandle::open_lazy()
+{
+    m_schema.load(Node::conduit_bin_schema_path(path()));
+
+    m_ifs.open(path().c_str(), std::ios::in | std::ios::binary);
+    if(!m_ifs.is_open())
+    {
+        CONDUIT_ERROR("<BasicHandle::open> failed to open: " << path());
+    }
+
+    // create the tree structure without data, empty leaves mark data 
+    // that has not been read yet
+    m_node.reset();
+    std::vector<const Schema*> schemas(1,&m_schema);
+    std::vector<Node*>         nodes(1,&m_node);
+    while(!schemas.empty())
+    {
+        const Schema *s = schemas.back();
+        Node *n = nodes.back();
+        schemas.pop_back();
+        nodes.pop_back();
+
+        index_t dt_id = s->dtype().id();
+        if(dt_id == DataType::OBJECT_ID)
+        {
+            n->set_dtype(DataType::object());
+            const std::vector<std::string> &names = s->child_names();
+            for(size_t i = 0; i < names.size(); i++)
+            {
+                schemas.push_back(s->child_ptr((index_t)i));
+                nodes.push_back(&n->fetch(names[i]));
+            }
+        }
+        else if(dt_id == DataType::LIST_ID)
+        {
+            n->set_dtype(DataType::list());
+            index_t num_children = s->number_of_children();
+            for(index_t i = 0; i < num_children; i++)
+            {
+                schemas.push_back(s->child_ptr(i));
+                nodes.push_back(&n->append());
+            }
+        }
+    }
+
+    m_lazy = true;
+}
+
+//-----------------------------------------------------------------------------
+void
+BasicHandle::load_leaves(const Schema &schema,
+                         Node &node)
+{
+    index_t dt_id = schema.dtype().id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t num_children = schema.number_of_children();
+        for(index_t i = 0; i < num_children; i++)
+        {
+            load_leaves(schema.child(i),node.child(i));
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID &&
+            node.dtype().is_empty())
+    {
+        // read the leaf's bytes from its offset in the file
+        const DataType &file_dt = schema.dtype();
+        DataType dt(file_dt);
+        dt.set_offset(0);
+        node.set(dt);
+
+        if(dt.number_of_elements() > 0)
+        {
+            m_ifs.seekg((std::streamoff)file_dt.offset());
+            m_ifs.read((char*)node.data_ptr(),
+                       (std::streamsize)dt.spanned_bytes());
+            if(!m_ifs)
+            {
+                CONDUIT_ERROR("<BasicHandle::read> failed to read "
+                              << dt.spanned_bytes() << " bytes at offset "
+                              << file_dt.offset() << " from: " << path());
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+BasicHandle::load_all()
+{
+    // the handle is about to be modified, read everything so we can
+    // save the complete tree on close
+    if(m_lazy)
+    {
+        load_leaves(m_schema,m_node);
+        m_ifs.close();
+        m_schema.reset();
+        m_lazy = false;
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 // HDF5Handle Implementation 
@@ -558,47 +847,104 @@ HDF5Handle::read(const std::string &path,
     hdf5_read(m_h5_id,path,node);
 }
 
+//-----------------------------------------------------------------------------
+void 
+HDF5Handle::read(Node &node,
+                 const Node &opts)
+{
+    hdf5_read(m_h5_id,opts,node);
+}
+
+//-----------------------------------------------------------------------------
+void 
+HDF5Handle::read(const std::string &path,
+                 Node &node,
+                 const Node &opts)
+{
+    hdf5_read(m_h5_id,path,opts,node);
+}
+
 //-----------------------------------------------------------------------------
 void 
 HDF5Handle::write(const Node &node)
 {
-    // Options Push / Pop (only needed for write, since hdf5 only supports
-    // write options
-    Node prev_options;
+    // the handle's options are passed to each write, so handles with 
+    // different options can be used at the same time
     if(options().has_child("hdf5"))
     {
-        hdf5_options(prev_options);
-        hdf5_set_options(options()["hdf5"]);
+        hdf5_write(node,m_h5_id,options()["hdf5"]);
     }
+    else
+    {
+        hdf5_write(node,m_h5_id);
+    }
+}
 
-    hdf5_write(node,m_h5_id);
 
-    if(!prev_options.dtype().is_empty())
+//-----------------------------------------------------------------------------
+void 
+HDF5Handle::write(const Node &node,
+                  const std::string &path)
+{
+    if(options().has_child("hdf5"))
     {
-        hdf5_set_options(prev_options);
+        hdf5_write(node,m_h5_id,path,options()["hdf5"]);
+    }
+    else
+    {
+        hdf5_write(node,m_h5_id,path);
     }
 }
 
+//-----------------------------------------------------------------------------
+void 
+HDF5Handle::write(const Node &node,
+                  const Node &opts)
+{
+    Node h5_opts;
+    write_options(opts,h5_opts);
+    hdf5_write(node,m_h5_id,h5_opts);
+}
 
 //-----------------------------------------------------------------------------
 void 
 HDF5Handle::write(const Node &node,
-                  const std::string &path)
+                  const std::string &path,
+                  const Node &opts)
+{
+    Node h5_opts;
+    write_options(opts,h5_opts);
+    hdf5_write(node,m_h5_id,path,h5_opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::write_options(const Node &opts,
+                          Node &res)
 {
-    // Options Push / Pop (only needed for write, since hdf5 only supports
-    // write options
-    Node prev_options;
+    res.reset();
     if(options().has_child("hdf5"))
     {
-        hdf5_options(prev_options);
-        hdf5_set_options(options()["hdf5"]);
+        res.set(options()["hdf5"]);
     }
 
-    hdf5_write(node,m_h5_id,path);
-    
-    if(!prev_options.dtype().is_empty())
+    // the write's options win, its overrides follow the handle's overrides
+    NodeConstIterator itr = opts.children();
+    while(itr.has_next())
     {
-        hdf5_set_options(prev_options);
+        const Node &opt = itr.next();
+        if(itr.name() == "overrides")
+        {
+            NodeConstIterator ovr_itr = opt.children();
+            while(ovr_itr.has_next())
+            {
+                res["overrides"].append().set(ovr_itr.next());
+            }
+        }
+        else
+        {
+            res[itr.name()].update(opt);
+        }
     }
 }
 
@@ -631,6 +977,21 @@ HDF5Handle::has_path(const std::string &path) const
     return hdf5_has_path(m_h5_id,path);
 }
 
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read_schema(Schema &schema)
+{
+    hdf5_read_schema(m_h5_id,schema);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read_schema(const std::string &path,
+                        Schema &schema)
+{
+    hdf5_read_schema(m_h5_id,path,schema);
+}
+
 
 //-----------------------------------------------------------------------------
 void 
@@ -751,6 +1112,37 @@ IOHandle::read(const std::string &path,
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+IOHandle::read(Node &node,
+               const Node &opts)
+{
+    if(m_handle != NULL)
+    {
+        m_handle->read(node, opts);
+    }
+    else
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::read(const std::string &path,
+               Node &node,
+               const Node &opts)
+{
+    if(m_handle != NULL)
+    {
+        m_handle->read(path, node, opts);
+    }
+    else
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 IOHandle::write(const Node &node)
@@ -781,6 +1173,37 @@ IOHandle::write(const Node &node,
     
 }
 
+//-----------------------------------------------------------------------------
+void
+IOHandle::write(const Node &node,
+                const Node &opts)
+{
+    if(m_handle != NULL)
+    {
+        m_handle->write(node, opts);
+    }
+    else
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::write(const Node &node,
+                const std::string &path,
+                const Node &opts)
+{
+    if(m_handle != NULL)
+    {
+        m_handle->write(node, path, opts);
+    }
+    else
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 IOHandle::remove(const std::string &path)
@@ -843,6 +1266,35 @@ IOHandle::has_path(const std::string &path) const
     return false;
 }
 
+//-----------------------------------------------------------------------------
+void
+IOHandle::read_schema(Schema &schema)
+{
+    if(m_handle != NULL)
+    {
+        m_handle->read_schema(schema);
+    }
+    else
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::read_schema(const std::string &path,
+                      Schema &schema)
+{
+    if(m_handle != NULL)
+    {
+        m_handle->read_schema(path,schema);
+    }
+    else
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 IOHandle::close()
@@ -86,20 +86,39 @@ public:
     void read(const std::string &path,
               Node &node);
 
+    /// read variants that accept read options
+    ///
+    /// hdf5 handles support hyperslab reads, using the "offset", "stride"
+    /// and "count" options (see relay::io::hdf5_read)
+    void read(Node &node,
+              const Node &opts);
+    void read(const std::string &path,
+              Node &node,
+              const Node &opts);
+
     /// write contents of passed node to the root of the handle
     void write(const Node &node);
     /// write contents of passed node to given subpath
     void write(const Node &node,
                const std::string &path);
 
+    /// write variants that accept write options
+    ///
+    /// hdf5 handles support hyperslab writes into new or existing 
+    /// datasets, using the "offset", "stride", "count" and "dims" options
+    /// (see relay::io::hdf5_write)
+    void write(const Node &node,
+               const Node &opts);
+    void write(const Node &node,
+               const std::string &path,
+               const Node &opts);
+
     /// list child names at root of handle
     void list_child_names(std::vector<std::string> &res) const;
     /// list child names at subpath
     void list_child_names(const std::string &path,
                           std::vector<std::string> &res) const;
 
-    // TODO: options variants for read and write above? with update of 
-    // above options with passed?
 
     /// remove contents at given path
     void remove(const std::string &path);
@@ -107,10 +126,14 @@ public:
     /// check if given path exists
     bool has_path(const std::string &path) const;
 
-    // FUTURE: also provide access to read schema
-    // void read_schema(Schema &schema);
-    // void read_schema(const std::string &path,
-    //                  Schema &schema);
+    /// read the schema of the contents at the root of the handle
+    ///
+    /// only metadata is read: for conduit_bin this is the schema file, 
+    /// for hdf5 the dataset types and dataspaces. the result is compact.
+    void read_schema(Schema &schema);
+    /// read the schema of the contents at given subpath
+    void read_schema(const std::string &path,
+                     Schema &schema);
 
     /// close the handle
     void close();
@@ -58,6 +58,7 @@
 // standard lib includes
 //-----------------------------------------------------------------------------
 #include <iostream>
+#include <mutex>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -164,28 +165,58 @@ namespace io
 //-----------------------------------------------------------------------------
 // Private class used to hold options that control hdf5 i/o params.
 // 
-// These values are read by about(), and are set by io::hdf5_set_options()
-// 
-//
+// The process wide defaults are read by about(), and are set by 
+// io::hdf5_set_options(). Each write starts from a copy of the defaults 
+// and applies the options passed to the write call, so writes never 
+// modify the defaults. The defaults are only accessed under a mutex, so 
+// hdf5_set_options() can be called while other threads write.
 //-----------------------------------------------------------------------------
 
 class HDF5Options
 {
 public:
-    static bool chunking_enabled;
-    static int  chunk_threshold;
-    static int  chunk_size;
+    bool chunking_enabled;
+    int  chunk_threshold;
+    int  chunk_size;
 
-    static bool compact_storage_enabled;
-    static int  compact_storage_threshold;
+    bool compact_storage_enabled;
+    int  compact_storage_threshold;
 
-    static std::string compression_method;
-    static int         compression_level;
+    std::string compression_method;
+    int         compression_level;
 
 public:
-    
+
+    //------------------------------------------------------------------------
+    // default hdf5 i/o settings
+    HDF5Options()
+    : chunking_enabled(true),
+      chunk_threshold(2000000), // 2 mb
+      chunk_size(1000000),      // 1 mb
+      compact_storage_enabled(true),
+      compact_storage_threshold(1024),
+      compression_method("gzip"),
+      compression_level(5)
+    {}
+
+    //------------------------------------------------------------------------
+    // returns a copy of the process wide defaults
+    static HDF5Options defaults()
+    {
+        std::lock_guard<std::mutex> lock(defaults_mutex());
+        return defaults_storage();
+    }
+
+    //------------------------------------------------------------------------
+    // applies opts to the process wide defaults
+    static void set_defaults(const Node &opts)
+    {
+        std::lock_guard<std::mutex> lock(defaults_mutex());
+        defaults_storage().set(opts);
+    }
+
     //------------------------------------------------------------------------
-    static void set(const Node &opts)
+    void set(const Node &opts)
     {
         
         if(opts.has_child("compact_storage"))
@@ -256,7 +287,7 @@ public:
     }
 
     //------------------------------------------------------------------------
-    static void about(Node &opts)
+    void about(Node &opts) const
     {
         opts.reset();
 
@@ -289,35 +320,164 @@ public:
             opts["chunking/compression/level"] = compression_level;
         }
     }
+
+private:
+    //------------------------------------------------------------------------
+    static HDF5Options &defaults_storage()
+    {
+        static HDF5Options opts;
+        return opts;
+    }
+
+    //------------------------------------------------------------------------
+    static std::mutex &defaults_mutex()
+    {
+        static std::mutex mtx;
+        return mtx;
+    }
 };
 
-// default hdf5 i/o settings
+//-----------------------------------------------------------------------------
+// Private class that holds the options for one write call.
+//
+// The defaults and the call's options are combined once, when the write 
+// starts. The "overrides" entries then pick the options used for the 
+// datasets in a subtree:
+//
+//   overrides:
+//     - path: "fields"
+//       chunking: 
+//         compression:
+//           method: "gzip"
+//     - path: "topologies/*/elements/connectivity"
+//       chunking:
+//         compression:
+//           method: "none"
+//
+// An override path is relative to the node being written, "*" matches any
+// name, and an override applies to every dataset under its path. When 
+// several overrides apply, later entries win.
+//-----------------------------------------------------------------------------
+class HDF5WriteOptions
+{
+public:
+    //------------------------------------------------------------------------
+    HDF5WriteOptions(const Node &opts,
+                     const std::string &root_path)
+    : m_opts(opts),
+      m_settings(HDF5Options::defaults()),
+      m_root_size(0)
+    {
+        m_settings.set(opts);
+
+        std::vector<std::string> root_names;
+        split_names(root_path,root_names);
+        m_root_size = root_names.size();
+
+        if(!opts.has_child("overrides"))
+        {
+            return;
+        }
+
+        NodeConstIterator itr = opts["overrides"].children();
+        while(itr.has_next())
+        {
+            const Node &ovr = itr.next();
+            if(!ovr.has_child("path") || !ovr["path"].dtype().is_string())
+            {
+                CONDUIT_ERROR("HDF5 write option \"overrides\" entries "
+                              "require a string \"path\"");
+            }
+
+            m_override_paths.push_back(std::vector<std::string>());
+            split_names(ovr["path"].as_string(),m_override_paths.back());
+            m_override_opts.push_back(&ovr);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // options passed to the write call (hyperslab options, etc)
+    const Node &node() const
+    {
+        return m_opts;
+    }
+
+    //------------------------------------------------------------------------
+    // settings used to create the dataset at the given path (relative to
+    // the hdf5 id passed to the write call)
+    void dataset_settings(const std::string &dset_path,
+                          HDF5Options &res) const
+    {
+        res = m_settings;
+
+        if(m_override_opts.empty())
+        {
+            return;
+        }
+
+        // overrides are relative to the node being written, skip the 
+        // names of the path the node is written to
+        std::vector<std::string> names;
+        split_names(dset_path,names);
+        size_t root = m_root_size < names.size() ? m_root_size : names.size();
+
+        for(size_t i = 0; i < m_override_opts.size(); i++)
+        {
+            const std::vector<std::string> &ovr_names = m_override_paths[i];
+            bool match = ovr_names.size() <= names.size() - root;
+            for(size_t j = 0; match && j < ovr_names.size(); j++)
+            {
+                match = ovr_names[j] == "*" ||
+                        ovr_names[j] == names[root + j];
+            }
 
-bool HDF5Options::compact_storage_enabled   = true;
-int  HDF5Options::compact_storage_threshold = 1024;
+            if(match)
+            {
+                res.set(*m_override_opts[i]);
+            }
+        }
+    }
 
-bool        HDF5Options::chunking_enabled   = true;
-int         HDF5Options::chunk_size         = 1000000; // 1 mb 
-int         HDF5Options::chunk_threshold    = 2000000; // 2 mb
+private:
+    //------------------------------------------------------------------------
+    static void split_names(const std::string &path,
+                            std::vector<std::string> &names)
+    {
+        std::string curr;
+        std::string next;
+        std::string rest = path;
+        while(!rest.empty())
+        {
+            conduit::utils::split_path(rest,curr,next);
+            if(!curr.empty())
+            {
+                names.push_back(curr);
+            }
+            rest = next;
+        }
+    }
 
-std::string HDF5Options::compression_method = "gzip";
-int         HDF5Options::compression_level  = 5;
+    const Node                             &m_opts;
+    HDF5Options                             m_settings;
+    size_t                                  m_root_size;
+    std::vector<std::vector<std::string> >  m_override_paths;
+    std::vector<const Node*>                m_override_opts;
+};
 
 
 //-----------------------------------------------------------------------------
 void
 hdf5_set_options(const Node &opts)
 {
-    HDF5Options::set(opts);
+    HDF5Options::set_defaults(opts);
 }
 
 //-----------------------------------------------------------------------------
 void
 hdf5_options(Node &opts)
 {
-    HDF5Options::about(opts);
+    HDF5Options::defaults().about(opts);
 }
-
 //-----------------------------------------------------------------------------
 // Private class used to suppress HDF5 error messages.
 // 
@@ -396,17 +556,20 @@ void  hdf5_ref_path_with_filename(hid_t hdf5_id,
 //-----------------------------------------------------------------------------
 bool  check_if_conduit_leaf_is_compatible_with_hdf5_obj(const DataType &dtype,
                                                   const std::string &ref_path,
-                                                                hid_t hdf5_id);
+                                                                hid_t hdf5_id,
+                                                         const Node &opts);
  
 //-----------------------------------------------------------------------------
 bool  check_if_conduit_object_is_compatible_with_hdf5_tree(const Node &node,
                                                 const std::string &ref_path,
-                                                             hid_t hdf5_id);
+                                                             hid_t hdf5_id,
+                                                         const Node &opts);
 
 //-----------------------------------------------------------------------------
 bool  check_if_conduit_node_is_compatible_with_hdf5_tree(const Node &node,
                                               const std::string &ref_path,
-                                                            hid_t hdf5_id);
+                                                            hid_t hdf5_id,
+                                                         const Node &opts);
 
 
 //-----------------------------------------------------------------------------
@@ -417,44 +580,113 @@ bool  check_if_conduit_node_is_compatible_with_hdf5_tree(const Node &node,
 hid_t create_hdf5_dataset_for_conduit_leaf(const DataType &dt,
                                            const std::string &ref_path,
                                            hid_t hdf5_group_id,
-                                           const std::string &hdf5_dset_name);
+                                           const std::string &hdf5_dset_name,
+                                           const HDF5Options &settings);
+
+//-----------------------------------------------------------------------------
+hid_t create_hdf5_dataset_for_conduit_leaf_slab(const DataType &dt,
+                                                const std::string &ref_path,
+                                                hid_t hdf5_group_id,
+                                                const std::string &hdf5_dset_name,
+                                                const Node &opts,
+                                                const HDF5Options &settings);
 
 //-----------------------------------------------------------------------------
 void  write_conduit_leaf_to_hdf5_dataset(const Node &node,
                                          const std::string &ref_path,
-                                         hid_t hdf5_dset_id);
+                                         hid_t hdf5_dset_id,
+                                         const Node &opts);
+
+//-----------------------------------------------------------------------------
+void  write_conduit_leaf_to_hdf5_dataset_slab(const Node &node,
+                                              const std::string &ref_path,
+                                              hid_t hdf5_dset_id,
+                                              const Node &opts);
 
 //-----------------------------------------------------------------------------
 void  write_conduit_leaf_to_hdf5_group(const Node &node,
                                        const std::string &ref_path,
                                        hid_t hdf5_group_id,
-                                       const std::string &hdf5_dset_name);
+                                       const std::string &hdf5_dset_name,
+                                       const HDF5WriteOptions &opts);
 
 //-----------------------------------------------------------------------------
 void  write_conduit_object_to_hdf5_group(const Node &node,
                                          const std::string &ref_path,
-                                         hid_t hdf5_group_id);
+                                         hid_t hdf5_group_id,
+                                         const HDF5WriteOptions &opts);
+
+//-----------------------------------------------------------------------------
+// helpers for hyperslab (partial) reads and writes
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+bool  hdf5_has_hyperslab_write_options(const Node &opts);
+
+//-----------------------------------------------------------------------------
+void  hdf5_hyperslab_option(const Node &opts,
+                            const std::string &opt_name,
+                            int rank,
+                            const std::string &ref_path,
+                            std::vector<hsize_t> &res);
+
+//-----------------------------------------------------------------------------
+void  hdf5_hyperslab_write_selection(const Node &opts,
+                                     index_t num_elems,
+                                     int rank,
+                                     const std::string &ref_path,
+                                     std::vector<hsize_t> &offset,
+                                     std::vector<hsize_t> &stride,
+                                     std::vector<hsize_t> &count,
+                                     std::vector<hsize_t> &extent);
 
 
 //-----------------------------------------------------------------------------
 // helpers for reading
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+bool hdf5_select_hyperslab(hid_t hdf5_dspace_id,
+                           const Node &opts,
+                           const std::string &ref_path);
+
 //-----------------------------------------------------------------------------
 void read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                          const std::string &ref_path,
+                                         const Node &opts,
                                          Node &dest);
 
 //-----------------------------------------------------------------------------
 void read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                                        const std::string &ref_path,
+                                       const Node &opts,
                                        Node &dest);
 
 //-----------------------------------------------------------------------------
 void read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
                                       const std::string &ref_path,
+                                      const Node &opts,
                                       Node &dest);
 
+//-----------------------------------------------------------------------------
+// helpers for schema only reads
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void read_hdf5_dataset_into_conduit_schema(hid_t hdf5_dset_id,
+                                           const std::string &ref_path,
+                                           Schema &dest);
+
+//-----------------------------------------------------------------------------
+void read_hdf5_group_into_conduit_schema(hid_t hdf5_group_id,
+                                         const std::string &ref_path,
+                                         Schema &dest);
+
+//-----------------------------------------------------------------------------
+void read_hdf5_tree_into_conduit_schema(hid_t hdf5_id,
+                                        const std::string &ref_path,
+                                        Schema &dest);
+
 
 
 
@@ -833,7 +1065,8 @@ hdf5_ref_path_with_filename(hid_t hdf5_id,
 bool
 check_if_conduit_leaf_is_compatible_with_hdf5_obj(const DataType &dtype,
                                                   const std::string &ref_path,
-                                                  hid_t hdf5_id)
+                                                  hid_t hdf5_id,
+                                                  const Node &opts)
 {
     bool res = true;
     H5O_info_t h5_obj_info;
@@ -880,6 +1113,15 @@ check_if_conduit_leaf_is_compatible_with_hdf5_obj(const DataType &dtype,
             {
                     res = false;
             }
+            // hyperslab writes only need matching types, the extent is
+            // checked (and extended if possible) when writing
+            else if( hdf5_has_hyperslab_write_options(opts) )
+            {
+                if( H5Tequal(h5_dtype, h5_test_dtype) <= 0 )
+                {
+                    res = false;
+                }
+            }
             else if( ! ( (H5Tequal(h5_dtype, h5_test_dtype) > 0) && 
                          (dtype.number_of_elements() ==  h5_test_num_ele) ) )
             {
@@ -920,7 +1162,8 @@ check_if_conduit_leaf_is_compatible_with_hdf5_obj(const DataType &dtype,
 bool
 check_if_conduit_object_is_compatible_with_hdf5_tree(const Node &node,
                                                      const std::string &ref_path,
-                                                     hid_t hdf5_id)
+                                                     hid_t hdf5_id,
+                                                     const Node &opts)
 {
     bool res = true;
     // make sure we have a group ... 
@@ -953,7 +1196,8 @@ check_if_conduit_object_is_compatible_with_hdf5_tree(const Node &node,
                 // compatible with the conduit node
                 res = check_if_conduit_node_is_compatible_with_hdf5_tree(child,
                                                                   chld_ref_path,
-                                                                  h5_child_obj);
+                                                                  h5_child_obj,
+                                                                  opts);
             
                 CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
                                                                 hdf5_id,
@@ -980,7 +1224,8 @@ check_if_conduit_object_is_compatible_with_hdf5_tree(const Node &node,
 bool
 check_if_conduit_node_is_compatible_with_hdf5_tree(const Node &node,
                                                    const std::string &ref_path,
-                                                   hid_t hdf5_id)
+                                                   hid_t hdf5_id,
+                                                   const Node &opts)
 {
     bool res = true;
     
@@ -990,13 +1235,15 @@ check_if_conduit_node_is_compatible_with_hdf5_tree(const Node &node,
     {
         res = check_if_conduit_leaf_is_compatible_with_hdf5_obj(dt,
                                                                 ref_path,
-                                                                hdf5_id);
+                                                                hdf5_id,
+                                                                opts);
     }
     else if(dt.is_object())
     {
         res = check_if_conduit_object_is_compatible_with_hdf5_tree(node,
                                                                    ref_path,
-                                                                   hdf5_id);
+                                                                   hdf5_id,
+                                                                   opts);
     }
     else // not supported
     {
@@ -1020,7 +1267,8 @@ create_hdf5_compact_plist_for_conduit_leaf()
 
 //---------------------------------------------------------------------------//
 hid_t
-create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype)
+create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype,
+                                           const HDF5Options &settings)
 {
     hid_t h5_cprops_id = H5Pcreate(H5P_DATASET_CREATE);
 
@@ -1028,15 +1276,16 @@ create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype)
     
     // hdf5 sets chunking in elements, not bytes, 
     // our options are in bytes, so convert to # of elems
-    hsize_t h5_chunk_size =  (hsize_t) (HDF5Options::chunk_size / dtype.element_bytes()); 
+    hsize_t h5_chunk_size =  (hsize_t) (settings.chunk_size /
+                                        dtype.element_bytes());
 
     H5Pset_chunk(h5_cprops_id, 1, &h5_chunk_size);
 
-    if(HDF5Options::compression_method == "gzip" )
+    if(settings.compression_method == "gzip" )
     {
         // Turn on compression
         H5Pset_shuffle(h5_cprops_id);
-        H5Pset_deflate(h5_cprops_id, HDF5Options::compression_level);
+        H5Pset_deflate(h5_cprops_id, settings.compression_level);
     }
 
     return h5_cprops_id;
@@ -1048,7 +1297,8 @@ hid_t
 create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
                                      const std::string &ref_path,
                                      hid_t hdf5_group_id,
-                                     const std::string &hdf5_dset_name)
+                                     const std::string &hdf5_dset_name,
+                                     const HDF5Options &settings)
 {
     hid_t res = -1;
     
@@ -1059,15 +1309,16 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
     hid_t h5_cprops_id = H5P_DEFAULT;
     
 
-    if( HDF5Options::compact_storage_enabled &&
-        dtype.bytes_compact() <= HDF5Options::compact_storage_threshold)
+    if( settings.compact_storage_enabled &&
+        dtype.bytes_compact() <= settings.compact_storage_threshold)
     {
         h5_cprops_id = create_hdf5_compact_plist_for_conduit_leaf();
     }
-    else if( HDF5Options::chunking_enabled &&
-             dtype.bytes_compact() > HDF5Options::chunk_threshold)
+    else if( settings.chunking_enabled &&
+             dtype.bytes_compact() > settings.chunk_threshold)
     {
-        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(dtype);
+        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(dtype,
+                                                                  settings);
     }
 
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_cprops_id,
@@ -1194,8 +1445,18 @@ create_hdf5_dataset_for_conduit_empty(hid_t hdf5_group_id,
 void 
 write_conduit_leaf_to_hdf5_dataset(const Node &node,
                                    const std::string &ref_path,
-                                   hid_t hdf5_dset_id)
+                                   hid_t hdf5_dset_id,
+                                   const Node &opts)
 {
+    if(hdf5_has_hyperslab_write_options(opts))
+    {
+        write_conduit_leaf_to_hdf5_dataset_slab(node,
+                                                ref_path,
+                                                hdf5_dset_id,
+                                                opts);
+        return;
+    }
+
     DataType dt = node.dtype();
     
     hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(dt,ref_path);
@@ -1236,1542 +1497,3465 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
 }
 
 //---------------------------------------------------------------------------//
-void 
-write_conduit_leaf_to_hdf5_group(const Node &node,
-                                 const std::string &ref_path,
-                                 hid_t hdf5_group_id,
-                                 const std::string &hdf5_dset_name)
+bool
+hdf5_has_hyperslab_write_options(const Node &opts)
 {
-    // data set case ...
-
-    // check if the dataset exists
-    H5O_info_t h5_obj_info;
-    herr_t h5_info_status =  H5Oget_info_by_name(hdf5_group_id,
-                                                 hdf5_dset_name.c_str(),
-                                                 &h5_obj_info,
-                                                 H5P_DEFAULT);
+    return opts.has_child("offset") ||
+           opts.has_child("stride") ||
+           opts.has_child("count")  ||
+           opts.has_child("dims");
+}
 
-    hid_t h5_child_id = -1;
+//---------------------------------------------------------------------------//
+// Computes the hyperslab a slab write of num_elems elements targets,
+// from the "offset", "stride", "count" and "dims" write options, and 
+// the extent the dataset needs to hold it.
+//---------------------------------------------------------------------------//
+void
+hdf5_hyperslab_write_selection(const Node &opts,
+                               index_t num_elems,
+                               int rank,
+                               const std::string &ref_path,
+                               std::vector<hsize_t> &offset,
+                               std::vector<hsize_t> &stride,
+                               std::vector<hsize_t> &count,
+                               std::vector<hsize_t> &extent)
+{
+    offset = std::vector<hsize_t>(rank,0);
+    stride = std::vector<hsize_t>(rank,1);
+    count  = std::vector<hsize_t>(rank,0);
+    extent = std::vector<hsize_t>(rank,0);
 
-    if( CONDUIT_HDF5_STATUS_OK(h5_info_status) )
+    if(opts.has_child("offset"))
     {
-        // if it does exist, we assume it is compatible
-        // (this private method will only be called after a 
-        //  compatibility check)
-        h5_child_id = H5Dopen(hdf5_group_id,
-                              hdf5_dset_name.c_str(),
-                              H5P_DEFAULT);
-
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
-                                                        hdf5_group_id,
-                                                        ref_path,
-                                               "Failed to open HDF5 Dataset "
-                                               << " parent: "
-                                               << hdf5_group_id
-                                               << " name: "
-                                               << hdf5_dset_name);
+        hdf5_hyperslab_option(opts,"offset",rank,ref_path,offset);
     }
-    else
-    {
-        // if the hdf5 dataset does not exist, we need to create it
-        h5_child_id = create_hdf5_dataset_for_conduit_leaf(node.dtype(),
-                                                           ref_path,
-                                                           hdf5_group_id,
-                                                           hdf5_dset_name);
 
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
-                                                        hdf5_group_id,
-                                                        ref_path,
-                                               "Failed to create HDF5 Dataset "
-                                               << " parent: "
-                                               << hdf5_group_id
-                                               << " name: "
-                                               << hdf5_dset_name);
+    if(opts.has_child("stride"))
+    {
+        hdf5_hyperslab_option(opts,"stride",rank,ref_path,stride);
     }
-    
-    std::string chld_ref_path = join_ref_paths(ref_path,hdf5_dset_name);
-    // write the data
-    write_conduit_leaf_to_hdf5_dataset(node,
-                                       chld_ref_path,
-                                       h5_child_id);
-    
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_child_id),
-                                                    hdf5_group_id,
-                                                    ref_path,
-                                           "Failed to close HDF5 Dataset: "
-                                           << h5_child_id);
-}
-
-//---------------------------------------------------------------------------//
-void 
-write_conduit_empty_to_hdf5_group(hid_t hdf5_group_id,
-                                  const std::string &ref_path,
-                                  const std::string &hdf5_dset_name)
-{
-
-    // check if the dataset exists
-    H5O_info_t h5_obj_info;
-    herr_t h5_info_status =  H5Oget_info_by_name(hdf5_group_id,
-                                                 hdf5_dset_name.c_str(),
-                                                 &h5_obj_info,
-                                                 H5P_DEFAULT);
 
-    hid_t h5_child_id = -1;
+    if(opts.has_child("dims"))
+    {
+        hdf5_hyperslab_option(opts,"dims",rank,ref_path,extent);
+    }
 
-    if( CONDUIT_HDF5_STATUS_OK(h5_info_status) )
+    if(opts.has_child("count"))
     {
-        // if it does exist, we assume it is compatible
-        // (this private method will only be called after a 
-        //  compatibility check)
+        hdf5_hyperslab_option(opts,"count",rank,ref_path,count);
+    }
+    else if(rank == 1)
+    {
+        count[0] = (hsize_t) num_elems;
     }
     else
     {
-        // if the hdf5 dataset does not exist, we need to create it
-        h5_child_id = create_hdf5_dataset_for_conduit_empty(hdf5_group_id,
-                                                            ref_path,
-                                                            hdf5_dset_name);
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Option \"count\" is required for hyperslab "
+                           "writes to datasets with rank > 1");
+    }
 
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
-                                                        hdf5_group_id,
-                                                        ref_path,
-                                               "Failed to create HDF5 Dataset "
-                                               << " parent: " << hdf5_group_id
-                                               << " name: "   << hdf5_dset_name);
+    index_t sel_num_elems = 1;
 
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_child_id), 
-                                                        hdf5_group_id,
-                                                        ref_path,
-                                              "Failed to close HDF5 Dataset: "
-                                              << h5_child_id);
+    for(int d = 0; d < rank; d++)
+    {
+        if(stride[d] == 0)
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Option \"stride\" must be > 0");
+        }
+
+        sel_num_elems *= (index_t) count[d];
+
+        // the extent must hold the last selected element
+        hsize_t sel_end = offset[d];
+        if(count[d] > 0)
+        {
+            sel_end += (count[d] - 1) * stride[d] + 1;
+        }
+
+        if(sel_end > extent[d])
+        {
+            extent[d] = sel_end;
+        }
     }
-    
 
+    if(sel_num_elems != num_elems)
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Hyperslab write selects " << sel_num_elems
+                           << " elements, but the Conduit Node has "
+                           << num_elems << " elements");
+    }
 }
 
 //---------------------------------------------------------------------------//
-// assume this is called only if we know the hdf5 state is compatible 
+// Creates a dataset that can hold the hyperslab selected by the write 
+// options. These datasets are chunked and have an unlimited max extent,
+// so later hyperslab writes can extend them.
 //---------------------------------------------------------------------------//
-void
-write_conduit_object_to_hdf5_group(const Node &node,
-                                   const std::string &ref_path,
-                                   hid_t hdf5_group_id)
+hid_t
+create_hdf5_dataset_for_conduit_leaf_slab(const DataType &dtype,
+                                          const std::string &ref_path,
+                                          hid_t hdf5_group_id,
+                                          const std::string &hdf5_dset_name,
+                                          const Node &opts,
+                                          const HDF5Options &settings)
 {
-    NodeConstIterator itr = node.children();
-
-    // call on each child with expanded path
-    while(itr.has_next())
+    if(dtype.is_string())
     {
-        const Node &child = itr.next();
-        DataType dt = child.dtype();
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Cannot write a hyperslab of a string");
+    }
 
-        if(dt.is_number() || dt. is_string())
+    // the rank is given by the array options, scalar options mean 1-D
+    int rank = 1;
+    const char *opt_names[4] = {"dims", "offset", "count", "stride"};
+    for(int i = 0; i < 4; i++)
+    {
+        if(opts.has_child(opt_names[i]))
         {
-            write_conduit_leaf_to_hdf5_group(child,
-                                             ref_path,
-                                             hdf5_group_id,
-                                             itr.name().c_str());
+            rank = (int) opts[opt_names[i]].dtype().number_of_elements();
+            break;
         }
-        else if(dt.is_empty())
-        {
-            // if we have an empty node, it will become
-            // a dataset with an null shape
-            write_conduit_empty_to_hdf5_group(hdf5_group_id,
-                                              ref_path,
-                                              itr.name().c_str());
-        }
-        else if(dt.is_object())
-        {
-            // check if the HDF5 group has child with same name 
-            // as the node's child
-            H5O_info_t h5_obj_info;
-            herr_t h5_info_status =  H5Oget_info_by_name(hdf5_group_id,
-                                                         itr.name().c_str(),
-                                                         &h5_obj_info,
-                                                         H5P_DEFAULT);
-            
-            hid_t h5_child_id = -1;
-            
-            if( CONDUIT_HDF5_STATUS_OK(h5_info_status) )
-            {
-                // if the hdf5 group exists, open it
-                h5_child_id = H5Gopen(hdf5_group_id,
-                                      itr.name().c_str(),
-                                      H5P_DEFAULT);
+    }
 
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
-                                                                hdf5_group_id,
-                                                                ref_path,
-                                             "Failed to open HDF5 Group "
-                                             << " parent: " << hdf5_group_id
-                                             << " name: "   << itr.name());
-            }
-            else
-            {
-                // if the hdf5 group doesn't exist, we need to create it
-                hid_t h5_gc_plist = H5Pcreate(H5P_GROUP_CREATE);
-        
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_gc_plist,
-                                                                hdf5_group_id,
-                                                                ref_path,
-                                 "Failed to create H5P_GROUP_CREATE property "
-                                 << " list");
-        
-                // track creation order
-                herr_t h5_status = H5Pset_link_creation_order(h5_gc_plist, 
-                        ( H5P_CRT_ORDER_TRACKED |  H5P_CRT_ORDER_INDEXED) );
+    std::vector<hsize_t> offset, stride, count, extent;
+    hdf5_hyperslab_write_selection(opts,
+                                   dtype.number_of_elements(),
+                                   rank,
+                                   ref_path,
+                                   offset,
+                                   stride,
+                                   count,
+                                   extent);
 
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                                hdf5_group_id,
-                                                                ref_path,
-                                 "Failed to set group link creation property");
+    std::vector<hsize_t> max_extent(rank,H5S_UNLIMITED);
 
-                // prefer compact group storage 
-                // https://support.hdfgroup.org/HDF5/doc/RM/RM_H5G.html#Group-GroupStyles
-                h5_status = H5Pset_link_phase_change(h5_gc_plist,
-                                                     32,  // max for compact storage
-                                                     32); // min for dense storage
+    hid_t h5_dspace_id = H5Screate_simple(rank,
+                                          &extent[0],
+                                          &max_extent[0]);
 
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                                hdf5_group_id,
-                                                                ref_path,
-                            "Failed to set group link phase change property ");
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Dataspace");
 
-                // calc hints for meta data about link names
-                NodeConstIterator chld_itr = itr.node().children();
-                
-                index_t chld_names_avg_size = 0;
-                index_t num_children = itr.node().number_of_children();
-                
-                while(chld_itr.has_next())
-                {
-                    chld_itr.next();
-                    chld_names_avg_size +=chld_itr.name().size();
-                }
-                
-                if(chld_names_avg_size > 0 && num_children > 0 )
-                {
-                    chld_names_avg_size = chld_names_avg_size / num_children;
-                }
+    // unlimited datasets must be chunked. chunks hold at most our chunk 
+    // size option worth of elements: they cover the written hyperslab's
+    // trailing dimensions (innermost first) and the rest of the budget 
+    // goes to the first dimension
+    hsize_t chunk_elems = (hsize_t) (settings.chunk_size / 
+                                     dtype.element_bytes());
+    if(chunk_elems < 1)
+    {
+        chunk_elems = 1;
+    }
 
-                // set hints for meta data about link names
-                h5_status = H5Pset_est_link_info(h5_gc_plist,
-                                                 // number of children
-                                                 (unsigned int)num_children,
-                                                 // est name size
-                                                 (unsigned int)chld_names_avg_size);
+    std::vector<hsize_t> chunk(rank,1);
+    for(int d = rank - 1; d > 0; d--)
+    {
+        chunk[d] = count[d] > 0 ? count[d] : 1;
+        if(chunk[d] > chunk_elems)
+        {
+            chunk[d] = chunk_elems;
+        }
+        chunk_elems /= chunk[d];
+    }
+    chunk[0] = chunk_elems;
 
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                                hdf5_group_id,
-                                                                ref_path,
-                            "Failed to set group est link info property ");
+    hid_t h5_cprops_id = H5Pcreate(H5P_DATASET_CREATE);
 
-                h5_child_id = H5Gcreate(hdf5_group_id,
-                                        itr.name().c_str(),
-                                        H5P_DEFAULT,
-                                        h5_gc_plist,
-                                        H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_cprops_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                         "Failed to create HDF5 property list");
 
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
-                                                                hdf5_group_id,
-                                                                ref_path,
-                                      "Failed to create HDF5 Group "
-                                      << " parent: " << hdf5_group_id
-                                      << " name: "   << itr.name());
+    herr_t h5_status = H5Pset_chunk(h5_cprops_id, rank, &chunk[0]);
 
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_gc_plist),
-                                                                hdf5_group_id,
-                                                                ref_path,
-                                     "Failed to close HDF5 H5P_GROUP_CREATE "
-                                     << "property list: " 
-                                     << h5_gc_plist);
-            }
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                         "Failed to set HDF5 chunk size");
 
+    if(settings.compression_method == "gzip" )
+    {
+        // Turn on compression
+        H5Pset_shuffle(h5_cprops_id);
+        H5Pset_deflate(h5_cprops_id, settings.compression_level);
+    }
 
-            // traverse 
-            write_conduit_object_to_hdf5_group(child,
-                                               ref_path,
-                                               h5_child_id);
+    hid_t h5_dtype = conduit_dtype_to_hdf5_dtype(dtype,ref_path);
 
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_child_id),
-                                                            hdf5_group_id,
-                                                            ref_path,
-                                     "Failed to close HDF5 Group " 
-                                     << h5_child_id);
-        }
-        else
-        {
-            CONDUIT_HDF5_WARN(ref_path,
-                               "DataType \'" 
-                               << DataType::id_to_name(dt.id())
-                               <<"\' not supported for relay HDF5 I/O");
-        }
-    }
-}
+    // create new dataset
+    hid_t res = H5Dcreate(hdf5_group_id,
+                          hdf5_dset_name.c_str(),
+                          h5_dtype,
+                          h5_dspace_id,
+                          H5P_DEFAULT,
+                          h5_cprops_id,
+                          H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(res,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Dataset " 
+                                           << hdf5_group_id << " " 
+                                           << hdf5_dset_name);
+
+    conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype);
 
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_cprops_id),
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 chunking "
+                                           "property list " 
+                                           << h5_cprops_id);
 
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Dataspace " 
+                                           << h5_dspace_id);
+    return res;
+}
 
 //---------------------------------------------------------------------------//
-// assumes compatible, dispatches to proper specific write
+// Writes a leaf into the hyperslab of an existing dataset selected by the
+// write options. If the hyperslab extends past the current extent of the
+// dataset, the dataset is extended (this requires a chunked dataset with
+// a large enough max extent).
 //---------------------------------------------------------------------------//
-void
-write_conduit_node_to_hdf5_tree(const Node &node,
-                                const std::string &ref_path,
-                                hid_t hdf5_id)
+void 
+write_conduit_leaf_to_hdf5_dataset_slab(const Node &node,
+                                        const std::string &ref_path,
+                                        hid_t hdf5_dset_id,
+                                        const Node &opts)
 {
-
     DataType dt = node.dtype();
-    // we support a leaf or a group 
-    if(dt.is_number() || dt.is_string())
+
+    if(dt.is_string())
     {
-        write_conduit_leaf_to_hdf5_dataset(node,
-                                           ref_path,
-                                           hdf5_id);
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Cannot write a hyperslab of a string");
     }
-    else if(dt.is_object())
+
+    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error reading HDF5 Dataspace: " 
+                                           << hdf5_dset_id);
+
+    int rank = H5Sget_simple_extent_ndims(h5_dspace_id);
+
+    if(rank < 1)
     {
-        write_conduit_object_to_hdf5_group(node,
-                                           ref_path,
-                                           hdf5_id);
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Cannot write a hyperslab to a dataset "
+                           "with a scalar dataspace");
     }
-    else // not supported
+
+    std::vector<hsize_t> dims(rank,0);
+    std::vector<hsize_t> max_dims(rank,0);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                        H5Sget_simple_extent_dims(h5_dspace_id,
+                                                  &dims[0],
+                                                  &max_dims[0]),
+                        hdf5_dset_id,
+                        ref_path,
+                        "Error reading HDF5 Dataspace dimensions: "
+                        << h5_dspace_id);
+
+    std::vector<hsize_t> offset, stride, count, extent;
+    hdf5_hyperslab_write_selection(opts,
+                                   dt.number_of_elements(),
+                                   rank,
+                                   ref_path,
+                                   offset,
+                                   stride,
+                                   count,
+                                   extent);
+
+    // extend the dataset if needed
+    bool extend = false;
+    for(int d = 0; d < rank; d++)
     {
-        std::string hdf5_err_ref_path;
-        hdf5_ref_path_with_filename(hdf5_id, ref_path, hdf5_err_ref_path);
-        CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                   "HDF5 write doesn't support LIST_ID or EMPTY_ID nodes.");
+        if(extent[d] > dims[d])
+        {
+            if(max_dims[d] != H5S_UNLIMITED && extent[d] > max_dims[d])
+            {
+                CONDUIT_HDF5_ERROR(ref_path,
+                                   "Hyperslab write needs extent " 
+                                   << extent[d] << " for dimension " << d
+                                   << ", which exceeds the dataset's max "
+                                   << "extent (" << max_dims[d] << ")");
+            }
+            extend = true;
+        }
+        else
+        {
+            extent[d] = dims[d];
+        }
     }
-}
 
+    if(extend)
+    {
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                H5Dset_extent(hdf5_dset_id,&extent[0]),
+                                hdf5_dset_id,
+                                ref_path,
+                                "Failed to extend HDF5 Dataset "
+                                << hdf5_dset_id);
+
+        // the dataspace changes with the extent
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Failed to close HDF5 "
+                                               "Dataspace " << h5_dspace_id);
 
+        h5_dspace_id = H5Dget_space(hdf5_dset_id);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                              "Error reading HDF5 Dataspace: "
+                                              << hdf5_dset_id);
+    }
 
-//---------------------------------------------------------------------------//
-// Read Helpers
-//---------------------------------------------------------------------------//
+    hsize_t num_elems = (hsize_t) dt.number_of_elements();
 
+    if(num_elems > 0)
+    {
+        herr_t h5_status = H5Sselect_hyperslab(h5_dspace_id,
+                                               H5S_SELECT_SET,
+                                               &offset[0],
+                                               &stride[0],
+                                               &count[0],
+                                               NULL);
 
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-/// Data structures and callbacks that allow us to read an HDF5 hierarchy 
-/// via H5Literate 
-/// (adapted from: h5ex_g_traverse)
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-/// 
-/// I also reviewed / partially tried the seemingly more straight forward 
-/// approach in:
-///  https://www.hdfgroup.org/ftp/HDF5/examples/misc-examples/h5_info.c
-///
-/// But since H5Gget_objtype_by_idx and H5Gget_objname_by_idx are deprecated
-/// there in favor of H5Lget_name_by_idx & H5Oget_info_by_idx, there isn't a
-/// direct way to check for links which could create cycles.
-/// 
-/// It appears that the H5Literate method (as demonstrated in the
-/// h5ex_g_traverse example) is the preferred way to read an hdf5 location
-/// hierarchically, even if it seems overly complex.
-///
-//---------------------------------------------------------------------------//
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error selecting hyperslab "
+                                               "from HDF5 Dataspace: "
+                                               << h5_dspace_id);
 
-//---------------------------------------------------------------------------//
-/// Operator struct type for our H5Literate callback.
-/// (adapted from: h5ex_g_traverse)
-//---------------------------------------------------------------------------//
-//
-// Define operator data structure type for H5Literate callback.
-// During recursive iteration, these structures will form a
-// linked list that can be searched for duplicate groups,
-// preventing infinite recursion.
-//
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-// For conduit+relay: Added a pointer to hold a conduit node for construction.
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-//
-//---------------------------------------------------------------------------//
-struct h5_read_opdata
-{
-    unsigned                recurs;      /* Recursion level.  0=root */
-    struct h5_read_opdata   *prev;        /* Pointer to previous opdata */
-    haddr_t                 addr;        /* Group address */
+        hid_t h5_mem_dspace_id = H5Screate_simple(1,
+                                                  &num_elems,
+                                                  NULL);
 
-    // pointer to conduit node, anchors traversal to 
-    Node            *node;
-    std::string      ref_path;
-};
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_mem_dspace_id,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Failed to create HDF5 "
+                                               "Dataspace (memory dspace)");
+
+        hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(dt,ref_path);
+
+        // if the node is compact, we can write directly from its data ptr
+        // otherwise, we need to compact our data first
+        Node n_compact;
+        const void *data_ptr = node.data_ptr();
+        if(!dt.is_compact())
+        {
+            node.compact_to(n_compact);
+            data_ptr = n_compact.data_ptr();
+        }
+
+        h5_status = H5Dwrite(hdf5_dset_id,
+                             h5_dtype_id,
+                             h5_mem_dspace_id,
+                             h5_dspace_id,
+                             H5P_DEFAULT,
+                             data_ptr);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Failed to write hyperslab "
+                                               "to HDF5 Dataset "
+                                               << hdf5_dset_id);
+
+        conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                                    H5Sclose(h5_mem_dspace_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                               "Failed to close HDF5 "
+                                               "Dataspace (memory dspace) "
+                                               << h5_mem_dspace_id);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Dataspace " 
+                                           << h5_dspace_id);
+}
 
 //---------------------------------------------------------------------------//
-/// Recursive check for cycles.
-/// (adapted from: h5ex_g_traverse)
-//---------------------------------------------------------------------------//
-//
-//  This function recursively searches the linked list of
-//  h5_read_opdata structures for one whose address matches
-//  target_addr.  Returns 1 if a match is found, and 0
-//  otherwise.
-//---------------------------------------------------------------------------//
-int
-h5_group_check(h5_read_opdata *od,
-               haddr_t target_addr)
+void 
+write_conduit_leaf_to_hdf5_group(const Node &node,
+                                 const std::string &ref_path,
+                                 hid_t hdf5_group_id,
+                                 const std::string &hdf5_dset_name,
+                                 const HDF5WriteOptions &opts)
 {
-    if (od->addr == target_addr)
+    // data set case ...
+
+    // check if the dataset exists
+    H5O_info_t h5_obj_info;
+    herr_t h5_info_status =  H5Oget_info_by_name(hdf5_group_id,
+                                                 hdf5_dset_name.c_str(),
+                                                 &h5_obj_info,
+                                                 H5P_DEFAULT);
+
+    hid_t h5_child_id = -1;
+
+    std::string chld_ref_path = join_ref_paths(ref_path,hdf5_dset_name);
+
+    if( CONDUIT_HDF5_STATUS_OK(h5_info_status) )
     {
-        /* Addresses match */
-        return 1;
+        // if it does exist, we assume it is compatible
+        // (this private method will only be called after a 
+        //  compatibility check)
+        h5_child_id = H5Dopen(hdf5_group_id,
+                              hdf5_dset_name.c_str(),
+                              H5P_DEFAULT);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                               "Failed to open HDF5 Dataset "
+                                               << " parent: "
+                                               << hdf5_group_id
+                                               << " name: "
+                                               << hdf5_dset_name);
     }
-    else if (!od->recurs)
+    else if(hdf5_has_hyperslab_write_options(opts.node()))
     {
-        /* Root group reached with no matches */
-        return 0;
+        // if the hdf5 dataset does not exist, create a dataset that 
+        // can hold the selected hyperslab
+        HDF5Options settings;
+        opts.dataset_settings(chld_ref_path,settings);
+        h5_child_id = create_hdf5_dataset_for_conduit_leaf_slab(node.dtype(),
+                                                                ref_path,
+                                                                hdf5_group_id,
+                                                                hdf5_dset_name,
+                                                                opts.node(),
+                                                                settings);
     }
     else
     {
-        /* Recursively examine the next node */
-        return h5_group_check(od->prev, target_addr);
+        // if the hdf5 dataset does not exist, we need to create it
+        HDF5Options settings;
+        opts.dataset_settings(chld_ref_path,settings);
+        h5_child_id = create_hdf5_dataset_for_conduit_leaf(node.dtype(),
+                                                           ref_path,
+                                                           hdf5_group_id,
+                                                           hdf5_dset_name,
+                                                           settings);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                               "Failed to create HDF5 Dataset "
+                                               << " parent: "
+                                               << hdf5_group_id
+                                               << " name: "
+                                               << hdf5_dset_name);
     }
+
+    // write the data
+    write_conduit_leaf_to_hdf5_dataset(node,
+                                       chld_ref_path,
+                                       h5_child_id,
+                                       opts.node());
+    
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_child_id),
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Dataset: "
+                                           << h5_child_id);
 }
 
 //---------------------------------------------------------------------------//
-/// Our main callback for H5Literate.
-/// (adapted from: h5ex_g_traverse)
-//---------------------------------------------------------------------------//
-//  Operator function.  This function prints the name and type
-//  of the object passed to it.  If the object is a group, it
-//  is first checked against other groups in its path using
-//  the group_check function, then if it is not a duplicate,
-//  H5Literate is called for that group.  This guarantees that
-//  the program will not enter infinite recursion due to a
-//  circular path in the file.
-//---------------------------------------------------------------------------//
-herr_t
-h5l_iterate_traverse_op_func(hid_t hdf5_id,
-                             const char *hdf5_path,
-                             const H5L_info_t *,// hdf5_info -- unused
-                             void *hdf5_operator_data)
+void 
+write_conduit_empty_to_hdf5_group(hid_t hdf5_group_id,
+                                  const std::string &ref_path,
+                                  const std::string &hdf5_dset_name)
 {
-    herr_t h5_status = 0;
-    herr_t h5_return_val = 0;
-    H5O_info_t h5_info_buf;
 
-    /* Type conversion */
-    struct h5_read_opdata *h5_od = (struct h5_read_opdata*)hdf5_operator_data;
+    // check if the dataset exists
+    H5O_info_t h5_obj_info;
+    herr_t h5_info_status =  H5Oget_info_by_name(hdf5_group_id,
+                                                 hdf5_dset_name.c_str(),
+                                                 &h5_obj_info,
+                                                 H5P_DEFAULT);
 
+    hid_t h5_child_id = -1;
 
-    /*
-     * Get type of the object and display its name and type.
-     * The name of the object is passed to this function by
-     * the Library.
-     */
-    h5_status = H5Oget_info_by_name(hdf5_id,
-                                    hdf5_path,
-                                    &h5_info_buf,
-                                    H5P_DEFAULT);
+    if( CONDUIT_HDF5_STATUS_OK(h5_info_status) )
+    {
+        // if it does exist, we assume it is compatible
+        // (this private method will only be called after a 
+        //  compatibility check)
+    }
+    else
+    {
+        // if the hdf5 dataset does not exist, we need to create it
+        h5_child_id = create_hdf5_dataset_for_conduit_empty(hdf5_group_id,
+                                                            ref_path,
+                                                            hdf5_dset_name);
 
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                    hdf5_id,
-                                                    h5_od->ref_path,
-                                           "Error fetching HDF5 Object info: "
-                                           << " parent: " << hdf5_id 
-                                           << " path:"    << hdf5_path) ;
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                               "Failed to create HDF5 Dataset "
+                                               << " parent: " << hdf5_group_id
+                                               << " name: "   << hdf5_dset_name);
 
-    std::string chld_ref_path = h5_od->ref_path  + 
-                                std::string("/") + 
-                                std::string(hdf5_path);
-    switch (h5_info_buf.type)
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_child_id), 
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                              "Failed to close HDF5 Dataset: "
+                                              << h5_child_id);
+    }
+    
+
+}
+
+//---------------------------------------------------------------------------//
+// assume this is called only if we know the hdf5 state is compatible 
+//---------------------------------------------------------------------------//
+void
+write_conduit_object_to_hdf5_group(const Node &node,
+                                   const std::string &ref_path,
+                                   hid_t hdf5_group_id,
+                                   const HDF5WriteOptions &opts)
+{
+    NodeConstIterator itr = node.children();
+
+    // call on each child with expanded path
+    while(itr.has_next())
     {
-        case H5O_TYPE_GROUP:
+        const Node &child = itr.next();
+        DataType dt = child.dtype();
+
+        if(dt.is_number() || dt. is_string())
         {
-            /*
-             * Check group address against linked list of operator
-             * data structures.  We will always run the check, as the
-             * reference count cannot be relied upon if there are
-             * symbolic links, and H5Oget_info_by_name always follows
-             * symbolic links.  Alternatively we could use H5Lget_info
-             * and never recurse on groups discovered by symbolic
-             * links, however it could still fail if an object's
-             * reference count was manually manipulated with
-             * H5Odecr_refcount.
-             */
-            if ( h5_group_check (h5_od, h5_info_buf.addr) )
+            write_conduit_leaf_to_hdf5_group(child,
+                                             ref_path,
+                                             hdf5_group_id,
+                                             itr.name().c_str(),
+                                             opts);
+        }
+        else if(dt.is_empty())
+        {
+            // if we have an empty node, it will become
+            // a dataset with an null shape
+            write_conduit_empty_to_hdf5_group(hdf5_group_id,
+                                              ref_path,
+                                              itr.name().c_str());
+        }
+        else if(dt.is_object())
+        {
+            // check if the HDF5 group has child with same name 
+            // as the node's child
+            H5O_info_t h5_obj_info;
+            herr_t h5_info_status =  H5Oget_info_by_name(hdf5_group_id,
+                                                         itr.name().c_str(),
+                                                         &h5_obj_info,
+                                                         H5P_DEFAULT);
+            
+            hid_t h5_child_id = -1;
+            
+            if( CONDUIT_HDF5_STATUS_OK(h5_info_status) )
             {
-                // skip cycles in the graph ...
+                // if the hdf5 group exists, open it
+                h5_child_id = H5Gopen(hdf5_group_id,
+                                      itr.name().c_str(),
+                                      H5P_DEFAULT);
+
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                                hdf5_group_id,
+                                                                ref_path,
+                                             "Failed to open HDF5 Group "
+                                             << " parent: " << hdf5_group_id
+                                             << " name: "   << itr.name());
             }
             else
             {
-                hid_t h5_group_id = H5Gopen(hdf5_id,
-                                           hdf5_path,
-                                           H5P_DEFAULT);
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_group_id,
-                                                                hdf5_id,
-                                                                h5_od->ref_path,
-                                                       "Error opening HDF5 "
-                                                       << "Group: " 
-                                                       << " parent: "
-                                                       << hdf5_id 
-                                                       << " path:"
-                                                       << hdf5_path);
+                // if the hdf5 group doesn't exist, we need to create it
+                hid_t h5_gc_plist = H5Pcreate(H5P_GROUP_CREATE);
+        
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_gc_plist,
+                                                                hdf5_group_id,
+                                                                ref_path,
+                                 "Failed to create H5P_GROUP_CREATE property "
+                                 << " list");
+        
+                // track creation order
+                herr_t h5_status = H5Pset_link_creation_order(h5_gc_plist, 
+                        ( H5P_CRT_ORDER_TRACKED |  H5P_CRT_ORDER_INDEXED) );
 
-                // execute traversal for this group
-                Node &chld_node = h5_od->node->fetch(hdf5_path);
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                                hdf5_group_id,
+                                                                ref_path,
+                                 "Failed to set group link creation property");
+
+                // prefer compact group storage 
+                // https://support.hdfgroup.org/HDF5/doc/RM/RM_H5G.html#Group-GroupStyles
+                h5_status = H5Pset_link_phase_change(h5_gc_plist,
+                                                     32,  // max for compact storage
+                                                     32); // min for dense storage
 
-                read_hdf5_group_into_conduit_node(h5_group_id,
-                                                  chld_ref_path,
-                                                  chld_node);
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                                hdf5_group_id,
+                                                                ref_path,
+                            "Failed to set group link phase change property ");
 
-                // close the group
-                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_group_id),
-                                                                hdf5_id,
-                                                                h5_od->ref_path,
-                                                       "Error closing HDF5 "
-                                                       << "Group: "
-                                                       << h5_group_id);
+                // calc hints for meta data about link names
+                NodeConstIterator chld_itr = itr.node().children();
+                
+                index_t chld_names_avg_size = 0;
+                index_t num_children = itr.node().number_of_children();
+                
+                while(chld_itr.has_next())
+                {
+                    chld_itr.next();
+                    chld_names_avg_size +=chld_itr.name().size();
+                }
+                
+                if(chld_names_avg_size > 0 && num_children > 0 )
+                {
+                    chld_names_avg_size = chld_names_avg_size / num_children;
+                }
+
+                // set hints for meta data about link names
+                h5_status = H5Pset_est_link_info(h5_gc_plist,
+                                                 // number of children
+                                                 (unsigned int)num_children,
+                                                 // est name size
+                                                 (unsigned int)chld_names_avg_size);
+
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                                hdf5_group_id,
+                                                                ref_path,
+                            "Failed to set group est link info property ");
+
+                h5_child_id = H5Gcreate(hdf5_group_id,
+                                        itr.name().c_str(),
+                                        H5P_DEFAULT,
+                                        h5_gc_plist,
+                                        H5P_DEFAULT);
+
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                                hdf5_group_id,
+                                                                ref_path,
+                                      "Failed to create HDF5 Group "
+                                      << " parent: " << hdf5_group_id
+                                      << " name: "   << itr.name());
+
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_gc_plist),
+                                                                hdf5_group_id,
+                                                                ref_path,
+                                     "Failed to close HDF5 H5P_GROUP_CREATE "
+                                     << "property list: " 
+                                     << h5_gc_plist);
             }
-            break;
-        }
-        case H5O_TYPE_DATASET:
-        {
-            Node &leaf = h5_od->node->fetch(hdf5_path);
-            // open hdf5 dataset at path
-            hid_t h5_dset_id = H5Dopen(hdf5_id,
-                                       hdf5_path,
-                                       H5P_DEFAULT);
 
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
-                                                            hdf5_id,
-                                                            h5_od->ref_path,
-                                                   "Error opening HDF5 "
-                                                   << " Dataset: " 
-                                                   << " parent: "
-                                                   << hdf5_id 
-                                                   << " path:"
-                                                   << hdf5_path);
 
-            read_hdf5_dataset_into_conduit_node(h5_dset_id,
-                                                chld_ref_path,
-                                                leaf);
-            
-            // close the dataset
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
-                                                            hdf5_id,
-                                                            h5_od->ref_path,
-                                                   "Error closing HDF5 "
-                                                   << " Dataset: " 
-                                                   << h5_dset_id);
-            break;
+            // traverse 
+            write_conduit_object_to_hdf5_group(child,
+                                               join_ref_paths(ref_path,
+                                                              itr.name()),
+                                               h5_child_id,
+                                               opts);
+
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_child_id),
+                                                            hdf5_group_id,
+                                                            ref_path,
+                                     "Failed to close HDF5 Group " 
+                                     << h5_child_id);
         }
-        default:
+        else
         {
-            // unsupported
+            CONDUIT_HDF5_WARN(ref_path,
+                               "DataType \'" 
+                               << DataType::id_to_name(dt.id())
+                               <<"\' not supported for relay HDF5 I/O");
         }
     }
-
-    return h5_return_val;
+}
+
+
+
+//---------------------------------------------------------------------------//
+// assumes compatible, dispatches to proper specific write
+//---------------------------------------------------------------------------//
+void
+write_conduit_node_to_hdf5_tree(const Node &node,
+                                const std::string &ref_path,
+                                hid_t hdf5_id,
+                                const HDF5WriteOptions &opts)
+{
+
+    DataType dt = node.dtype();
+    // we support a leaf or a group 
+    if(dt.is_number() || dt.is_string())
+    {
+        write_conduit_leaf_to_hdf5_dataset(node,
+                                           ref_path,
+                                           hdf5_id,
+                                           opts.node());
+    }
+    else if(dt.is_object())
+    {
+        write_conduit_object_to_hdf5_group(node,
+                                           ref_path,
+                                           hdf5_id,
+                                           opts);
+    }
+    else // not supported
+    {
+        std::string hdf5_err_ref_path;
+        hdf5_ref_path_with_filename(hdf5_id, ref_path, hdf5_err_ref_path);
+        CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                   "HDF5 write doesn't support LIST_ID or EMPTY_ID nodes.");
+    }
+}
+
+
+
+//---------------------------------------------------------------------------//
+// Read Helpers
+//---------------------------------------------------------------------------//
+
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+/// Data structures and callbacks that allow us to read an HDF5 hierarchy 
+/// via H5Literate 
+/// (adapted from: h5ex_g_traverse)
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+/// 
+/// I also reviewed / partially tried the seemingly more straight forward 
+/// approach in:
+///  https://www.hdfgroup.org/ftp/HDF5/examples/misc-examples/h5_info.c
+///
+/// But since H5Gget_objtype_by_idx and H5Gget_objname_by_idx are deprecated
+/// there in favor of H5Lget_name_by_idx & H5Oget_info_by_idx, there isn't a
+/// direct way to check for links which could create cycles.
+/// 
+/// It appears that the H5Literate method (as demonstrated in the
+/// h5ex_g_traverse example) is the preferred way to read an hdf5 location
+/// hierarchically, even if it seems overly complex.
+///
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+/// Operator struct type for our H5Literate callback.
+/// (adapted from: h5ex_g_traverse)
+//---------------------------------------------------------------------------//
+//
+// Define operator data structure type for H5Literate callback.
+// During recursive iteration, these structures will form a
+// linked list that can be searched for duplicate groups,
+// preventing infinite recursion.
+//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// For conduit+relay: Added a pointer to hold a conduit node for construction.
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//
+//---------------------------------------------------------------------------//
+struct h5_read_opdata
+{
+    unsigned                recurs;      /* Recursion level.  0=root */
+    struct h5_read_opdata   *prev;        /* Pointer to previous opdata */
+    haddr_t                 addr;        /* Group address */
+
+    // pointer to conduit node, anchors traversal to 
+    Node            *node;
+    // for schema only reads, pointer to the schema we are 
+    // building (NULL when reading data into node)
+    Schema          *schema;
+    std::string      ref_path;
+    // read options (hyperslab selection applied to each dataset)
+    const Node      *opts;
+};
+
+//---------------------------------------------------------------------------//
+/// Recursive check for cycles.
+/// (adapted from: h5ex_g_traverse)
+//---------------------------------------------------------------------------//
+//
+//  This function recursively searches the linked list of
+//  h5_read_opdata structures for one whose address matches
+//  target_addr.  Returns 1 if a match is found, and 0
+//  otherwise.
+//---------------------------------------------------------------------------//
+int
+h5_group_check(h5_read_opdata *od,
+               haddr_t target_addr)
+{
+    if (od->addr == target_addr)
+    {
+        /* Addresses match */
+        return 1;
+    }
+    else if (!od->recurs)
+    {
+        /* Root group reached with no matches */
+        return 0;
+    }
+    else
+    {
+        /* Recursively examine the next node */
+        return h5_group_check(od->prev, target_addr);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/// Our main callback for H5Literate.
+/// (adapted from: h5ex_g_traverse)
+//---------------------------------------------------------------------------//
+//  Operator function.  This function prints the name and type
+//  of the object passed to it.  If the object is a group, it
+//  is first checked against other groups in its path using
+//  the group_check function, then if it is not a duplicate,
+//  H5Literate is called for that group.  This guarantees that
+//  the program will not enter infinite recursion due to a
+//  circular path in the file.
+//---------------------------------------------------------------------------//
+herr_t
+h5l_iterate_traverse_op_func(hid_t hdf5_id,
+                             const char *hdf5_path,
+                             const H5L_info_t *,// hdf5_info -- unused
+                             void *hdf5_operator_data)
+{
+    herr_t h5_status = 0;
+    herr_t h5_return_val = 0;
+    H5O_info_t h5_info_buf;
+
+    /* Type conversion */
+    struct h5_read_opdata *h5_od = (struct h5_read_opdata*)hdf5_operator_data;
+
+
+    /*
+     * Get type of the object and display its name and type.
+     * The name of the object is passed to this function by
+     * the Library.
+     */
+    h5_status = H5Oget_info_by_name(hdf5_id,
+                                    hdf5_path,
+                                    &h5_info_buf,
+                                    H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    h5_od->ref_path,
+                                           "Error fetching HDF5 Object info: "
+                                           << " parent: " << hdf5_id 
+                                           << " path:"    << hdf5_path) ;
+
+    std::string chld_ref_path = h5_od->ref_path  + 
+                                std::string("/") + 
+                                std::string(hdf5_path);
+    switch (h5_info_buf.type)
+    {
+        case H5O_TYPE_GROUP:
+        {
+            /*
+             * Check group address against linked list of operator
+             * data structures.  We will always run the check, as the
+             * reference count cannot be relied upon if there are
+             * symbolic links, and H5Oget_info_by_name always follows
+             * symbolic links.  Alternatively we could use H5Lget_info
+             * and never recurse on groups discovered by symbolic
+             * links, however it could still fail if an object's
+             * reference count was manually manipulated with
+             * H5Odecr_refcount.
+             */
+            if ( h5_group_check (h5_od, h5_info_buf.addr) )
+            {
+                // skip cycles in the graph ...
+            }
+            else
+            {
+                hid_t h5_group_id = H5Gopen(hdf5_id,
+                                           hdf5_path,
+                                           H5P_DEFAULT);
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_group_id,
+                                                                hdf5_id,
+                                                                h5_od->ref_path,
+                                                       "Error opening HDF5 "
+                                                       << "Group: " 
+                                                       << " parent: "
+                                                       << hdf5_id 
+                                                       << " path:"
+                                                       << hdf5_path);
+
+                // execute traversal for this group
+                if(h5_od->schema != NULL)
+                {
+                    Schema &chld_schema = h5_od->schema->fetch(hdf5_path);
+                    read_hdf5_group_into_conduit_schema(h5_group_id,
+                                                        chld_ref_path,
+                                                        chld_schema);
+                }
+                else
+                {
+                    Node &chld_node = h5_od->node->fetch(hdf5_path);
+                    read_hdf5_group_into_conduit_node(h5_group_id,
+                                                      chld_ref_path,
+                                                      *h5_od->opts,
+                                                      chld_node);
+                }
+
+                // close the group
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_group_id),
+                                                                hdf5_id,
+                                                                h5_od->ref_path,
+                                                       "Error closing HDF5 "
+                                                       << "Group: "
+                                                       << h5_group_id);
+            }
+            break;
+        }
+        case H5O_TYPE_DATASET:
+        {
+            // open hdf5 dataset at path
+            hid_t h5_dset_id = H5Dopen(hdf5_id,
+                                       hdf5_path,
+                                       H5P_DEFAULT);
+
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                            hdf5_id,
+                                                            h5_od->ref_path,
+                                                   "Error opening HDF5 "
+                                                   << " Dataset: " 
+                                                   << " parent: "
+                                                   << hdf5_id 
+                                                   << " path:"
+                                                   << hdf5_path);
+
+            if(h5_od->schema != NULL)
+            {
+                Schema &leaf_schema = h5_od->schema->fetch(hdf5_path);
+                read_hdf5_dataset_into_conduit_schema(h5_dset_id,
+                                                      chld_ref_path,
+                                                      leaf_schema);
+            }
+            else
+            {
+                Node &leaf = h5_od->node->fetch(hdf5_path);
+                read_hdf5_dataset_into_conduit_node(h5_dset_id,
+                                                    chld_ref_path,
+                                                    *h5_od->opts,
+                                                    leaf);
+            }
+            
+            // close the dataset
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                            hdf5_id,
+                                                            h5_od->ref_path,
+                                                   "Error closing HDF5 "
+                                                   << " Dataset: " 
+                                                   << h5_dset_id);
+            break;
+        }
+        default:
+        {
+            // unsupported
+        }
+    }
+
+    return h5_return_val;
+}
+
+
+//---------------------------------------------------------------------------//
+// Traverses the children of a group with H5Literate, using creation order
+// when the group tracks it.
+//---------------------------------------------------------------------------//
+void
+iterate_hdf5_group(hid_t hdf5_group_id,
+                   const std::string &ref_path,
+                   h5_read_opdata &h5_od)
+{
+    // get info, we need to get the obj addr for cycle tracking
+    H5O_info_t h5_info_buf;
+    herr_t h5_status = H5Oget_info(hdf5_group_id,
+                                   &h5_info_buf);
+
+    // setup linked list tracking that allows us to detect cycles
+    h5_od.recurs = 0;
+    h5_od.prev = NULL;
+    h5_od.addr = h5_info_buf.addr;
+
+    H5_index_t h5_grp_index_type = H5_INDEX_NAME;
+    
+    // check for creation order index using propertylist
+
+    hid_t h5_gc_plist = H5Gget_create_plist(hdf5_group_id);
+
+    if( CONDUIT_HDF5_VALID_ID(h5_gc_plist) )
+    {
+        unsigned int h5_gc_flags = 0;
+        h5_status = H5Pget_link_creation_order(h5_gc_plist,
+                                           &h5_gc_flags);
+
+        // first make sure we have the link creation order plist
+        if( CONDUIT_HDF5_STATUS_OK(h5_status) )
+        {
+            // check that we have both order_tracked and order_indexed
+            if( h5_gc_flags & (H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) )
+            {
+                // if so, we can use creation order in h5literate
+                h5_grp_index_type = H5_INDEX_CRT_ORDER;
+            }
+        }
+    
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_gc_plist),
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                               "Failed to close HDF5 "
+                                               << "H5P_GROUP_CREATE "
+                                               << "property list: " 
+                                               << h5_gc_plist);
+    }
+    
+    
+
+    // use H5Literate to traverse
+    h5_status = H5Literate(hdf5_group_id,
+                           h5_grp_index_type,
+                           H5_ITER_INC,
+                           NULL,
+                           h5l_iterate_traverse_op_func,
+                           (void *) &h5_od);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Error calling H5Literate to "
+                                           << "traverse and read HDF5 "
+                                           << "hierarchy: "
+                                           << hdf5_group_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
+                                  const std::string &ref_path,
+                                  const Node &opts,
+                                  Node &dest)
+{
+    // we want to make sure this is a conduit object
+    // even if it doesn't have any children
+    dest.set(DataType::object());
+
+    // setup the callback struct we will use for  H5Literate
+    struct h5_read_opdata  h5_od;
+    // attach the pointer to our node
+    h5_od.node = &dest;
+    h5_od.schema = NULL;
+    // keep ref path
+    h5_od.ref_path = ref_path;
+    // options are passed on to each dataset read
+    h5_od.opts = &opts;
+
+    iterate_hdf5_group(hdf5_group_id,
+                       ref_path,
+                       h5_od);
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_group_into_conduit_schema(hid_t hdf5_group_id,
+                                    const std::string &ref_path,
+                                    Schema &dest)
+{
+    // we want to make sure this is a conduit object
+    // even if it doesn't have any children
+    dest.set(DataType::object());
+
+    // setup the callback struct we will use for  H5Literate
+    Node opts;
+    struct h5_read_opdata  h5_od;
+    h5_od.node = NULL;
+    // attach the pointer to our schema
+    h5_od.schema = &dest;
+    // keep ref path
+    h5_od.ref_path = ref_path;
+    h5_od.opts = &opts;
+
+    iterate_hdf5_group(hdf5_group_id,
+                       ref_path,
+                       h5_od);
+}
+
+//---------------------------------------------------------------------------//
+// Reads one of the hyperslab options ("offset", "stride", "count" or 
+// "dims"). The option can be a single number (for 1-D datasets) or an 
+// array with one value per dataset dimension.
+//---------------------------------------------------------------------------//
+void
+hdf5_hyperslab_option(const Node &opts,
+                      const std::string &opt_name,
+                      int rank,
+                      const std::string &ref_path,
+                      std::vector<hsize_t> &res)
+{
+    const Node &opt = opts[opt_name];
+
+    if( !opt.dtype().is_number() ||
+        opt.dtype().number_of_elements() != rank )
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Option \"" << opt_name << "\" must be a "
+                           << "number (1-D datasets) or an array with one "
+                           << "value per dataset dimension "
+                           << "(dataset rank: " << rank << ")");
+    }
+
+    Node n_vals;
+    opt.to_int64_array(n_vals);
+    int64_array vals = n_vals.value();
+
+    for(int d = 0; d < rank; d++)
+    {
+        if(vals[d] < 0)
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Option \"" << opt_name << "\" must "
+                               << "not be negative: " << opt.to_json());
+        }
+        res[d] = (hsize_t) vals[d];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Selects the elements described by the "offset", "stride" and "count" 
+// read options in the passed dataspace (H5Sselect_hyperslab). 
+// Returns false, without changing the selection, if none of these 
+// options were passed.
+//---------------------------------------------------------------------------//
+bool
+hdf5_select_hyperslab(hid_t hdf5_dspace_id,
+                      const Node &opts,
+                      const std::string &ref_path)
+{
+    if( !opts.has_child("offset") &&
+        !opts.has_child("stride") &&
+        !opts.has_child("count") )
+    {
+        return false;
+    }
+
+    int rank = H5Sget_simple_extent_ndims(hdf5_dspace_id);
+
+    if(rank < 1)
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Cannot select a hyperslab from a dataset "
+                           "with a scalar dataspace");
+    }
+
+    std::vector<hsize_t> dims(rank,0);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(
+                        H5Sget_simple_extent_dims(hdf5_dspace_id,
+                                                  &dims[0],
+                                                  NULL),
+                        ref_path,
+                        "Error reading HDF5 Dataspace dimensions: "
+                        << hdf5_dspace_id);
+
+    // defaults: start at 0, select every element up to the end of 
+    // each dimension
+    std::vector<hsize_t> offset(rank,0);
+    std::vector<hsize_t> stride(rank,1);
+    std::vector<hsize_t> count(rank,0);
+
+    if(opts.has_child("offset"))
+    {
+        hdf5_hyperslab_option(opts,"offset",rank,ref_path,offset);
+    }
+
+    if(opts.has_child("stride"))
+    {
+        hdf5_hyperslab_option(opts,"stride",rank,ref_path,stride);
+    }
+
+    for(int d = 0; d < rank; d++)
+    {
+        if(stride[d] == 0)
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Read option \"stride\" must be > 0");
+        }
+
+        if(offset[d] > dims[d])
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Read option \"offset\" (" << offset[d]
+                               << ") is out of bounds for dimension " << d
+                               << " of size " << dims[d]);
+        }
+
+        count[d] = (dims[d] - offset[d] + stride[d] - 1) / stride[d];
+    }
+
+    if(opts.has_child("count"))
+    {
+        hdf5_hyperslab_option(opts,"count",rank,ref_path,count);
+    }
+
+    bool sel_empty = false;
+
+    for(int d = 0; d < rank; d++)
+    {
+        if(count[d] == 0)
+        {
+            sel_empty = true;
+        }
+        else if( offset[d] + (count[d] - 1) * stride[d] >= dims[d] )
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Hyperslab (offset: " << offset[d]
+                               << ", stride: " << stride[d]
+                               << ", count: " << count[d]
+                               << ") is out of bounds for dimension " << d
+                               << " of size " << dims[d]);
+        }
+    }
+
+    herr_t h5_status = 0;
+
+    if(sel_empty)
+    {
+        h5_status = H5Sselect_none(hdf5_dspace_id);
+    }
+    else
+    {
+        h5_status = H5Sselect_hyperslab(hdf5_dspace_id,
+                                        H5S_SELECT_SET,
+                                        &offset[0],
+                                        &stride[0],
+                                        &count[0],
+                                        NULL);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_REF_PATH(h5_status,
+                                           ref_path,
+                                           "Error selecting hyperslab from "
+                                           "HDF5 Dataspace: "
+                                           << hdf5_dspace_id);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
+                                    const std::string &ref_path,
+                                    const Node &opts,
+                                    Node &dest)
+{
+    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error reading HDF5 Dataspace: " 
+                                           << hdf5_dset_id);
+
+    // check for empty case
+    if(H5Sget_simple_extent_type(h5_dspace_id) == H5S_NULL)
+    {
+        // change to empty
+        dest.reset();
+    }
+    else
+    {
+        hid_t h5_dtype_id  = H5Dget_type(hdf5_dset_id); 
+    
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error reading HDF5 Datatype: "
+                                               << hdf5_dset_id);
+
+        index_t nelems     = H5Sget_simple_extent_npoints(h5_dspace_id);
+
+        // the file and memory dataspaces used for H5Dread
+        // for hyperslab reads, the selected elements are read into
+        // a compact 1-D memory dataspace
+        hid_t h5_file_dspace_id = H5S_ALL;
+        hid_t h5_mem_dspace_id  = H5S_ALL;
+        bool  h5_sel_empty      = false;
+
+        if(hdf5_select_hyperslab(h5_dspace_id,opts,ref_path))
+        {
+            // string sizes are part of the hdf5 type, we can't
+            // select a part of a string
+            if( H5Tget_class(h5_dtype_id) == H5T_STRING )
+            {
+                CONDUIT_HDF5_ERROR(ref_path,
+                                   "Cannot read a hyperslab of a string "
+                                   "dataset");
+            }
+
+            hsize_t sel_nelems = (hsize_t)
+                                    H5Sget_select_npoints(h5_dspace_id);
+            nelems = (index_t) sel_nelems;
+            h5_sel_empty = (nelems == 0);
+
+            if(!h5_sel_empty)
+            {
+                h5_mem_dspace_id = H5Screate_simple(1,
+                                                    &sel_nelems,
+                                                    NULL);
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                                    h5_mem_dspace_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                 "Failed to create HDF5 Dataspace "
+                                 "(memory dspace)");
+                h5_file_dspace_id = h5_dspace_id;
+            }
+        }
+
+        // Note: string case is handed properly in hdf5_dtype_to_conduit_dtype
+        DataType dt        = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
+                                                         nelems,
+                                                         ref_path);
+
+        // if the endianness of the dset in the file doesn't
+        // match the current machine we always want to convert it
+        // on read.
+
+        // check endianness
+        // Note: string cases never land here b/c they are 
+        // created with default endianness
+        if(!dt.endianness_matches_machine())
+        {
+            // if they don't match, modify the dt
+            // and get the proper hdf5 data type handle
+            dt.set_endianness(Endianness::machine_default());
+            
+            // clean up our old handle
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
+                                                            hdf5_dset_id,
+                                                            ref_path,
+                                        "Error closing HDF5 Datatype: "
+                                        << h5_dtype_id);
+
+            // get ref to standard variant of this dtype
+            h5_dtype_id  = conduit_dtype_to_hdf5_dtype(dt,
+                                                       ref_path);
+
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
+                                                            hdf5_dset_id,
+                                                            ref_path,
+                                        "Error creating HDF5 Datatype");
+
+            // copy since the logic after read will cleanup
+            h5_dtype_id  = H5Tcopy(h5_dtype_id);
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
+                                                            hdf5_dset_id,
+                                                            ref_path,
+                                        "Error copying HDF5 Datatype");
+            // cleanup our ref from conduit_dtype_to_hdf5_dtype if necessary
+            conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
+        }
+
+
+        hid_t h5_status    = 0;
+
+        // check for string special case, H5T_VARIABLE string
+        if( H5Tis_variable_str(h5_dtype_id) )
+        {
+            //special case for reading variable string data
+            // hdf5 reads the data onto its heap, and 
+            // gives us a pointer to that location
+
+            char *read_ptr[1] = {NULL};
+            h5_status = H5Dread(hdf5_dset_id,
+                                h5_dtype_id,
+                                h5_mem_dspace_id,
+                                h5_file_dspace_id,
+                                H5P_DEFAULT,
+                                read_ptr);
+
+            // copy the data out to the conduit node
+            dest.set_string(read_ptr[0]);
+        }
+        // check for bad # of elements
+        else if( dt.number_of_elements() < 0 )
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                                "Cannot read dataset with # of elements < 0");
+        }
+        // an empty hyperslab selection, there is nothing to read
+        else if( h5_sel_empty )
+        {
+            dest.set(dt);
+        }
+        else if(dest.dtype().is_compact() &&
+           dest.dtype().compatible(dt) )
+        {
+            // we can read directly from hdf5 dataset if compact 
+            // & compatible
+            h5_status = H5Dread(hdf5_dset_id,
+                                h5_dtype_id,
+                                h5_mem_dspace_id,
+                                h5_file_dspace_id,
+                                H5P_DEFAULT,
+                                dest.data_ptr());
+        }
+        else
+        {
+            // we create a temp Node b/c we want read to work for 
+            // strided data
+            // 
+            // the hdf5 data will always be compact, source node we are 
+            // reading will not unless it's already compatible and compact.
+            Node n_tmp(dt);
+            h5_status = H5Dread(hdf5_dset_id,
+                                h5_dtype_id,
+                                h5_mem_dspace_id,
+                                h5_file_dspace_id,
+                                H5P_DEFAULT,
+                                n_tmp.data_ptr());
+        
+            // copy out to our dest
+            dest.set(n_tmp);
+        }
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error reading HDF5 Dataset: "
+                                                << hdf5_dset_id);
+    
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error closing HDF5 Datatype: "
+                                               << h5_dtype_id);
+
+        if(h5_mem_dspace_id != H5S_ALL)
+        {
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                                H5Sclose(h5_mem_dspace_id),
+                                                hdf5_dset_id,
+                                                ref_path,
+                                 "Error closing HDF5 Dataspace "
+                                 "(memory dspace): " << h5_mem_dspace_id);
+        }
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error closing HDF5 Dataspace: "
+                                           << h5_dspace_id);
+
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
+                                 const std::string &ref_path,
+                                 const Node &opts,
+                                 Node &dest)
+{
+    herr_t     h5_status = 0;
+    H5O_info_t h5_info_buf;
+    
+    h5_status = H5Oget_info(hdf5_id,&h5_info_buf);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    ref_path,
+                                           "Error fetching HDF5 object "
+                                           << "info from: " 
+                                           << hdf5_id);
+
+    switch (h5_info_buf.type)
+    {
+        // if hdf5_id + hdf5_path points to a group,
+        // use a H5Literate traversal
+        case H5O_TYPE_GROUP:
+        {
+            read_hdf5_group_into_conduit_node(hdf5_id,
+                                              ref_path,
+                                              opts,
+                                              dest);
+            break;
+        }
+        // if hdf5_id + hdf5_path points directly to a dataset
+        // skip the H5Literate traversal
+        case H5O_TYPE_DATASET:
+        {
+            read_hdf5_dataset_into_conduit_node(hdf5_id,
+                                                ref_path,
+                                                opts,
+                                                dest);
+            break;
+        }
+        // unsupported types
+        case H5O_TYPE_UNKNOWN:
+        {
+            // we only construct these strings 
+            // when an error occurs, to avoid overhead
+            // for healthy fetches
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                               "Cannot read HDF5 Object : "
+                                << "(type == H5O_TYPE_UNKNOWN )");
+            break;
+        }
+        case H5O_TYPE_NAMED_DATATYPE:
+        {
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                               "Cannot read HDF5 Object "
+                               << "(type == H5O_TYPE_NAMED_DATATYPE )");
+            break;
+        }
+        case H5O_TYPE_NTYPES:
+        {
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+              "Cannot read HDF5 Object "
+               << "(type == H5O_TYPE_NTYPES [This is an invalid HDF5 type!]");
+            break;
+        }
+        default:
+        {
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(hdf5_id,
+                                        ref_path,
+                                        hdf5_err_ref_path);
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                               "Cannot read HDF5 Object (type == Unknown )");
+        }
+    }
+}
+
+
+
+//---------------------------------------------------------------------------//
+// Describes a dataset using only its dataspace and datatype, no data
+// is read. The resulting dtype matches what a read of the dataset
+// would produce (data is converted to the machine's endianness on read).
+//---------------------------------------------------------------------------//
+void
+read_hdf5_dataset_into_conduit_schema(hid_t hdf5_dset_id,
+                                      const std::string &ref_path,
+                                      Schema &dest)
+{
+    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error reading HDF5 Dataspace: " 
+                                           << hdf5_dset_id);
+
+    // check for empty case
+    if(H5Sget_simple_extent_type(h5_dspace_id) == H5S_NULL)
+    {
+        dest.set(DataType::empty());
+    }
+    else
+    {
+        hid_t h5_dtype_id  = H5Dget_type(hdf5_dset_id); 
+    
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error reading HDF5 Datatype: "
+                                               << hdf5_dset_id);
+
+        index_t nelems = H5Sget_simple_extent_npoints(h5_dspace_id);
+
+        // variable length strings don't store their length in the 
+        // datatype, this is the one case where we need to read the data
+        if( H5Tis_variable_str(h5_dtype_id) )
+        {
+            Node n_str;
+            Node opts;
+            read_hdf5_dataset_into_conduit_node(hdf5_dset_id,
+                                                ref_path,
+                                                opts,
+                                                n_str);
+            dest.set(n_str.dtype());
+        }
+        else
+        {
+            DataType dt = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
+                                                      nelems,
+                                                      ref_path);
+
+            if(!dt.endianness_matches_machine())
+            {
+                dt.set_endianness(Endianness::machine_default());
+            }
+
+            dest.set(dt);
+        }
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error closing HDF5 Datatype: "
+                                               << h5_dtype_id);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error closing HDF5 Dataspace: "
+                                           << h5_dspace_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_tree_into_conduit_schema(hid_t hdf5_id,
+                                   const std::string &ref_path,
+                                   Schema &dest)
+{
+    H5O_info_t h5_info_buf;
+
+    herr_t h5_status = H5Oget_info(hdf5_id,&h5_info_buf);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    ref_path,
+                                           "Error fetching HDF5 object "
+                                           << "info from: " 
+                                           << hdf5_id);
+
+    if(h5_info_buf.type == H5O_TYPE_GROUP)
+    {
+        read_hdf5_group_into_conduit_schema(hdf5_id,
+                                            ref_path,
+                                            dest);
+    }
+    else if(h5_info_buf.type == H5O_TYPE_DATASET)
+    {
+        read_hdf5_dataset_into_conduit_schema(hdf5_id,
+                                              ref_path,
+                                              dest);
+    }
+    else
+    {
+        // unsupported types (named datatypes, etc)
+        std::string hdf5_err_ref_path;
+        hdf5_ref_path_with_filename(hdf5_id,
+                                    ref_path,
+                                    hdf5_err_ref_path);
+        CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                           "Cannot read schema of HDF5 Object "
+                           << "(type == " << h5_info_buf.type << ")");
+    }
+}
+
+
+//---------------------------------------------------------------------------//
+hid_t
+create_hdf5_file_access_plist()
+{
+    // create property list and set use latest lib ver settings 
+    hid_t h5_fa_props = H5Pcreate(H5P_FILE_ACCESS);
+    
+    CONDUIT_CHECK_HDF5_ERROR(h5_fa_props,
+                             "Failed to create H5P_FILE_ACCESS "
+                             << " property list");
+    
+    unsigned int major_num=0;
+    unsigned int minor_num=0;
+    unsigned int release_num=0;
+    
+    herr_t h5_status = H5get_libversion(&major_num, &minor_num,&release_num);
+    
+    CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                             "Failed to fetch HDF5 library version info ");
+
+    // most of our use cases are still using 1.8.
+    // to allow hdf5 1.8 readers to read from hdf5 1.10 writers,
+    // we want to pin to hdf5 1.8 features for now. 
+    // There isn't a way to select 1.8, 
+    // https://forum.hdfgroup.org/t/seconding-the-request-for-h5pset-libver-bounds-1-8-x-file-compat-option/4056
+    // so only enable H5F_LIBVER_LATEST if we are using hdf5 1.8
+
+    if(major_num == 1 && minor_num == 8)
+    {
+        h5_status = H5Pset_libver_bounds(h5_fa_props,
+                                         H5F_LIBVER_LATEST,
+                                         H5F_LIBVER_LATEST);
+
+        CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                 "Failed to set libver options for "
+                                 << "property list " << h5_fa_props);
+
+    }
+    return h5_fa_props;
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+create_hdf5_file_create_plist()
+{
+    // create property list and set it to preserve creation order
+    hid_t h5_fc_props = H5Pcreate(H5P_FILE_CREATE);
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_fc_props,
+                             "Failed to create H5P_FILE_CREATE "
+                             << " property list");
+
+    herr_t h5_status = H5Pset_link_creation_order(h5_fc_props, 
+            ( H5P_CRT_ORDER_TRACKED |  H5P_CRT_ORDER_INDEXED) );
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                             "Failed to set creation order options for "
+                             << "property list " << h5_fc_props);
+    return h5_fc_props;
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Public interface: Write Methods
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+hid_t
+hdf5_create_file(const std::string &file_path)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+        
+    hid_t h5_fc_plist = create_hdf5_file_create_plist();
+    hid_t h5_fa_plist = create_hdf5_file_access_plist();
+
+    // open the hdf5 file for writing
+    hid_t h5_file_id = H5Fcreate(file_path.c_str(),
+                                 H5F_ACC_TRUNC,
+                                 h5_fc_plist,
+                                 h5_fa_plist);
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                             "Error opening HDF5 file for writing: " 
+                             << file_path);
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fc_plist),
+                             "Failed to close HDF5 H5P_GROUP_CREATE "
+                             << "property list: " << h5_fc_plist);
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
+                             "Failed to close HDF5 H5P_FILE_ACCESS "
+                             << "property list: " << h5_fa_plist);
+    
+    return h5_file_id;
+    
+    // enable hdf5 error stack
+}
+
+//-----------------------------------------------------------------------------
+void
+hdf5_close_file(hid_t hdf5_id)
+{
+    // close the hdf5 file
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(hdf5_id),
+                             "Error closing HDF5 file handle: " << hdf5_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           hid_t hdf5_id,
+           const std::string &hdf5_path)
+{
+    Node opts;
+    hdf5_write(node,
+               hdf5_id,
+               hdf5_path,
+               opts);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           hid_t hdf5_id,
+           const std::string &hdf5_path,
+           const Node &opts)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    // TODO: we only want to support abs paths if hdf5_id is a file
+    // if ( (not hdf5 file) && 
+    //      (hdf5_path.size() > 0) && 
+    //      (hdf5_path[0] == "/") )
+    //{
+    //    CONDUIT_ERROR("HDF5 id must represent a file to use a HDF5 "
+    ///                 "absolute path (a path starts with '/'");
+    //}
+
+    // after this check strip leading forward and trailing slashes
+    // if the exist
+
+    size_t pos = 0;
+    size_t len = hdf5_path.size();
+
+    if( (hdf5_path.size() > 0) && 
+        (hdf5_path[0] == '/' ) )
+    {
+        pos = 1;
+        len--;
+    }
+    
+    // only trim right side if we are sure there is more than one char
+    // (avoid "/" case, which would already have been trimmed )
+    if( (hdf5_path.size() > 1 ) && 
+        (hdf5_path[hdf5_path.size()-1] == '/') )
+    {
+        len--;
+    }
+    
+    std::string path = hdf5_path.substr(pos,len);
+    
+    // TODO: Creating the external tree is inefficient but the compatibility 
+    // checks and write methods handle node paths easily handle this case.
+    // revisit if this is too slow
+    
+    Node n;
+    if(path.size() > 0)
+    {
+        // strong dose of evil casting, but it's ok b/c we are grownups here?
+        // time we will tell ...
+        n.fetch(path).set_external(const_cast<Node&>(node));
+    }
+    else
+    {
+        // strong dose of evil casting, but it's ok b/c we are grownups here?
+        // time we will tell ...
+        n.set_external(const_cast<Node&>(node));
+    }
+
+    // check compat
+    if(check_if_conduit_node_is_compatible_with_hdf5_tree(n,
+                                                          "",
+                                                          hdf5_id,
+                                                          opts))
+    {
+        // write if we are compat
+        HDF5WriteOptions write_opts(opts,path);
+        write_conduit_node_to_hdf5_tree(n,"",hdf5_id,write_opts);
+    }
+    else
+    {
+        std::string hdf5_error_ref_path;
+        hdf5_ref_path_with_filename(hdf5_id,
+                                    hdf5_path,
+                                    hdf5_error_ref_path);
+
+        CONDUIT_ERROR("Failed to write node to " 
+                      << "\"" << hdf5_error_ref_path << "\", "
+                      << "existing HDF5 tree is "
+                      << "incompatible with the Conduit Node.");
+    }
+
+    // restore hdf5 error stack
+}
+
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           hid_t hdf5_id)
+{
+    Node opts;
+    hdf5_write(node,
+               hdf5_id,
+               opts);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           hid_t hdf5_id,
+           const Node &opts)
+{
+    // disable hdf5 error stack
+    // TODO: we may only need to use this in an outer level variant
+    // of check_if_conduit_node_is_compatible_with_hdf5_tree
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+    
+    // check compat
+    if(check_if_conduit_node_is_compatible_with_hdf5_tree(node,
+                                                          "",
+                                                          hdf5_id,
+                                                          opts))
+    {
+        // write if we are compat
+        HDF5WriteOptions write_opts(opts,"");
+        write_conduit_node_to_hdf5_tree(node,
+                                        "",
+                                        hdf5_id,
+                                        write_opts);
+    }
+    else
+    {
+        std::string hdf5_fname;
+        hdf5_filename_from_hdf5_obj_id(hdf5_id, hdf5_fname);
+
+        CONDUIT_ERROR("Failed to write node to " 
+                      << "\"" << hdf5_fname << "\", "
+                      << "existing HDF5 tree is "
+                      << "incompatible with the Conduit Node.");
+    }
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void 
+hdf5_save(const Node &node,
+          const std::string &path)
+{
+    hdf5_write(node,path,false);
+}
+
+//---------------------------------------------------------------------------//
+void 
+hdf5_save(const Node &node,
+          const std::string &path,
+          const Node &opts)
+{
+    hdf5_write(node,path,opts,false);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_save(const Node &node,
+          const std::string &file_path,
+          const std::string &hdf5_path)
+{
+    hdf5_write(node,file_path,hdf5_path,false);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_save(const Node &node,
+          const std::string &file_path,
+          const std::string &hdf5_path,
+          const Node &opts)
+{
+    hdf5_write(node,file_path,hdf5_path,opts,false);
+}
+
+//---------------------------------------------------------------------------//
+void 
+hdf5_append(const Node &node,
+            const std::string &path)
+{
+    hdf5_write(node,path,true);
+}
+
+//---------------------------------------------------------------------------//
+void 
+hdf5_append(const Node &node,
+            const std::string &path,
+            const Node &opts)
+{
+    hdf5_write(node,path,opts,true);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_append(const Node &node,
+            const std::string &file_path,
+            const std::string &hdf5_path)
+{
+    hdf5_write(node,file_path,hdf5_path,true);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_append(const Node &node,
+            const std::string &file_path,
+            const std::string &hdf5_path,
+            const Node &opts)
+{
+    hdf5_write(node,file_path,hdf5_path,opts,true);
+}
+
+//---------------------------------------------------------------------------//
+void 
+hdf5_write(const  Node &node,
+           const std::string &path,
+           bool append)
+{
+    Node opts;
+    hdf5_write(node,
+               path,
+               opts,
+               append);
+}
+
+//---------------------------------------------------------------------------//
+void 
+hdf5_write(const  Node &node,
+           const std::string &path,
+           const Node &opts,
+           bool append)
+{
+    // check for ":" split
+    std::string file_path;
+    std::string hdf5_path;
+
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    hdf5_path);
+
+    // we will write to the root if no hdf5_path is given.
+    // this should be fine for OBJECT_T, not sure about others ...
+    if(hdf5_path.size() == 0)
+    {
+        hdf5_path = "/";
+    }
+
+    hdf5_write(node,
+               file_path,
+               hdf5_path,
+               opts,
+               append);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           const std::string &file_path,
+           const std::string &hdf5_path,
+           bool append)
+{
+    Node opts;
+    hdf5_write(node,
+               file_path,
+               hdf5_path,
+               opts,
+               append);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_write(const Node &node,
+           const std::string &file_path,
+           const std::string &hdf5_path,
+           const Node &opts,
+           bool append)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    hid_t h5_file_id = -1;
+    if(append && utils::is_file(file_path))
+    {
+        // open existing hdf5 file for read + write
+        h5_file_id = hdf5_open_file_for_read_write(file_path);
+    }
+    else // trunc
+    {
+        // open the hdf5 file for writing
+        h5_file_id = hdf5_create_file(file_path);
+    }
+
+    hdf5_write(node,
+               h5_file_id,
+               hdf5_path,
+               opts);
+
+    // close the hdf5 file
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
+                             "Error closing HDF5 file: " << file_path);
+
+    // restore hdf5 error stack
+}
+
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Public interface: Read Methods
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+
+//---------------------------------------------------------------------------//
+hid_t
+hdf5_open_file_for_read(const std::string &file_path)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+    
+    hid_t h5_fa_plist = create_hdf5_file_access_plist();
+    
+    // open the hdf5 file for reading
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDONLY,
+                               h5_fa_plist);
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                             "Error opening HDF5 file for reading: " 
+                              << file_path);
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
+                             "Failed to close HDF5 H5P_FILE_ACCESS "
+                             << "property list: " << h5_fa_plist);
+    
+    return h5_file_id;
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+hdf5_open_file_for_read_write(const std::string &file_path)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    hid_t h5_fa_plist = create_hdf5_file_access_plist();
+    
+    // open the hdf5 file for read + write
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDWR,
+                               h5_fa_plist);
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                             "Error opening HDF5 file for reading: " 
+                              << file_path);
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
+                             "Failed to close HDF5 H5P_FILE_ACCESS "
+                             << "property list: " << h5_fa_plist);
+    
+    return h5_file_id;
+
+    // restore hdf5 error stack
+}
+
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(hid_t hdf5_id,
+          const std::string &hdf5_path,
+          Node &dest)
+{
+    Node opts;
+    hdf5_read(hdf5_id,
+              hdf5_path,
+              opts,
+              dest);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(hid_t hdf5_id,
+          const std::string &hdf5_path,
+          const Node &opts,
+          Node &dest)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+    
+    // get hdf5 object at path, then call read_hdf5_tree_into_conduit_node
+    hid_t h5_child_obj  = H5Oopen(hdf5_id,
+                                  hdf5_path.c_str(),
+                                  H5P_DEFAULT);
+    
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_obj,
+                                                    hdf5_id,
+                                                    hdf5_path,
+                            "Failed to fetch HDF5 object from: "
+                             << hdf5_id << ":" << hdf5_path);
+
+    read_hdf5_tree_into_conduit_node(h5_child_obj,
+                                     hdf5_path,
+                                     opts,
+                                     dest);
+    
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
+                                                    hdf5_id,
+                                                    hdf5_path,
+                             "Failed to close HDF5 Object: "
+                             << h5_child_obj);
+    
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(const std::string &file_path,
+          const std::string &hdf5_path,
+          Node &node)
+{
+    Node opts;
+    hdf5_read(file_path,
+              hdf5_path,
+              opts,
+              node);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(const std::string &file_path,
+          const std::string &hdf5_path,
+          const Node &opts,
+          Node &node)
+{
+    // note: hdf5 error stack is suppressed in these calls
+    
+    // open the hdf5 file for reading
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+
+    hdf5_read(h5_file_id,
+              hdf5_path,
+              opts,
+              node);
+    
+    // close the hdf5 file
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
+                             "Error closing HDF5 file: " << file_path);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(const std::string &path,
+          Node &node)
+{
+    Node opts;
+    hdf5_read(path,
+              opts,
+              node);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read(const std::string &path,
+          const Node &opts,
+          Node &node)
+{
+    // check for ":" split
+    std::string file_path;
+    std::string hdf5_path;
+    
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    hdf5_path);
+
+    // We will read the root if no hdf5_path is given.
+    if(hdf5_path.size() == 0)
+    {
+        hdf5_path = "/";
+    }
+    
+    // note: hdf5 error stack is suppressed in this call
+    hdf5_read(file_path,
+              hdf5_path,
+              opts,
+              node);
 }
 
 
 //---------------------------------------------------------------------------//
 void
-read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
-                                  const std::string &ref_path,
-                                  Node &dest)
+hdf5_read(hid_t hdf5_id,
+          Node &dest)
 {
-    // we want to make sure this is a conduit object
-    // even if it doesn't have any children
-    dest.set(DataType::object());
-    
-    
-    // get info, we need to get the obj addr for cycle tracking
-    H5O_info_t h5_info_buf;
-    herr_t h5_status = H5Oget_info(hdf5_group_id,
-                                   &h5_info_buf);
-
-    // setup the callback struct we will use for  H5Literate
-    struct h5_read_opdata  h5_od;
-    // setup linked list tracking that allows us to detect cycles
-    h5_od.recurs = 0;
-    h5_od.prev = NULL;
-    h5_od.addr = h5_info_buf.addr;
-    // attach the pointer to our node
-    h5_od.node = &dest;
-    // keep ref path
-    h5_od.ref_path = ref_path;
-
-    H5_index_t h5_grp_index_type = H5_INDEX_NAME;
-    
-    // check for creation order index using propertylist
-
-    hid_t h5_gc_plist = H5Gget_create_plist(hdf5_group_id);
-
-    if( CONDUIT_HDF5_VALID_ID(h5_gc_plist) )
-    {
-        unsigned int h5_gc_flags = 0;
-        h5_status = H5Pget_link_creation_order(h5_gc_plist,
-                                           &h5_gc_flags);
+    Node opts;
+    hdf5_read(hdf5_id,
+              opts,
+              dest);
+}
 
-        // first make sure we have the link creation order plist
-        if( CONDUIT_HDF5_STATUS_OK(h5_status) )
-        {
-            // check that we have both order_tracked and order_indexed
-            if( h5_gc_flags & (H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) )
-            {
-                // if so, we can use creation order in h5literate
-                h5_grp_index_type = H5_INDEX_CRT_ORDER;
-            }
-        }
-    
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Pclose(h5_gc_plist),
-                                                        hdf5_group_id,
-                                                        ref_path,
-                                               "Failed to close HDF5 "
-                                               << "H5P_GROUP_CREATE "
-                                               << "property list: " 
-                                               << h5_gc_plist);
-    }
+//---------------------------------------------------------------------------//
+void
+hdf5_read(hid_t hdf5_id,
+          const Node &opts,
+          Node &dest)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
     
+    read_hdf5_tree_into_conduit_node(hdf5_id,
+                                     "",
+                                     opts,
+                                     dest);
     
-
-    // use H5Literate to traverse
-    h5_status = H5Literate(hdf5_group_id,
-                           h5_grp_index_type,
-                           H5_ITER_INC,
-                           NULL,
-                           h5l_iterate_traverse_op_func,
-                           (void *) &h5_od);
-
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                    hdf5_group_id,
-                                                    ref_path,
-                                           "Error calling H5Literate to "
-                                           << "traverse and read HDF5 "
-                                           << "hierarchy: "
-                                           << hdf5_group_id);
+    // restore hdf5 error stack
 }
 
+
 //---------------------------------------------------------------------------//
 void
-read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
-                                    const std::string &ref_path,
-                                    Node &dest)
+hdf5_read_schema(hid_t hdf5_id,
+                 const std::string &hdf5_path,
+                 Schema &schema)
 {
-    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
-                                                    hdf5_dset_id,
-                                                    ref_path,
-                                           "Error reading HDF5 Dataspace: " 
-                                           << hdf5_dset_id);
-
-    // check for empty case
-    if(H5Sget_simple_extent_type(h5_dspace_id) == H5S_NULL)
-    {
-        // change to empty
-        dest.reset();
-    }
-    else
-    {
-        hid_t h5_dtype_id  = H5Dget_type(hdf5_dset_id); 
-    
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
-                                                        hdf5_dset_id,
-                                                        ref_path,
-                                               "Error reading HDF5 Datatype: "
-                                               << hdf5_dset_id);
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
 
-        index_t nelems     = H5Sget_simple_extent_npoints(h5_dspace_id);
+    hid_t h5_child_obj  = H5Oopen(hdf5_id,
+                                  hdf5_path.c_str(),
+                                  H5P_DEFAULT);
 
-        // Note: string case is handed properly in hdf5_dtype_to_conduit_dtype
-        DataType dt        = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
-                                                         nelems,
-                                                         ref_path);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_obj,
+                                                    hdf5_id,
+                                                    hdf5_path,
+                            "Failed to fetch HDF5 object from: "
+                             << hdf5_id << ":" << hdf5_path);
 
-        // if the endianness of the dset in the file doesn't
-        // match the current machine we always want to convert it
-        // on read.
+    Schema s_res;
+    read_hdf5_tree_into_conduit_schema(h5_child_obj,
+                                       hdf5_path,
+                                       s_res);
 
-        // check endianness
-        // Note: string cases never land here b/c they are 
-        // created with default endianness
-        if(!dt.endianness_matches_machine())
-        {
-            // if they don't match, modify the dt
-            // and get the proper hdf5 data type handle
-            dt.set_endianness(Endianness::machine_default());
-            
-            // clean up our old handle
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
-                                                            hdf5_dset_id,
-                                                            ref_path,
-                                        "Error closing HDF5 Datatype: "
-                                        << h5_dtype_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
+                                                    hdf5_id,
+                                                    hdf5_path,
+                             "Failed to close HDF5 Object: "
+                             << h5_child_obj);
 
-            // get ref to standard variant of this dtype
-            h5_dtype_id  = conduit_dtype_to_hdf5_dtype(dt,
-                                                       ref_path);
+    // give the result the same compact layout a read would produce
+    schema.reset();
+    s_res.compact_to(schema);
 
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
-                                                            hdf5_dset_id,
-                                                            ref_path,
-                                        "Error creating HDF5 Datatype");
+    // restore hdf5 error stack
+}
 
-            // copy since the logic after read will cleanup
-            h5_dtype_id  = H5Tcopy(h5_dtype_id);
-            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
-                                                            hdf5_dset_id,
-                                                            ref_path,
-                                        "Error copying HDF5 Datatype");
-            // cleanup our ref from conduit_dtype_to_hdf5_dtype if necessary
-            conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
-        }
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(hid_t hdf5_id,
+                 Schema &schema)
+{
+    hdf5_read_schema(hdf5_id,"/",schema);
+}
 
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(const std::string &file_path,
+                 const std::string &hdf5_path,
+                 Schema &schema)
+{
+    // note: hdf5 error stack is suppressed in these calls
 
-        hid_t h5_status    = 0;
+    // open the hdf5 file for reading
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
 
-        // check for string special case, H5T_VARIABLE string
-        if( H5Tis_variable_str(h5_dtype_id) )
-        {
-            //special case for reading variable string data
-            // hdf5 reads the data onto its heap, and 
-            // gives us a pointer to that location
+    hdf5_read_schema(h5_file_id,
+                     hdf5_path,
+                     schema);
 
-            char *read_ptr[1] = {NULL};
-            h5_status = H5Dread(hdf5_dset_id,
-                                h5_dtype_id,
-                                H5S_ALL,
-                                H5S_ALL,
-                                H5P_DEFAULT,
-                                read_ptr);
+    // close the hdf5 file
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
+                             "Error closing HDF5 file: " << file_path);
+}
 
-            // copy the data out to the conduit node
-            dest.set_string(read_ptr[0]);
-        }
-        // check for bad # of elements
-        else if( dt.number_of_elements() < 0 )
-        {
-            CONDUIT_HDF5_ERROR(ref_path,
-                                "Cannot read dataset with # of elements < 0");
-        }
-        else if(dest.dtype().is_compact() &&
-           dest.dtype().compatible(dt) )
-        {
-            // we can read directly from hdf5 dataset if compact 
-            // & compatible
-            h5_status = H5Dread(hdf5_dset_id,
-                                h5_dtype_id,
-                                H5S_ALL,
-                                H5S_ALL,
-                                H5P_DEFAULT,
-                                dest.data_ptr());
-        }
-        else
-        {
-            // we create a temp Node b/c we want read to work for 
-            // strided data
-            // 
-            // the hdf5 data will always be compact, source node we are 
-            // reading will not unless it's already compatible and compact.
-            Node n_tmp(dt);
-            h5_status = H5Dread(hdf5_dset_id,
-                                h5_dtype_id,
-                                H5S_ALL,
-                                H5S_ALL,
-                                H5P_DEFAULT,
-                                n_tmp.data_ptr());
-        
-            // copy out to our dest
-            dest.set(n_tmp);
-        }
+//---------------------------------------------------------------------------//
+void
+hdf5_read_schema(const std::string &path,
+                 Schema &schema)
+{
+    // check for ":" split
+    std::string file_path;
+    std::string hdf5_path;
 
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                        hdf5_dset_id,
-                                                        ref_path,
-                                               "Error reading HDF5 Dataset: "
-                                                << hdf5_dset_id);
-    
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
-                                                        hdf5_dset_id,
-                                                        ref_path,
-                                               "Error closing HDF5 Datatype: "
-                                               << h5_dtype_id);
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    hdf5_path);
 
+    // We will read the root if no hdf5_path is given.
+    if(hdf5_path.size() == 0)
+    {
+        hdf5_path = "/";
     }
 
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
-                                                    hdf5_dset_id,
-                                                    ref_path,
-                                           "Error closing HDF5 Dataspace: "
-                                           << h5_dspace_id);
+    hdf5_read_schema(file_path,
+                     hdf5_path,
+                     schema);
+}
+
+//---------------------------------------------------------------------------//
+bool
+hdf5_has_path(hid_t hdf5_id,
+              const std::string &hdf5_path)
+{
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+    
+    int res = H5Lexists(hdf5_id,hdf5_path.c_str(),H5P_DEFAULT);
+    
+    
+    // H5Lexists returns:
+    //  a positive value if the link exists.
+    //
+    //  0 if it doesn't exist
+    //
+    //  a negative # in some cases when it doesn't exist, and in some cases
+    //    where there is an error. 
+    // For our cases, we treat 0 and negative as does not exist. 
 
+    return (res > 0);
+    // restore hdf5 error stack
 }
 
 //---------------------------------------------------------------------------//
 void
-read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
-                                 const std::string &ref_path,
-                                 Node &dest)
+hdf5_remove_path(hid_t hdf5_id,
+                 const std::string &hdf5_path)
 {
-    herr_t     h5_status = 0;
-    H5O_info_t h5_info_buf;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
     
-    h5_status = H5Oget_info(hdf5_id,&h5_info_buf);
-
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Ldelete(hdf5_id,
+                                                              hdf5_path.c_str(),
+                                                              H5P_DEFAULT),
                                                     hdf5_id,
-                                                    ref_path,
-                                           "Error fetching HDF5 object "
-                                           << "info from: " 
-                                           << hdf5_id);
+                                                    hdf5_path,
+                             "Error deleting HDF5 path: "
+                              << hdf5_id << ":" << hdf5_path);
 
-    switch (h5_info_buf.type)
-    {
-        // if hdf5_id + hdf5_path points to a group,
-        // use a H5Literate traversal
-        case H5O_TYPE_GROUP:
-        {
-            read_hdf5_group_into_conduit_node(hdf5_id,
-                                              ref_path,
-                                              dest);
-            break;
-        }
-        // if hdf5_id + hdf5_path points directly to a dataset
-        // skip the H5Literate traversal
-        case H5O_TYPE_DATASET:
-        {
-            read_hdf5_dataset_into_conduit_node(hdf5_id,
-                                                ref_path,
-                                                dest);
-            break;
-        }
-        // unsupported types
-        case H5O_TYPE_UNKNOWN:
-        {
-            // we only construct these strings 
-            // when an error occurs, to avoid overhead
-            // for healthy fetches
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                               "Cannot read HDF5 Object : "
-                                << "(type == H5O_TYPE_UNKNOWN )");
-            break;
-        }
-        case H5O_TYPE_NAMED_DATATYPE:
-        {
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                               "Cannot read HDF5 Object "
-                               << "(type == H5O_TYPE_NAMED_DATATYPE )");
-            break;
-        }
-        case H5O_TYPE_NTYPES:
-        {
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-              "Cannot read HDF5 Object "
-               << "(type == H5O_TYPE_NTYPES [This is an invalid HDF5 type!]");
-            break;
-        }
-        default:
-        {
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(hdf5_id,
-                                        ref_path,
-                                        hdf5_err_ref_path);
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                               "Cannot read HDF5 Object (type == Unknown )");
-        }
-    }
+    // restore hdf5 error stack
 }
 
 
 
+
 //---------------------------------------------------------------------------//
-hid_t
-create_hdf5_file_access_plist()
+bool
+is_hdf5_file(const std::string &file_path)
 {
-    // create property list and set use latest lib ver settings 
-    hid_t h5_fa_props = H5Pcreate(H5P_FILE_ACCESS);
-    
-    CONDUIT_CHECK_HDF5_ERROR(h5_fa_props,
-                             "Failed to create H5P_FILE_ACCESS "
-                             << " property list");
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
     
-    unsigned int major_num=0;
-    unsigned int minor_num=0;
-    unsigned int release_num=0;
+    bool res = false;
+    // open the hdf5 file for read + write
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDWR,
+                               H5P_DEFAULT);
     
-    herr_t h5_status = H5get_libversion(&major_num, &minor_num,&release_num);
+    if( h5_file_id >= 0)
+    {
+        res = true;
+        H5Fclose(h5_file_id);
+    }
+
+    return res;
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void hdf5_group_list_child_names(hid_t hdf5_id,
+                                 const std::string &hdf5_path,
+                                 std::vector<std::string> &res)
+{   
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
     
-    CONDUIT_CHECK_HDF5_ERROR(h5_status,
-                             "Failed to fetch HDF5 library version info ");
+    res.clear();
+    // first, hdf5_id + path must be a group in order to have children
 
-    // most of our use cases are still using 1.8.
-    // to allow hdf5 1.8 readers to read from hdf5 1.10 writers,
-    // we want to pin to hdf5 1.8 features for now. 
-    // There isn't a way to select 1.8, 
-    // https://forum.hdfgroup.org/t/seconding-the-request-for-h5pset-libver-bounds-1-8-x-file-compat-option/4056
-    // so only enable H5F_LIBVER_LATEST if we are using hdf5 1.8
+    H5O_info_t h5_info_buf;
 
-    if(major_num == 1 && minor_num == 8)
-    {
-        h5_status = H5Pset_libver_bounds(h5_fa_props,
-                                         H5F_LIBVER_LATEST,
-                                         H5F_LIBVER_LATEST);
+    // Get type of the object
+    herr_t h5_status = H5Oget_info_by_name(hdf5_id,
+                                           hdf5_path.c_str(),
+                                           &h5_info_buf,
+                                           H5P_DEFAULT);
 
-        CONDUIT_CHECK_HDF5_ERROR(h5_status,
-                                 "Failed to set libver options for "
-                                 << "property list " << h5_fa_props);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    "",
+                                           "Error fetching HDF5 Object info: "
+                                           << " parent: " << hdf5_id 
+                                           << " path:"    << hdf5_path) ;
 
+    if( h5_info_buf.type != H5O_TYPE_GROUP )
+    {    
+        //  not a group, child names will be empty
+        // we could also choose to throw an error in the future 
+        return;
     }
-    return h5_fa_props;
-}
 
-//---------------------------------------------------------------------------//
-hid_t
-create_hdf5_file_create_plist()
-{
-    // create property list and set it to preserve creation order
-    hid_t h5_fc_props = H5Pcreate(H5P_FILE_CREATE);
+    // we have a group    
+    // we don't care about links in this case, we want
+    // the child names regardless, so we don't have to use H5Literate
+    //
+    // we can use H5Lget_name_by_idx, as demoed in 
+    // https://support.hdfgroup.org/ftp/HDF5/examples/examples-by-api/hdf5-examples/1_10/C/H5G/h5ex_g_corder.c
+    // 
+    
+
+    hid_t h5_group_id = H5Gopen(hdf5_id,
+                                hdf5_path.c_str(),
+                                H5P_DEFAULT);
+    
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_group_id,
+                                                    hdf5_id,
+                                           "",
+                                           "Error opening HDF5 "
+                                           << "Group: " 
+                                           << " parent: "
+                                           << hdf5_id 
+                                           << " path:"
+                                           << hdf5_path);
+    
+    // get group info so we can find the # of children
+    H5G_info_t  h5_group_info;
+    h5_status = H5Gget_info(h5_group_id, &h5_group_info);
+
+    // buffer for child names, if the names are bigger than this
+    // buffer can hold, we will fall back to a malloc
+    char name_buff[512];
+    
+    for (hsize_t i=0; i < h5_group_info.nlinks; i++)
+    {
+        char *name_buff_ptr = name_buff;
+        char *name_buff_tmp = NULL;
+        // Get size of name,
+        int name_size = H5Lget_name_by_idx(h5_group_id, ".",
+                                           H5_INDEX_CRT_ORDER,
+                                           H5_ITER_INC,
+                                           i,
+                                           NULL,
+                                           0,
+                                           H5P_DEFAULT);
+
+        if(name_size <= 0)
+        {
+            // error, not valid
+            std::string hdf5_err_ref_path;
+            hdf5_ref_path_with_filename(h5_group_id,
+                                        hdf5_path,
+                                        hdf5_err_ref_path);
 
-    CONDUIT_CHECK_HDF5_ERROR(h5_fc_props,
-                             "Failed to create H5P_FILE_CREATE "
-                             << " property list");
+            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
+                               "Failed to fetch group child name at index " << i);
+        }
+        // now that we know the name exists, add 1 for null terminator.
+        name_size++;
 
-    herr_t h5_status = H5Pset_link_creation_order(h5_fc_props, 
-            ( H5P_CRT_ORDER_TRACKED |  H5P_CRT_ORDER_INDEXED) );
+        if(name_size > 512)
+        {
+            // we dont have room with our built in buffer
+            // fall back to malloc
+            name_buff_tmp = (char*)malloc(sizeof(char)*name_size);
+            name_buff_ptr = name_buff_tmp;
+        }
+        
+        name_size = H5Lget_name_by_idx(h5_group_id, ".",
+                                       H5_INDEX_CRT_ORDER,
+                                       H5_ITER_INC,
+                                       i,
+                                       name_buff_ptr,
+                                       name_size,
+                                       H5P_DEFAULT);
+        
+        res.push_back(std::string(name_buff_ptr));
 
-    CONDUIT_CHECK_HDF5_ERROR(h5_status,
-                             "Failed to set creation order options for "
-                             << "property list " << h5_fc_props);
-    return h5_fc_props;
+        if(name_buff_tmp)
+        {
+            free(name_buff_tmp);
+            name_buff_tmp = NULL;
+        }
+   }
+   
+   CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_group_id),
+                                                   hdf5_id,
+                                          "",
+                                          "Failed to close HDF5 Group " 
+                                          << h5_group_id);
+
+   // restore hdf5 error stack
 }
 
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
-// Public interface: Write Methods
+// Shared File Methods (every rank writes into one hdf5 file)
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
 //---------------------------------------------------------------------------//
-hid_t
-hdf5_create_file(const std::string &file_path)
-{
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-        
-    hid_t h5_fc_plist = create_hdf5_file_create_plist();
-    hid_t h5_fa_plist = create_hdf5_file_access_plist();
-
-    // open the hdf5 file for writing
-    hid_t h5_file_id = H5Fcreate(file_path.c_str(),
-                                 H5F_ACC_TRUNC,
-                                 h5_fc_plist,
-                                 h5_fa_plist);
-
-    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
-                             "Error opening HDF5 file for writing: " 
-                             << file_path);
-
-    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fc_plist),
-                             "Failed to close HDF5 H5P_GROUP_CREATE "
-                             << "property list: " << h5_fc_plist);
-
-    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
-                             "Failed to close HDF5 H5P_FILE_ACCESS "
-                             << "property list: " << h5_fa_plist);
-    
-    return h5_file_id;
-    
-    // enable hdf5 error stack
-}
-
-//-----------------------------------------------------------------------------
-void
-hdf5_close_file(hid_t hdf5_id)
+// Every rank holds the compact schemas of all ranks, so the rank that 
+// creates the file can lay out every rank's groups and datasets, and each
+// rank knows where its elements go.
+//---------------------------------------------------------------------------//
+struct HDF5SharedFileWrite
 {
-    // close the hdf5 file
-    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(hdf5_id),
-                             "Error closing HDF5 file handle: " << hdf5_id);
-}
+    int   rank;
+    // when true, leaves with the same path are concatenated across ranks
+    bool  concatenate;
+    // when true, the groups, datasets and attributes are created
+    bool  create;
+};
 
 //---------------------------------------------------------------------------//
 void
-hdf5_write(const Node &node,
-           hid_t hdf5_id,
-           const std::string &hdf5_path)
+hdf5_shared_file_gather_schemas(const Node &node,
+                                MPI_Comm comm,
+                                std::vector<Schema> &rank_schemas)
 {
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
+    int size = 0;
+    MPI_Comm_size(comm, &size);
 
-    // TODO: we only want to support abs paths if hdf5_id is a file
-    // if ( (not hdf5 file) && 
-    //      (hdf5_path.size() > 0) && 
-    //      (hdf5_path[0] == "/") )
-    //{
-    //    CONDUIT_ERROR("HDF5 id must represent a file to use a HDF5 "
-    ///                 "absolute path (a path starts with '/'");
-    //}
+    Schema s_compact;
+    node.schema().compact_to(s_compact);
 
-    // after this check strip leading forward and trailing slashes
-    // if the exist
+    std::vector<uint8> s_bin;
+    s_compact.to_binary(s_bin);
 
-    size_t pos = 0;
-    size_t len = hdf5_path.size();
+    int num_bytes = (int) s_bin.size();
+    std::vector<int> rank_bytes(size,0);
+    std::vector<int> rank_offsets(size,0);
 
-    if( (hdf5_path.size() > 0) && 
-        (hdf5_path[0] == '/' ) )
+    MPI_Allgather(&num_bytes, 1, MPI_INT,
+                  &rank_bytes[0], 1, MPI_INT,
+                  comm);
+
+    int total_bytes = 0;
+    for(int r = 0; r < size; r++)
     {
-        pos = 1;
-        len--;
+        rank_offsets[r] = total_bytes;
+        total_bytes    += rank_bytes[r];
     }
-    
-    // only trim right side if we are sure there is more than one char
-    // (avoid "/" case, which would already have been trimmed )
-    if( (hdf5_path.size() > 1 ) && 
-        (hdf5_path[hdf5_path.size()-1] == '/') )
+
+    std::vector<uint8> all_bin(total_bytes);
+
+    MPI_Allgatherv(&s_bin[0], num_bytes, MPI_UNSIGNED_CHAR,
+                   &all_bin[0], &rank_bytes[0], &rank_offsets[0],
+                   MPI_UNSIGNED_CHAR,
+                   comm);
+
+    rank_schemas.resize(size);
+    for(int r = 0; r < size; r++)
     {
-        len--;
+        rank_schemas[r].from_binary(&all_bin[rank_offsets[r]],
+                                    rank_bytes[r]);
     }
-    
-    std::string path = hdf5_path.substr(pos,len);
-    
-    // TODO: Creating the external tree is inefficient but the compatibility 
-    // checks and write methods handle node paths easily handle this case.
-    // revisit if this is too slow
-    
-    Node n;
-    if(path.size() > 0)
+}
+
+//---------------------------------------------------------------------------//
+// Checks the trees before anything is written. All ranks check the same
+// schemas, so they all reach the same result.
+//---------------------------------------------------------------------------//
+void
+hdf5_shared_file_check(const std::vector<const Schema*> &rank_s,
+                       const std::string &ref_path,
+                       bool concatenate)
+{
+    const Schema &s = *rank_s[0];
+    index_t dtype_id = s.dtype().id();
+
+    for(size_t r = 1; r < rank_s.size(); r++)
     {
-        // strong dose of evil casting, but it's ok b/c we are grownups here?
-        // time we will tell ...
-        n.fetch(path).set_external(const_cast<Node&>(node));
+        if(rank_s[r]->dtype().id() != dtype_id)
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "concatenate layout requires the same tree "
+                               "on all ranks (rank 0 has "
+                               << DataType::id_to_name(dtype_id)
+                               << ", rank " << r << " has "
+                               << DataType::id_to_name(
+                                                rank_s[r]->dtype().id())
+                               << ")");
+        }
     }
-    else
+
+    if(dtype_id == DataType::LIST_ID)
     {
-        // strong dose of evil casting, but it's ok b/c we are grownups here?
-        // time we will tell ...
-        n.set_external(const_cast<Node&>(node));
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "HDF5 shared file write doesn't support "
+                           "LIST_ID nodes.");
     }
-
-    // check compat
-    if(check_if_conduit_node_is_compatible_with_hdf5_tree(n,
-                                                          "",
-                                                          hdf5_id))
+    else if(concatenate && dtype_id == DataType::CHAR8_STR_ID)
     {
-        // write if we are compat
-        write_conduit_node_to_hdf5_tree(n,"",hdf5_id);
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "concatenate layout doesn't support strings");
     }
-    else
+    else if(dtype_id == DataType::OBJECT_ID)
     {
-        std::string hdf5_error_ref_path;
-        hdf5_ref_path_with_filename(hdf5_id,
-                                    hdf5_path,
-                                    hdf5_error_ref_path);
+        index_t num_children = s.number_of_children();
+        for(index_t i = 0; i < num_children; i++)
+        {
+            std::string chld_name = s.child_name(i);
+            std::string chld_ref_path = join_ref_paths(ref_path,chld_name);
 
-        CONDUIT_ERROR("Failed to write node to " 
-                      << "\"" << hdf5_error_ref_path << "\", "
-                      << "existing HDF5 tree is "
-                      << "incompatible with the Conduit Node.");
-    }
+            std::vector<const Schema*> chld_s;
+            for(size_t r = 0; r < rank_s.size(); r++)
+            {
+                if( rank_s[r]->number_of_children() != num_children || 
+                    !rank_s[r]->has_child(chld_name) )
+                {
+                    CONDUIT_HDF5_ERROR(chld_ref_path,
+                                       "concatenate layout requires the "
+                                       "same tree on all ranks (rank " 
+                                       << r << " differs from rank 0)");
+                }
+                chld_s.push_back(&rank_s[r]->fetch_child(chld_name));
+            }
 
-    // restore hdf5 error stack
+            hdf5_shared_file_check(chld_s, chld_ref_path, concatenate);
+        }
+    }
 }
 
-
 //---------------------------------------------------------------------------//
 void
-hdf5_write(const Node &node,
-           hid_t hdf5_id)
+hdf5_write_int64_attribute(hid_t hdf5_id,
+                           const std::string &ref_path,
+                           const std::string &attr_name,
+                           const std::vector<int64> &values)
 {
-    // disable hdf5 error stack
-    // TODO: we may only need to use this in an outer level variant
-    // of check_if_conduit_node_is_compatible_with_hdf5_tree
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    // check compat
-    if(check_if_conduit_node_is_compatible_with_hdf5_tree(node,
-                                                          "",
-                                                          hdf5_id))
+    hsize_t num_vals = (hsize_t) values.size();
+    hid_t h5_dspace_id = H5Screate_simple(1, &num_vals, NULL);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Dataspace");
+
+    hid_t h5_attr_id = H5Acreate(hdf5_id,
+                                 attr_name.c_str(),
+                                 H5T_NATIVE_INT64,
+                                 h5_dspace_id,
+                                 H5P_DEFAULT,
+                                 H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Attribute "
+                                           << attr_name);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                        H5Awrite(h5_attr_id,
+                                                 H5T_NATIVE_INT64,
+                                                 &values[0]),
+                                        hdf5_id,
+                                        ref_path,
+                                        "Failed to write HDF5 Attribute "
+                                        << attr_name);
+
+    H5Aclose(h5_attr_id);
+    H5Sclose(h5_dspace_id);
+}
+
+//---------------------------------------------------------------------------//
+bool
+hdf5_read_int64_attribute(hid_t hdf5_id,
+                          const std::string &ref_path,
+                          const std::string &attr_name,
+                          std::vector<int64> &values)
+{
+    if(H5Aexists(hdf5_id,attr_name.c_str()) <= 0)
     {
-        // write if we are compat
-        write_conduit_node_to_hdf5_tree(node,
-                                        "",
-                                        hdf5_id);
+        return false;
     }
-    else
-    {
-        std::string hdf5_fname;
-        hdf5_filename_from_hdf5_obj_id(hdf5_id, hdf5_fname);
 
-        CONDUIT_ERROR("Failed to write node to " 
-                      << "\"" << hdf5_fname << "\", "
-                      << "existing HDF5 tree is "
-                      << "incompatible with the Conduit Node.");
+    hid_t h5_attr_id = H5Aopen(hdf5_id, attr_name.c_str(), H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_id,
+                                                    ref_path,
+                                           "Failed to open HDF5 Attribute "
+                                           << attr_name);
+
+    hid_t h5_dspace_id = H5Aget_space(h5_attr_id);
+    values.resize((size_t)H5Sget_simple_extent_npoints(h5_dspace_id));
+
+    if(!values.empty())
+    {
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                            H5Aread(h5_attr_id,
+                                                    H5T_NATIVE_INT64,
+                                                    &values[0]),
+                                            hdf5_id,
+                                            ref_path,
+                                            "Failed to read HDF5 Attribute "
+                                            << attr_name);
     }
-    // restore hdf5 error stack
+
+    H5Sclose(h5_dspace_id);
+    H5Aclose(h5_attr_id);
+    return true;
 }
 
 //---------------------------------------------------------------------------//
-void 
-hdf5_save(const Node &node,
-          const std::string &path)
+// Agrees on whether any rank's turn at writing failed (used when ranks
+// take turns writing the shared file).
+//---------------------------------------------------------------------------//
+bool
+hdf5_shared_file_turn_failed(int turn_error,
+                             MPI_Comm comm)
 {
-    hdf5_write(node,path,false);
+    int any_error = 0;
+    MPI_Allreduce(&turn_error, &any_error, 1, MPI_INT, MPI_MAX, comm);
+    return any_error != 0;
 }
 
 //---------------------------------------------------------------------------//
-void
-hdf5_save(const Node &node,
-          const std::string &file_path,
-          const std::string &hdf5_path)
+hid_t
+create_hdf5_group_for_shared_file(hid_t hdf5_group_id,
+                                  const std::string &ref_path,
+                                  const std::string &hdf5_group_name)
 {
-    hdf5_write(node,file_path,hdf5_path,false);
-}
+    hid_t h5_gc_plist = H5Pcreate(H5P_GROUP_CREATE);
 
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_gc_plist,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                         "Failed to create H5P_GROUP_CREATE property list");
 
-//---------------------------------------------------------------------------//
-void 
-hdf5_append(const Node &node,
-            const std::string &path)
-{
-    hdf5_write(node,path,true);
+    // track creation order
+    herr_t h5_status = H5Pset_link_creation_order(h5_gc_plist, 
+            ( H5P_CRT_ORDER_TRACKED |  H5P_CRT_ORDER_INDEXED) );
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                         "Failed to set group link creation property");
+
+    hid_t res = H5Gcreate(hdf5_group_id,
+                          hdf5_group_name.c_str(),
+                          H5P_DEFAULT,
+                          h5_gc_plist,
+                          H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(res,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                      "Failed to create HDF5 Group "
+                                      << " parent: " << hdf5_group_id
+                                      << " name: "   << hdf5_group_name);
+
+    H5Pclose(h5_gc_plist);
+    return res;
 }
 
+//---------------------------------------------------------------------------//
+// rank_s holds the schemas of the ranks that write to this leaf (NULL for 
+// the others), local is this rank's leaf (NULL if it doesn't write to it)
 //---------------------------------------------------------------------------//
 void
-hdf5_append(const Node &node,
-            const std::string &file_path,
-            const std::string &hdf5_path)
+hdf5_shared_file_write_leaf(const std::vector<const Schema*> &rank_s,
+                            const Node *local,
+                            const std::string &ref_path,
+                            hid_t hdf5_group_id,
+                            const std::string &hdf5_dset_name,
+                            const HDF5SharedFileWrite &state)
 {
-    hdf5_write(node,file_path,hdf5_path,true);
-}
+    // each rank writes its elements after the elements of lower ranks
+    std::vector<int64> rank_counts(rank_s.size(),0);
+    const Schema *s = NULL;
+    hsize_t num_elems = 0;
+    hsize_t offset    = 0;
 
+    for(size_t r = 0; r < rank_s.size(); r++)
+    {
+        if(rank_s[r] != NULL)
+        {
+            s = rank_s[r];
+            rank_counts[r] = s->dtype().number_of_elements();
+        }
 
-//---------------------------------------------------------------------------//
-void 
-hdf5_write(const  Node &node,
-           const std::string &path,
-           bool append)
-{
-    // check for ":" split
-    std::string file_path;
-    std::string hdf5_path;
+        if((int)r < state.rank)
+        {
+            offset += (hsize_t) rank_counts[r];
+        }
+        num_elems += (hsize_t) rank_counts[r];
+    }
 
-    conduit::utils::split_file_path(path,
-                                    std::string(":"),
-                                    file_path,
-                                    hdf5_path);
+    hsize_t count = (hsize_t) rank_counts[state.rank];
 
-    // we will write to the root if no hdf5_path is given.
-    // this should be fine for OBJECT_T, not sure about others ...
-    if(hdf5_path.size() == 0)
+    hid_t h5_dset_id = -1;
+
+    if(state.create)
     {
-        hdf5_path = "/";
-    }
+        hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(s->dtype(),ref_path);
+        hid_t h5_dspace_id = H5Screate_simple(1, &num_elems, NULL);
 
-    hdf5_write(node,
-               file_path,
-               hdf5_path,
-               append);
-}
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                           "Failed to create HDF5 Dataspace");
 
+        h5_dset_id = H5Dcreate(hdf5_group_id,
+                               hdf5_dset_name.c_str(),
+                               h5_dtype_id,
+                               h5_dspace_id,
+                               H5P_DEFAULT,
+                               H5P_DEFAULT,
+                               H5P_DEFAULT);
 
-//---------------------------------------------------------------------------//
-void
-hdf5_write(const Node &node,
-           const std::string &file_path,
-           const std::string &hdf5_path,
-           bool append)
-{
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                           "Failed to create HDF5 Dataset " 
+                                           << hdf5_group_id << " " 
+                                           << hdf5_dset_name);
 
-    hid_t h5_file_id = -1;
-    if(append && utils::is_file(file_path))
-    {
-        // open existing hdf5 file for read + write
-        h5_file_id = hdf5_open_file_for_read_write(file_path);
+        conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
+        H5Sclose(h5_dspace_id);
+
+        // the load uses the counts to find each rank's elements
+        if(state.concatenate)
+        {
+            hdf5_write_int64_attribute(h5_dset_id,
+                                       ref_path,
+                                       "conduit_rank_counts",
+                                       rank_counts);
+        }
     }
-    else // trunc
+    else
     {
-        // open the hdf5 file for writing
-        h5_file_id = hdf5_create_file(file_path);
-    }
+        h5_dset_id = H5Dopen(hdf5_group_id,
+                             hdf5_dset_name.c_str(),
+                             H5P_DEFAULT);
 
-    hdf5_write(node,
-               h5_file_id,
-               hdf5_path);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                               "Failed to open HDF5 Dataset "
+                                               << " parent: "
+                                               << hdf5_group_id
+                                               << " name: "
+                                               << hdf5_dset_name);
+    }
 
-    // close the hdf5 file
-    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
-                             "Error closing HDF5 file: " << file_path);
+    if(count > 0)
+    {
+        hid_t h5_dspace_id = H5Dget_space(h5_dset_id);
+
+        H5Sselect_hyperslab(h5_dspace_id,
+                            H5S_SELECT_SET,
+                            &offset,
+                            NULL,
+                            &count,
+                            NULL);
+
+        hid_t h5_mem_dspace_id = H5Screate_simple(1, &count, NULL);
+        hid_t h5_mem_dtype_id  = conduit_dtype_to_hdf5_dtype(local->dtype(),
+                                                             ref_path);
+
+        const void *data_ptr = NULL;
+        Node n_compact;
+        if(local->dtype().is_compact())
+        {
+            data_ptr = local->element_ptr(0);
+        }
+        else
+        {
+            local->compact_to(n_compact);
+            data_ptr = n_compact.element_ptr(0);
+        }
 
-    // restore hdf5 error stack
-}
+        herr_t h5_status = H5Dwrite(h5_dset_id,
+                                    h5_mem_dtype_id,
+                                    h5_mem_dspace_id,
+                                    h5_dspace_id,
+                                    H5P_DEFAULT,
+                                    data_ptr);
 
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        h5_dset_id,
+                                                        ref_path,
+                                           "Failed to write to HDF5 Dataset "
+                                           << h5_dset_id);
 
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-// Public interface: Read Methods
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
+        conduit_dtype_to_hdf5_dtype_cleanup(h5_mem_dtype_id);
+        H5Sclose(h5_mem_dspace_id);
+        H5Sclose(h5_dspace_id);
+    }
 
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Dataset: "
+                                           << h5_dset_id);
+}
 
 //---------------------------------------------------------------------------//
-hid_t
-hdf5_open_file_for_read(const std::string &file_path)
-{
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    hid_t h5_fa_plist = create_hdf5_file_access_plist();
-    
-    // open the hdf5 file for reading
-    hid_t h5_file_id = H5Fopen(file_path.c_str(),
-                               H5F_ACC_RDONLY,
-                               h5_fa_plist);
-
-    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
-                             "Error opening HDF5 file for reading: " 
-                              << file_path);
-
-    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
-                             "Failed to close HDF5 H5P_FILE_ACCESS "
-                             << "property list: " << h5_fa_plist);
-    
-    return h5_file_id;
-
-    // restore hdf5 error stack
-}
+void
+hdf5_shared_file_write_entry(const std::vector<const Schema*> &rank_s,
+                             const Node *local,
+                             const std::string &ref_path,
+                             hid_t hdf5_group_id,
+                             const std::string &hdf5_name,
+                             const HDF5SharedFileWrite &state);
 
 //---------------------------------------------------------------------------//
-hid_t
-hdf5_open_file_for_read_write(const std::string &file_path)
+void
+hdf5_shared_file_write_children(const std::vector<const Schema*> &rank_s,
+                                const Node *local,
+                                const std::string &ref_path,
+                                hid_t hdf5_group_id,
+                                const HDF5SharedFileWrite &state)
 {
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
+    const Schema *s = NULL;
+    for(size_t r = 0; r < rank_s.size() && s == NULL; r++)
+    {
+        s = rank_s[r];
+    }
 
-    hid_t h5_fa_plist = create_hdf5_file_access_plist();
-    
-    // open the hdf5 file for read + write
-    hid_t h5_file_id = H5Fopen(file_path.c_str(),
-                               H5F_ACC_RDWR,
-                               h5_fa_plist);
+    index_t num_children = s->number_of_children();
+    for(index_t i = 0; i < num_children; i++)
+    {
+        std::string chld_name = s->child_name(i);
 
-    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
-                             "Error opening HDF5 file for reading: " 
-                              << file_path);
+        std::vector<const Schema*> chld_s(rank_s.size(),NULL);
+        for(size_t r = 0; r < rank_s.size(); r++)
+        {
+            if(rank_s[r] != NULL)
+            {
+                chld_s[r] = &rank_s[r]->fetch_child(chld_name);
+            }
+        }
 
-    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
-                             "Failed to close HDF5 H5P_FILE_ACCESS "
-                             << "property list: " << h5_fa_plist);
-    
-    return h5_file_id;
+        const Node *chld_local = NULL;
+        if(local != NULL)
+        {
+            chld_local = &local->fetch_child(chld_name);
+        }
 
-    // restore hdf5 error stack
+        hdf5_shared_file_write_entry(chld_s,
+                                     chld_local,
+                                     join_ref_paths(ref_path,chld_name),
+                                     hdf5_group_id,
+                                     chld_name,
+                                     state);
+    }
 }
 
-
 //---------------------------------------------------------------------------//
 void
-hdf5_read(hid_t hdf5_id,
-          const std::string &hdf5_path,
-          Node &dest)
+hdf5_shared_file_write_entry(const std::vector<const Schema*> &rank_s,
+                             const Node *local,
+                             const std::string &ref_path,
+                             hid_t hdf5_group_id,
+                             const std::string &hdf5_name,
+                             const HDF5SharedFileWrite &state)
 {
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    // get hdf5 object at path, then call read_hdf5_tree_into_conduit_node
-    hid_t h5_child_obj  = H5Oopen(hdf5_id,
-                                  hdf5_path.c_str(),
+    // after the file is created, each rank only needs to visit its own 
+    // data
+    if(local == NULL && !state.create)
+    {
+        return;
+    }
+
+    const Schema *s = NULL;
+    for(size_t r = 0; r < rank_s.size() && s == NULL; r++)
+    {
+        s = rank_s[r];
+    }
+
+    if(s->dtype().is_object())
+    {
+        hid_t h5_child_id = -1;
+        if(state.create)
+        {
+            h5_child_id = create_hdf5_group_for_shared_file(hdf5_group_id,
+                                                            ref_path,
+                                                            hdf5_name);
+        }
+        else
+        {
+            h5_child_id = H5Gopen(hdf5_group_id,
+                                  hdf5_name.c_str(),
                                   H5P_DEFAULT);
-    
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_obj,
-                                                    hdf5_id,
-                                                    hdf5_path,
-                            "Failed to fetch HDF5 object from: "
-                             << hdf5_id << ":" << hdf5_path);
 
-    read_hdf5_tree_into_conduit_node(h5_child_obj,
-                                     hdf5_path,
-                                     dest);
-    
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
-                                                    hdf5_id,
-                                                    hdf5_path,
-                             "Failed to close HDF5 Object: "
-                             << h5_child_obj);
-    
-    // restore hdf5 error stack
-}
-//---------------------------------------------------------------------------//
-void
-hdf5_read(const std::string &file_path,
-          const std::string &hdf5_path,
-          Node &node)
-{
-    // note: hdf5 error stack is suppressed in these calls
-    
-    // open the hdf5 file for reading
-    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                            hdf5_group_id,
+                                                            ref_path,
+                                             "Failed to open HDF5 Group "
+                                             << " parent: " << hdf5_group_id
+                                             << " name: "   << hdf5_name);
+        }
 
-    hdf5_read(h5_file_id,
-              hdf5_path,
-              node);
-    
-    // close the hdf5 file
-    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
-                             "Error closing HDF5 file: " << file_path);
+        hdf5_shared_file_write_children(rank_s,
+                                        local,
+                                        ref_path,
+                                        h5_child_id,
+                                        state);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_child_id),
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                         "Failed to close HDF5 Group " 
+                                         << h5_child_id);
+    }
+    else if(s->dtype().is_empty())
+    {
+        if(state.create)
+        {
+            hid_t h5_child_id = create_hdf5_dataset_for_conduit_empty(
+                                                                hdf5_group_id,
+                                                                ref_path,
+                                                                hdf5_name);
+            H5Dclose(h5_child_id);
+        }
+    }
+    else
+    {
+        hdf5_shared_file_write_leaf(rank_s,
+                                    local,
+                                    ref_path,
+                                    hdf5_group_id,
+                                    hdf5_name,
+                                    state);
+    }
 }
 
 //---------------------------------------------------------------------------//
 void
-hdf5_read(const std::string &path,
-          Node &node)
+hdf5_shared_file_write_tree(const Node &node,
+                            const std::vector<Schema> &rank_schemas,
+                            hid_t hdf5_id,
+                            const HDF5SharedFileWrite &state)
 {
-    // check for ":" split
-    std::string file_path;
-    std::string hdf5_path;
-    
-    conduit::utils::split_file_path(path,
-                                    std::string(":"),
-                                    file_path,
-                                    hdf5_path);
+    int num_ranks = (int) rank_schemas.size();
 
-    // We will read the root if no hdf5_path is given.
-    if(hdf5_path.size() == 0)
+    if(state.create)
+    {
+        std::vector<int64> layout_info(2,0);
+        // layout: 0 == rank groups, 1 == concatenate
+        layout_info[0] = state.concatenate ? 1 : 0;
+        layout_info[1] = num_ranks;
+        hdf5_write_int64_attribute(hdf5_id,
+                                   "",
+                                   "conduit_shared_file",
+                                   layout_info);
+    }
+
+    if(state.concatenate)
+    {
+        std::vector<const Schema*> rank_s;
+        for(int r = 0; r < num_ranks; r++)
+        {
+            rank_s.push_back(&rank_schemas[r]);
+        }
+
+        hdf5_shared_file_write_children(rank_s,
+                                        &node,
+                                        "",
+                                        hdf5_id,
+                                        state);
+    }
+    else
     {
-        hdf5_path = "/";
+        // each rank's tree is written to the group "rank_<rank>"
+        for(int r = 0; r < num_ranks; r++)
+        {
+            std::vector<const Schema*> rank_s(num_ranks,NULL);
+            rank_s[r] = &rank_schemas[r];
+
+            std::ostringstream oss;
+            oss << "rank_" << r;
+
+            hdf5_shared_file_write_entry(rank_s,
+                                         r == state.rank ? &node : NULL,
+                                         oss.str(),
+                                         hdf5_id,
+                                         oss.str(),
+                                         state);
+        }
     }
-    
-    // note: hdf5 error stack is suppressed in this call
-    hdf5_read(file_path,
-              hdf5_path,
-              node);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-hdf5_read(hid_t hdf5_id,
-          Node &dest)
+hdf5_shared_file_read_concat(hid_t hdf5_group_id,
+                             const std::string &ref_path,
+                             int rank,
+                             Node &dest)
 {
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    read_hdf5_tree_into_conduit_node(hdf5_id,
-                                     "",
-                                     dest);
-    
-    // restore hdf5 error stack
-}
+    std::vector<std::string> chld_names;
+    hdf5_group_list_child_names(hdf5_group_id, ".", chld_names);
+
+    for(size_t i = 0; i < chld_names.size(); i++)
+    {
+        const std::string &chld_name = chld_names[i];
+        std::string chld_ref_path = join_ref_paths(ref_path,chld_name);
+
+        H5O_info_t h5_info_buf;
+        herr_t h5_status = H5Oget_info_by_name(hdf5_group_id,
+                                               chld_name.c_str(),
+                                               &h5_info_buf,
+                                               H5P_DEFAULT);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        hdf5_group_id,
+                                                        chld_ref_path,
+                                           "Error fetching HDF5 Object info");
+
+        if(h5_info_buf.type == H5O_TYPE_GROUP)
+        {
+            hid_t h5_child_id = H5Gopen(hdf5_group_id,
+                                        chld_name.c_str(),
+                                        H5P_DEFAULT);
+
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                            hdf5_group_id,
+                                                            chld_ref_path,
+                                                "Failed to open HDF5 Group");
+
+            hdf5_shared_file_read_concat(h5_child_id,
+                                         chld_ref_path,
+                                         rank,
+                                         dest[chld_name]);
+            H5Gclose(h5_child_id);
+        }
+        else
+        {
+            hid_t h5_child_id = H5Dopen(hdf5_group_id,
+                                        chld_name.c_str(),
+                                        H5P_DEFAULT);
+
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
+                                                            hdf5_group_id,
+                                                            chld_ref_path,
+                                              "Failed to open HDF5 Dataset");
+
+            // read this rank's elements (empty leaves have no counts)
+            Node opts;
+            std::vector<int64> rank_counts;
+            if(hdf5_read_int64_attribute(h5_child_id,
+                                         chld_ref_path,
+                                         "conduit_rank_counts",
+                                         rank_counts))
+            {
+                int64 offset = 0;
+                for(int r = 0; r < rank; r++)
+                {
+                    offset += rank_counts[r];
+                }
+                opts["offset"] = offset;
+                opts["count"]  = rank_counts[rank];
+            }
 
+            read_hdf5_dataset_into_conduit_node(h5_child_id,
+                                                chld_ref_path,
+                                                opts,
+                                                dest[chld_name]);
+            H5Dclose(h5_child_id);
+        }
+    }
+}
 
 //---------------------------------------------------------------------------//
-bool
-hdf5_has_path(hid_t hdf5_id,
-              const std::string &hdf5_path)
+void
+hdf5_save_shared(const Node &node,
+                 const std::string &path,
+                 MPI_Comm comm)
 {
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    int res = H5Lexists(hdf5_id,hdf5_path.c_str(),H5P_DEFAULT);
-    
-    
-    // H5Lexists returns:
-    //  a positive value if the link exists.
-    //
-    //  0 if it doesn't exist
-    //
-    //  a negative # in some cases when it doesn't exist, and in some cases
-    //    where there is an error. 
-    // For our cases, we treat 0 and negative as does not exist. 
-
-    return (res > 0);
-    // restore hdf5 error stack
+    Node opts;
+    hdf5_save_shared(node, path, opts, comm);
 }
 
 //---------------------------------------------------------------------------//
 void
-hdf5_remove_path(hid_t hdf5_id,
-                 const std::string &hdf5_path)
+hdf5_save_shared(const Node &node,
+                 const std::string &path,
+                 const Node &opts,
+                 MPI_Comm comm)
 {
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Ldelete(hdf5_id,
-                                                              hdf5_path.c_str(),
-                                                              H5P_DEFAULT),
-                                                    hdf5_id,
-                                                    hdf5_path,
-                             "Error deleting HDF5 path: "
-                              << hdf5_id << ":" << hdf5_path);
 
-    // restore hdf5 error stack
-}
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
 
+    std::string layout = "rank_groups";
+    if(opts.has_child("layout"))
+    {
+        layout = opts["layout"].as_string();
+    }
 
+    if(layout != "rank_groups" && layout != "concatenate")
+    {
+        CONDUIT_ERROR("Unknown HDF5 shared file layout: \"" << layout << "\""
+                      " (expected \"rank_groups\" or \"concatenate\")");
+    }
 
+    std::vector<Schema> rank_schemas;
+    hdf5_shared_file_gather_schemas(node, comm, rank_schemas);
 
-//---------------------------------------------------------------------------//
-bool
-is_hdf5_file(const std::string &file_path)
-{
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    bool res = false;
-    // open the hdf5 file for read + write
-    hid_t h5_file_id = H5Fopen(file_path.c_str(),
-                               H5F_ACC_RDWR,
-                               H5P_DEFAULT);
-    
-    if( h5_file_id >= 0)
+    // check before anything is written
+    std::vector<const Schema*> rank_s;
+    for(int r = 0; r < size; r++)
     {
-        res = true;
-        H5Fclose(h5_file_id);
+        rank_s.push_back(&rank_schemas[r]);
+    }
+
+    if(layout == "concatenate")
+    {
+        if(!rank_schemas[0].dtype().is_object())
+        {
+            CONDUIT_ERROR("HDF5 shared file concatenate layout requires "
+                          "an Object node");
+        }
+        hdf5_shared_file_check(rank_s, "", true);
+    }
+    else
+    {
+        for(int r = 0; r < size; r++)
+        {
+            std::vector<const Schema*> curr_s(1,rank_s[r]);
+            hdf5_shared_file_check(curr_s, "", false);
+        }
+    }
+
+    HDF5SharedFileWrite state;
+    state.rank        = rank;
+    state.concatenate = (layout == "concatenate");
+
+    // the ranks take turns: rank 0 creates the file and its layout, then 
+    // each rank opens the file and writes its data. after each turn the 
+    // ranks agree on whether it failed, so an error is raised on every 
+    // rank instead of leaving the others waiting on a turn that will 
+    // never finish.
+    for(int r = 0; r < size; r++)
+    {
+        if(r == rank)
+        {
+            hid_t h5_file_id = -1;
+            try
+            {
+                if(rank == 0)
+                {
+                    h5_file_id = hdf5_create_file(path);
+                }
+                else
+                {
+                    h5_file_id = hdf5_open_file_for_read_write(path);
+                }
+
+                state.create = (rank == 0);
+                hdf5_shared_file_write_tree(node,
+                                            rank_schemas,
+                                            h5_file_id,
+                                            state);
+                hid_t h5_closing_id = h5_file_id;
+                h5_file_id = -1;
+                hdf5_close_file(h5_closing_id);
+            }
+            catch(const Error &)
+            {
+                if(h5_file_id >= 0)
+                {
+                    H5Fclose(h5_file_id);
+                }
+                // let the other ranks know, then raise the error here
+                hdf5_shared_file_turn_failed(1, comm);
+                throw;
+            }
+        }
+
+        if(hdf5_shared_file_turn_failed(0, comm))
+        {
+            CONDUIT_ERROR("HDF5 shared file write to " << path 
+                          << " failed on rank " << r);
+        }
     }
 
-    return res;
     // restore hdf5 error stack
 }
 
 //---------------------------------------------------------------------------//
-void hdf5_group_list_child_names(hid_t hdf5_id,
-                                 const std::string &hdf5_path,
-                                 std::vector<std::string> &res)
-{   
+void
+hdf5_load_shared(const std::string &path,
+                 Node &node,
+                 MPI_Comm comm)
+{
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
-    
-    res.clear();
-    // first, hdf5_id + path must be a group in order to have children
-
-    H5O_info_t h5_info_buf;
 
-    // Get type of the object
-    herr_t h5_status = H5Oget_info_by_name(hdf5_id,
-                                           hdf5_path.c_str(),
-                                           &h5_info_buf,
-                                           H5P_DEFAULT);
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
 
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                    hdf5_id,
-                                                    "",
-                                           "Error fetching HDF5 Object info: "
-                                           << " parent: " << hdf5_id 
-                                           << " path:"    << hdf5_path) ;
+    hid_t h5_file_id = hdf5_open_file_for_read(path);
 
-    if( h5_info_buf.type != H5O_TYPE_GROUP )
-    {    
-        //  not a group, child names will be empty
-        // we could also choose to throw an error in the future 
-        return;
+    std::vector<int64> layout_info;
+    if(!hdf5_read_int64_attribute(h5_file_id,
+                                  "",
+                                  "conduit_shared_file",
+                                  layout_info) ||
+       layout_info.size() != 2)
+    {
+        hdf5_close_file(h5_file_id);
+        CONDUIT_ERROR("HDF5 file " << path << " was not written by "
+                      "hdf5_save_shared");
     }
 
-    // we have a group    
-    // we don't care about links in this case, we want
-    // the child names regardless, so we don't have to use H5Literate
-    //
-    // we can use H5Lget_name_by_idx, as demoed in 
-    // https://support.hdfgroup.org/ftp/HDF5/examples/examples-by-api/hdf5-examples/1_10/C/H5G/h5ex_g_corder.c
-    // 
-    
-
-    hid_t h5_group_id = H5Gopen(hdf5_id,
-                                hdf5_path.c_str(),
-                                H5P_DEFAULT);
-    
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_group_id,
-                                                    hdf5_id,
-                                           "",
-                                           "Error opening HDF5 "
-                                           << "Group: " 
-                                           << " parent: "
-                                           << hdf5_id 
-                                           << " path:"
-                                           << hdf5_path);
-    
-    // get group info so we can find the # of children
-    H5G_info_t  h5_group_info;
-    h5_status = H5Gget_info(h5_group_id, &h5_group_info);
-
-    // buffer for child names, if the names are bigger than this
-    // buffer can hold, we will fall back to a malloc
-    char name_buff[512];
-    
-    for (hsize_t i=0; i < h5_group_info.nlinks; i++)
+    if(layout_info[1] != size)
     {
-        char *name_buff_ptr = name_buff;
-        char *name_buff_tmp = NULL;
-        // Get size of name,
-        int name_size = H5Lget_name_by_idx(h5_group_id, ".",
-                                           H5_INDEX_CRT_ORDER,
-                                           H5_ITER_INC,
-                                           i,
-                                           NULL,
-                                           0,
-                                           H5P_DEFAULT);
-
-        if(name_size <= 0)
-        {
-            // error, not valid
-            std::string hdf5_err_ref_path;
-            hdf5_ref_path_with_filename(h5_group_id,
-                                        hdf5_path,
-                                        hdf5_err_ref_path);
+        hdf5_close_file(h5_file_id);
+        CONDUIT_ERROR("HDF5 shared file " << path << " was written by " 
+                      << layout_info[1] << " ranks, it can't be loaded by "
+                      << size << " ranks");
+    }
 
-            CONDUIT_HDF5_ERROR(hdf5_err_ref_path,
-                               "Failed to fetch group child name at index " << i);
-        }
-        // now that we know the name exists, add 1 for null terminator.
-        name_size++;
+    node.reset();
 
-        if(name_size > 512)
-        {
-            // we dont have room with our built in buffer
-            // fall back to malloc
-            name_buff_tmp = (char*)malloc(sizeof(char)*name_size);
-            name_buff_ptr = name_buff_tmp;
-        }
-        
-        name_size = H5Lget_name_by_idx(h5_group_id, ".",
-                                       H5_INDEX_CRT_ORDER,
-                                       H5_ITER_INC,
-                                       i,
-                                       name_buff_ptr,
-                                       name_size,
-                                       H5P_DEFAULT);
-        
-        res.push_back(std::string(name_buff_ptr));
+    if(layout_info[0] == 1)
+    {
+        hdf5_shared_file_read_concat(h5_file_id, "", rank, node);
+    }
+    else
+    {
+        std::ostringstream oss;
+        oss << "rank_" << rank;
+        hdf5_read(h5_file_id, oss.str(), node);
+    }
 
-        if(name_buff_tmp)
-        {
-            free(name_buff_tmp);
-            name_buff_tmp = NULL;
-        }
-   }
-   
-   CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Gclose(h5_group_id),
-                                                   hdf5_id,
-                                          "",
-                                          "Failed to close HDF5 Group " 
-                                          << h5_group_id);
+    hdf5_close_file(h5_file_id);
 
-   // restore hdf5 error stack
+    // restore hdf5 error stack
 }
-
+#endif
 
 
 }
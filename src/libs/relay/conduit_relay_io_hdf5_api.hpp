@@ -144,6 +144,10 @@ void CONDUIT_RELAY_API hdf5_close_file(hid_t hdf5_id);
 void CONDUIT_RELAY_API hdf5_save(const Node &node,
                                  const std::string &path);
 
+void CONDUIT_RELAY_API hdf5_save(const Node &node,
+                                 const std::string &path,
+                                 const Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Save node data to given file system path and internal hdf5 path
 ///
@@ -154,6 +158,11 @@ void CONDUIT_RELAY_API hdf5_save(const Node &node,
                                  const std::string &file_path,
                                  const std::string &hdf5_path);
 
+void CONDUIT_RELAY_API hdf5_save(const Node &node,
+                                 const std::string &file_path,
+                                 const std::string &hdf5_path,
+                                 const Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Write node data to a given path.
 ///
@@ -168,6 +177,10 @@ void CONDUIT_RELAY_API hdf5_save(const Node &node,
 void CONDUIT_RELAY_API hdf5_append(const Node &node,
                                    const std::string &path);
 
+void CONDUIT_RELAY_API hdf5_append(const Node &node,
+                                   const std::string &path,
+                                   const Node &opts);
+
 //-----------------------------------------------------------------------------
 /// Write node data to given file system path and internal hdf5 path
 ///
@@ -178,6 +191,11 @@ void CONDUIT_RELAY_API hdf5_append(const Node &node,
                                    const std::string &file_path,
                                    const std::string &hdf5_path);
 
+void CONDUIT_RELAY_API hdf5_append(const Node &node,
+                                   const std::string &file_path,
+                                   const std::string &hdf5_path,
+                                   const Node &opts);
+
 
 //-----------------------------------------------------------------------------
 /// Write node data to a given path in an existing file.
@@ -190,6 +208,11 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   const std::string &path,
                                   bool append=false);
 
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  const std::string &path,
+                                  const Node &opts,
+                                  bool append=false);
+
 //-----------------------------------------------------------------------------
 /// Write node data to given file system path and internal hdf5 path
 //-----------------------------------------------------------------------------
@@ -198,6 +221,12 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   const std::string &hdf5_path,
                                   bool append=false);
 
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  const std::string &file_path,
+                                  const std::string &hdf5_path,
+                                  const Node &opts,
+                                  bool append=false);
+
 //-----------------------------------------------------------------------------
 /// Write node data to the hdf5_path relative to group represented  by 
 /// hdf5_id 
@@ -215,6 +244,61 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
 void CONDUIT_RELAY_API hdf5_write(const Node &node,
                                   hid_t hdf5_id);
 
+//-----------------------------------------------------------------------------
+/// Write variants that accept write options.
+///
+/// The storage options (see hdf5_set_options) passed to a write are used
+/// instead of the defaults for that write only. "overrides" selects 
+/// storage options for the datasets in a subtree of the node:
+///
+///   opts["chunking/compression/method"] = "none";
+///   Node &ovr = opts["overrides"].append();
+///   ovr["path"] = "fields";
+///   ovr["chunking/compression/method"] = "gzip";
+///
+/// Override paths are relative to the node being written, "*" matches any
+/// name (ex: "topologies/*/elements/connectivity"), and later overrides 
+/// win over earlier ones.
+///
+/// Hyperslab options write each leaf into part of a (new or existing)
+/// dataset, without reading or rewriting the rest of the dataset:
+///
+///   offset: first element written (default: 0)
+///   stride: distance between elements (default: 1)
+///   count:  number of elements written
+///           (default for 1-D: the number of elements in the leaf,
+///            required for N-D)
+///   dims:   min extent of the dataset (default: the extent needed to 
+///           hold the hyperslab)
+///
+/// For 1-D datasets each option can be a single number. For N-D datasets
+/// each option is an array with one value per dimension, and the leaf's
+/// elements are written in row major order. The number of selected 
+/// elements must match the number of elements in the leaf.
+///
+/// Datasets created by hyperslab writes are chunked with an unlimited max
+/// extent. If a hyperslab extends past the end of such a dataset, the 
+/// dataset is extended, so a time series can be written one slab at a 
+/// time.
+///
+///  ex: pre-create a dataset of 1000 elements and write elements 100-199
+///      opts["offset"] = 100;
+///      opts["dims"]   = 1000;
+///      hdf5_write(vals_100,h5_id,"fields/pressure",opts);
+///
+/// An existing dataset must have the same type as the leaf. Strings can't
+/// be written as a hyperslab.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  hid_t hdf5_id,
+                                  const std::string &hdf5_path,
+                                  const Node &opts);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_write(const Node &node,
+                                  hid_t hdf5_id,
+                                  const Node &opts);
+
 
 //-----------------------------------------------------------------------------
 /// Open a hdf5 file for reading, using conduit's selected hdf5 plists.
@@ -258,6 +342,76 @@ void CONDUIT_RELAY_API hdf5_read(hid_t hdf5_id,
 void CONDUIT_RELAY_API hdf5_read(hid_t hdf5_id,
                                  Node &node);
 
+//-----------------------------------------------------------------------------
+/// Read variants that accept read options.
+///
+/// Hyperslab options select part of each dataset that is read, using
+/// H5Sselect_hyperslab. Only the selected elements are read from the file,
+/// into a compact 1-D array in the output node:
+///
+///   offset: first element to read (default: 0)
+///   stride: distance between elements (default: 1)
+///   count:  number of elements to read 
+///           (default: all elements from offset to the end of the dataset)
+///
+/// For 1-D datasets each option can be a single number. For N-D datasets
+/// each option is an array with one value per dimension (in the dataset's
+/// dimension order), and the selected elements are read in row major order.
+///
+///  ex: read elements 100 to 199 of a 1-D dataset
+///      opts["offset"] = 100;
+///      opts["count"]  = 100;
+///
+/// When the path is a group, the selection is applied to every dataset
+/// in the group. Strings and datasets with scalar dataspaces can't be 
+/// read as a hyperslab.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read(const std::string &path,
+                                 const Node &opts,
+                                 Node &node);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read(const std::string &file_path,
+                                 const std::string &hdf5_path,
+                                 const Node &opts,
+                                 Node &node);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read(hid_t hdf5_id,
+                                 const std::string &hdf5_path,
+                                 const Node &opts,
+                                 Node &node);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read(hid_t hdf5_id,
+                                 const Node &opts,
+                                 Node &node);
+
+//-----------------------------------------------------------------------------
+/// Read the schema of hdf5 data, without reading the data itself.
+///
+/// The schema is built from the dataspace and datatype of each dataset,
+/// it matches the (compact) schema of the node hdf5_read would produce.
+/// Variable length strings are the exception, their length is only known
+/// by reading them.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(const std::string &path,
+                                        Schema &schema);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(const std::string &file_path,
+                                        const std::string &hdf5_path,
+                                        Schema &schema);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(hid_t hdf5_id,
+                                        const std::string &hdf5_path,
+                                        Schema &schema);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_schema(hid_t hdf5_id,
+                                        Schema &schema);
+
 //-----------------------------------------------------------------------------
 /// Helpers for converting between hdf5 dtypes and conduit dtypes
 /// 
@@ -325,7 +479,12 @@ void CONDUIT_RELAY_API hdf5_remove_path(hid_t hdf5_id, const std::string &path);
 
 
 //-----------------------------------------------------------------------------
-/// Pass a Node to set hdf5 i/o options.
+/// Pass a Node to set the default hdf5 i/o options.
+///
+/// These defaults are shared by the whole process. Writes that are already
+/// running keep the defaults they started with. To use different options
+/// for specific writes (or from several threads) pass the options to the
+/// write calls instead.
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API hdf5_set_options(const Node &opts);
 
@@ -50,6 +50,7 @@
 
 #include "conduit_relay_mpi.hpp"
 #include <iostream>
+#include <cstring>
 
 //-----------------------------------------------------------------------------
 /// The CONDUIT_CHECK_MPI_ERROR macro is used to check return values for 
@@ -95,6 +96,32 @@ namespace mpi
 {
 
 
+//-----------------------------------------------------------------------------
+// schemas are sent in the binary schema format, json schemas (as sent by
+// older versions of conduit) are still accepted
+//-----------------------------------------------------------------------------
+static void
+schema_from_message(const void *data,
+                    index_t data_len,
+                    Schema &schema)
+{
+    if(Schema::is_binary(data,data_len))
+    {
+        schema.from_binary(data,data_len);
+    }
+    else
+    {
+        // json schemas may be sent with a trailing null
+        const char *json = static_cast<const char*>(data);
+        index_t json_len = 0;
+        while(json_len < data_len && json[json_len] != 0)
+        {
+            json_len++;
+        }
+        schema.set(std::string(json,(size_t)json_len));
+    }
+}
+
 //-----------------------------------------------------------------------------
 int
 size(MPI_Comm mpi_comm)
@@ -313,11 +340,12 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
         node.schema().compact_to(s_data_compact);
     }
     
-    std::string snd_schema_json = s_data_compact.to_json();
+    std::vector<uint8> snd_schema_bin;
+    s_data_compact.to_binary(snd_schema_bin);
         
     Schema s_msg;
     s_msg["schema_len"].set(DataType::int64());
-    s_msg["schema"].set(DataType::char8_str(snd_schema_json.size()+1));
+    s_msg["schema"].set(DataType::uint8(snd_schema_bin.size()));
     s_msg["data"].set(s_data_compact);
     
     // create a compact schema to use
@@ -326,8 +354,10 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
     
     Node n_msg(s_msg_compact);
     // these sets won't realloc since schemas are compatible
-    n_msg["schema_len"].set((int64)snd_schema_json.length());
-    n_msg["schema"].set(snd_schema_json);
+    n_msg["schema_len"].set((int64)snd_schema_bin.size());
+    memcpy(n_msg["schema"].element_ptr(0),
+           &snd_schema_bin[0],
+           snd_schema_bin.size());
     n_msg["data"].update(node);
 
     
@@ -373,18 +403,21 @@ recv_using_schema(Node &node, int src, int tag, MPI_Comm comm)
 
     Node n_msg;
     // length of the schema is sent as a 64-bit signed int
-    // NOTE: we aren't using this value  ... 
-    n_msg["schema_len"].set_external((int64*)n_buff_ptr);
+    int64 schema_len = 0;
+    memcpy(&schema_len,n_buff_ptr,sizeof(int64));
     n_buff_ptr +=8;
-    // wrap the schema string
-    n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
     // create the schema
     Schema rcv_schema;
-    Generator gen(n_msg["schema"].as_char8_str());
-    gen.walk(rcv_schema);
+    schema_from_message(n_buff_ptr,schema_len,rcv_schema);
+
+    // json schemas are followed by a null terminator
+    if(!Schema::is_binary(n_buff_ptr,schema_len))
+    {
+        schema_len++;
+    }
 
     // advance by the schema length
-    n_buff_ptr += n_msg["schema"].total_bytes_compact();
+    n_buff_ptr += schema_len;
     
     // apply the schema to the data
     n_msg["data"].set_external(rcv_schema,n_buff_ptr);
@@ -1029,9 +1062,10 @@ gather_using_schema(Node &send_node,
     int m_size = mpi::size(mpi_comm);
     int m_rank = mpi::rank(mpi_comm);
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    std::vector<uint8> schema_bin;
+    n_snd_compact.schema().to_binary(schema_bin);
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
+    int schema_len = static_cast<int>(schema_bin.size());
     int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
     
     // to do the conduit gatherv, first need a gather to get the 
@@ -1114,7 +1148,7 @@ gather_using_schema(Node &send_node,
         schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
     }
 
-    mpi_error = MPI_Gatherv( const_cast <char*>(schema_str.c_str()),
+    mpi_error = MPI_Gatherv( &schema_bin[0],
                              schema_len,
                              MPI_BYTE,
                              schema_rcv_buff,
@@ -1126,7 +1160,7 @@ gather_using_schema(Node &send_node,
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // build all schemas from JSON, compact them.
+    // build all schemas, compact them.
     Schema rcv_schema;
     if( m_rank == root )
     {
@@ -1137,7 +1171,9 @@ gather_using_schema(Node &send_node,
         for(int i=0;i < m_size; i++)
         {
             Schema &s = s_tmp.append();
-            s.set(&schema_rcv_buff[schema_rcv_displs[i]]);
+            schema_from_message(&schema_rcv_buff[schema_rcv_displs[i]],
+                                schema_rcv_counts[i],
+                                s);
         }
         
         s_tmp.compact_to(rcv_schema);
@@ -1178,9 +1214,10 @@ all_gather_using_schema(Node &send_node,
 
     int m_size = mpi::size(mpi_comm);
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    std::vector<uint8> schema_bin;
+    n_snd_compact.schema().to_binary(schema_bin);
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
+    int schema_len = static_cast<int>(schema_bin.size());
     int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
     
     // to do the conduit gatherv, first need a gather to get the 
@@ -1258,7 +1295,7 @@ all_gather_using_schema(Node &send_node,
     n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
     schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
 
-    mpi_error = MPI_Allgatherv( const_cast <char*>(schema_str.c_str()),
+    mpi_error = MPI_Allgatherv( &schema_bin[0],
                                 schema_len,
                                 MPI_BYTE,
                                 schema_rcv_buff,
@@ -1269,7 +1306,7 @@ all_gather_using_schema(Node &send_node,
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // build all schemas from JSON, compact them.
+    // build all schemas, compact them.
     Schema rcv_schema;
     //TODO: should we make it easer to create a compact schema?
     // TODO: Revisit, I think we can do this better
@@ -1277,7 +1314,9 @@ all_gather_using_schema(Node &send_node,
     for(int s_idx=0; s_idx < m_size; s_idx++)
     {
         Schema &s_new = s_tmp.append();
-        s_new.set(&schema_rcv_buff[schema_rcv_displs[s_idx]]);
+        schema_from_message(&schema_rcv_buff[schema_rcv_displs[s_idx]],
+                            schema_rcv_counts[s_idx],
+                            s_new);
     }
     
     // TODO can we support copy out w/out realloc
@@ -1373,6 +1412,7 @@ broadcast_using_schema(Node &node,
     void *bcast_data_ptr = NULL;
     int   bcast_data_size = 0;
 
+    std::vector<uint8> bcast_schema_bin;
     int bcast_schema_size = 0;
     int rcv_bcast_schema_size = 0;
 
@@ -1387,7 +1427,7 @@ broadcast_using_schema(Node &node,
            node.is_compact() && 
            node.is_contiguous())
         {
-            bcast_buffers["schema"] = node.schema().to_json();
+            node.schema().to_binary(bcast_schema_bin);
         }
         else
         {
@@ -1395,12 +1435,12 @@ broadcast_using_schema(Node &node,
             node.compact_to(bcast_data_compact);
             
             bcast_data_ptr  = bcast_data_compact.data_ptr();
-            bcast_buffers["schema"] =  bcast_data_compact.schema().to_json();
+            bcast_data_compact.schema().to_binary(bcast_schema_bin);
         }
      
 
         
-        bcast_schema_size = static_cast<int>(bcast_buffers["schema"].dtype().number_of_elements());
+        bcast_schema_size = static_cast<int>(bcast_schema_bin.size());
     }
 
     int mpi_error = MPI_Allreduce(&bcast_schema_size,
@@ -1417,13 +1457,13 @@ broadcast_using_schema(Node &node,
     // alloc for rcv for schema
     if(rank != root)
     {
-        bcast_buffers["schema"].set(DataType::char8_str(bcast_schema_size));
+        bcast_schema_bin.resize((size_t)bcast_schema_size);
     }
 
     // broadcast the schema 
-    mpi_error = MPI_Bcast(bcast_buffers["schema"].data_ptr(),
+    mpi_error = MPI_Bcast(&bcast_schema_bin[0],
                           bcast_schema_size,
-                          MPI_CHAR,
+                          MPI_BYTE,
                           root,
                           comm);
 
@@ -1435,8 +1475,9 @@ broadcast_using_schema(Node &node,
     if(rank != root)
     {
         Schema bcast_schema;
-        Generator gen(bcast_buffers["schema"].as_char8_str());
-        gen.walk(bcast_schema);
+        schema_from_message(&bcast_schema_bin[0],
+                            (index_t)bcast_schema_bin.size(),
+                            bcast_schema);
         
         // only check compat for leaves
         // there are more zero copy cases possible here, but
@@ -264,18 +264,18 @@ save(const Node &node,
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        Node prev_options;
-        if(options.has_child("hdf5"))
+        // hdf5 is the only protocol that currently takes "options"
+        if(options.has_path("hdf5/shared_file"))
         {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
+            hdf5_save_shared(node,path,options["hdf5/shared_file"],comm);
         }
-
-        hdf5_save(node,path);
-        
-        if(!prev_options.dtype().is_empty())
+        else if(options.has_child("hdf5"))
         {
-            hdf5_set_options(prev_options);
+            hdf5_save(node,path,options["hdf5"]);
+        }
+        else
+        {
+            hdf5_save(node,path);
         }
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " << 
@@ -369,22 +369,15 @@ save_merged(const Node &node,
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        
-        Node prev_options;
+        // hdf5 is the only protocol that currently takes "options"
         if(options.has_child("hdf5"))
         {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
+            hdf5_write(node,path,options["hdf5"]);
         }
-        
-        hdf5_write(node,path);
-        
-        if(!prev_options.dtype().is_empty())
+        else
         {
-            hdf5_set_options(prev_options);
+            hdf5_write(node,path);
         }
-        
-        
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " << 
                       "Failed to save conduit node to path " << path);
@@ -523,6 +516,9 @@ load(const std::string &path,
      Node &node,
      MPI_Comm comm)
 {
+    // we expect options to unused if all 3rd party i/o options are disabled
+    // avoid warning using CONDUIT_UNUSED macro.
+    CONDUIT_UNUSED(options);
 
     std::string protocol = protocol_;
     // allow empty protocol to be used for auto detect
@@ -543,19 +539,14 @@ load(const std::string &path,
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        node.reset();
-        Node prev_options;
-        if(options.has_child("hdf5"))
+        if(options.has_path("hdf5/shared_file"))
         {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
+            hdf5_load_shared(path,node,comm);
         }
-        
-        hdf5_read(path,node);
-        
-        if(!prev_options.dtype().is_empty())
+        else
         {
-            hdf5_set_options(prev_options);
+            node.reset();
+            hdf5_read(path,node);
         }
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " << 
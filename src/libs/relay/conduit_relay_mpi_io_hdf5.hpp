@@ -55,6 +55,7 @@
 // external lib includes
 //-----------------------------------------------------------------------------
 #include <hdf5.h>
+#include <mpi.h>
 
 //-----------------------------------------------------------------------------
 // conduit lib include 
@@ -89,6 +90,44 @@ namespace io
 
 #include "conduit_relay_io_hdf5_api.hpp"
 
+//-----------------------------------------------------------------------------
+/// Save every rank's node into one shared hdf5 file (collective).
+///
+/// opts["layout"] selects how the ranks' trees are stored:
+///
+///  "rank_groups" (default): each rank's tree is written to the group
+///    "rank_<rank>".
+///
+///  "concatenate": all ranks must have the same tree (same paths and
+///    numeric leaf types, the number of elements can differ). Each leaf is
+///    written to one dataset that holds the elements of all ranks, in rank 
+///    order.
+///
+/// The ranks take turns writing their data (rank 0 creates the file and
+/// its layout). If a rank's turn fails, all ranks raise an error.
+///
+/// The hdf5 storage options (compact, chunking, compression) are not used
+/// for shared files.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_save_shared(const Node &node,
+                                        const std::string &path,
+                                        MPI_Comm comm);
+
+void CONDUIT_RELAY_API hdf5_save_shared(const Node &node,
+                                        const std::string &path,
+                                        const Node &opts,
+                                        MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+/// Load this rank's node from a file written by hdf5_save_shared 
+/// (collective).
+///
+/// The file must be loaded with the same number of ranks that saved it.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_load_shared(const std::string &path,
+                                        Node &node,
+                                        MPI_Comm comm);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::mpi::io --
@@ -1,5 +1,5 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// Copyright (c) 2014-2015, Lawrence Livermore National Security, LLC.
 // 
 // Produced at the Lawrence Livermore National Laboratory
 // 
@@ -9,7 +9,7 @@
 // 
 // This file is part of Conduit. 
 // 
-// For details, see: http://software.llnl.gov/conduit/.
+// For details, see: http://llnl.github.io/conduit/.
 // 
 // Please also read conduit/LICENSE
 // 
@@ -44,63 +44,54 @@
 
 //-----------------------------------------------------------------------------
 ///
-/// file: t_libb64_smoke.cpp
+/// file: b_conduit_node_paths.cpp
 ///
 //-----------------------------------------------------------------------------
 
+#include "conduit.hpp"
+
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <ctime>
 #include "gtest/gtest.h"
-#define BUFFERSIZE 65536
-#include "b64/encode.h"
-#include "b64/decode.h"
-
-
-std::string
-encode_decode(const std::string &val)
-{
-    std::string sin(val);
-    
-    std::istringstream iss(sin);
-    std::ostringstream oss;
-
-    base64::encoder e;
-    e.encode(iss,oss);
-    
-    std::cout << oss.str() << std::endl;
-    std::string sout = oss.str();
-    
-    
-    
-    iss.str(sout);
-    iss.clear();
-    oss.str("");
 
-    base64::decoder d;
+using namespace conduit;
 
-    d.decode(iss,oss);
-    
-    return oss.str();
-}
-
-
-TEST(libb64_smoke, basic_use )
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths_benchmark, node_path_fetch)
 {
-    std::string t = "test";
-    EXPECT_EQ(encode_decode(t),t);
+    Node n;
+    for(int i=0; i < 64; i++)
+    {
+        std::ostringstream oss;
+        oss << "fields/f" << i << "/values";
+        n[oss.str()] = i;
+    }
 
-    // test a shorter string ...
-    t = "t";
-    EXPECT_EQ(encode_decode(t),t);
+    int num_iters = 1000000;
+    std::string path_str("fields/f63/values");
+    NodePath path(path_str);
 
-    // test an empty string
-    t = "";
-    EXPECT_EQ(encode_decode(t),t);
+    int64 str_sum = 0;
+    clock_t t_start = clock();
+    for(int i=0; i < num_iters; i++)
+    {
+        str_sum += n[path_str].as_int();
+    }
+    clock_t t_str = clock() - t_start;
 
-    t = "test a longer string";
-    EXPECT_EQ(encode_decode(t),t);
+    int64 np_sum = 0;
+    t_start = clock();
+    for(int i=0; i < num_iters; i++)
+    {
+        np_sum += n[path].as_int();
+    }
+    clock_t t_np = clock() - t_start;
 
-    t = "test an even longer string with more vowels.";
-    EXPECT_EQ(encode_decode(t),t);
+    EXPECT_EQ(str_sum,np_sum);
 
+    std::cout << "fetch x" << num_iters << " (std::string, NodePath): "
+              << double(t_str) / CLOCKS_PER_SEC << " "
+              << double(t_np)  / CLOCKS_PER_SEC << std::endl;
 }
-
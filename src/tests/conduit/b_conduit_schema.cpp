@@ -0,0 +1,223 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2015, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://llnl.github.io/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_schema.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <map>
+#include <vector>
+#include <ctime>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// the name -> index layout schemas used before the hash index: a std::map
+// holding indices, plus the ordered names. removing a name re-indexes every
+// entry above it.
+//-----------------------------------------------------------------------------
+struct ref_object_names
+{
+    std::map<std::string,index_t> object_map;
+    std::vector<std::string>      object_order;
+
+    void add(const std::string &name)
+    {
+        object_map[name] = (index_t)object_order.size();
+        object_order.push_back(name);
+    }
+
+    index_t find(const std::string &name) const
+    {
+        std::map<std::string,index_t>::const_iterator itr;
+        itr = object_map.find(name);
+        if(itr == object_map.end())
+        {
+            return -1;
+        }
+        return itr->second;
+    }
+
+    void remove(const std::string &name)
+    {
+        std::map<std::string,index_t>::iterator itr = object_map.find(name);
+        index_t idx = itr->second;
+        object_map.erase(itr);
+        for(itr = object_map.begin(); itr != object_map.end(); itr++)
+        {
+            if(itr->second > idx)
+            {
+                itr->second--;
+            }
+        }
+        object_order.erase(object_order.begin() + (size_t)idx);
+    }
+};
+
+//-----------------------------------------------------------------------------
+static double
+elapsed(clock_t t_start)
+{
+    return double(clock() - t_start) / CLOCKS_PER_SEC;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_schema_benchmark, many_children_insert_lookup_remove)
+{
+    // lookups and removes on both sides map names to indices directly
+    // (no path handling), and both keep the ordered names up to date on
+    // remove. schema inserts go through fetch, which also splits the path.
+    index_t num_children = 20000;
+    int     num_lookup_reps = 10;
+
+    std::vector<std::string> names;
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        names.push_back(oss.str());
+    }
+
+    Schema s;
+    ref_object_names ref;
+
+    // insert
+    clock_t t_start = clock();
+    for(index_t i=0; i < num_children; i++)
+    {
+        s.fetch(names[i]);
+    }
+    double t_schema_insert = elapsed(t_start);
+
+    t_start = clock();
+    for(index_t i=0; i < num_children; i++)
+    {
+        ref.add(names[i]);
+    }
+    double t_ref_insert = elapsed(t_start);
+
+    // lookup
+    index_t schema_sum = 0;
+    t_start = clock();
+    for(int r=0; r < num_lookup_reps; r++)
+    {
+        for(index_t i=0; i < num_children; i++)
+        {
+            schema_sum += s.child_index(names[i]);
+        }
+    }
+    double t_schema_lookup = elapsed(t_start);
+
+    index_t ref_sum = 0;
+    t_start = clock();
+    for(int r=0; r < num_lookup_reps; r++)
+    {
+        for(index_t i=0; i < num_children; i++)
+        {
+            ref_sum += ref.find(names[i]);
+        }
+    }
+    double t_ref_lookup = elapsed(t_start);
+
+    EXPECT_EQ(schema_sum,ref_sum);
+
+    // remove every other child from the front quarter, where erasing from
+    // the ordered names dominates, and from the back quarter, where the
+    // name -> index bookkeeping dominates
+    index_t front_end  = num_children / 4;
+    index_t back_start = num_children - num_children / 4;
+
+    t_start = clock();
+    for(index_t i=0; i < front_end; i+=2)
+    {
+        s.remove(names[i]);
+    }
+    double t_schema_remove_front = elapsed(t_start);
+
+    t_start = clock();
+    for(index_t i=0; i < front_end; i+=2)
+    {
+        ref.remove(names[i]);
+    }
+    double t_ref_remove_front = elapsed(t_start);
+
+    t_start = clock();
+    for(index_t i=num_children-2; i >= back_start; i-=2)
+    {
+        s.remove(names[i]);
+    }
+    double t_schema_remove_back = elapsed(t_start);
+
+    t_start = clock();
+    for(index_t i=num_children-2; i >= back_start; i-=2)
+    {
+        ref.remove(names[i]);
+    }
+    double t_ref_remove_back = elapsed(t_start);
+
+    EXPECT_EQ(s.number_of_children(),(index_t)ref.object_order.size());
+    for(size_t i=0; i < ref.object_order.size(); i++)
+    {
+        EXPECT_EQ(s.child_index(ref.object_order[i]),(index_t)i);
+    }
+
+    std::cout << "children: " << num_children << std::endl
+              << "insert (schema, reference): "
+              << t_schema_insert << " " << t_ref_insert << std::endl
+              << "lookup x" << num_lookup_reps << " (schema, reference): "
+              << t_schema_lookup << " " << t_ref_lookup << std::endl
+              << "remove front (schema, reference): "
+              << t_schema_remove_front << " " << t_ref_remove_front
+              << std::endl
+              << "remove back (schema, reference): "
+              << t_schema_remove_back << " " << t_ref_remove_back
+              << std::endl;
+}
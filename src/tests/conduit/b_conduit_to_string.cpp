@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2015, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://llnl.github.io/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: b_conduit_to_string.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <ctime>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_to_string_benchmark, numeric_array_to_json)
+{
+    index_t nvals = 1000000;
+    Node n;
+    n["f64"].set(DataType::float64(nvals));
+    n["i64"].set(DataType::int64(nvals));
+    float64_array f_vals = n["f64"].value();
+    int64_array   i_vals = n["i64"].value();
+    for(index_t i=0; i < nvals; i++)
+    {
+        f_vals[i] = (i * 1.0001) / 7.0;
+        i_vals[i] = i * 1234567;
+    }
+
+    const char *paths[2] = {"f64", "i64"};
+    for(int p=0; p < 2; p++)
+    {
+        const Node &leaf = n[paths[p]];
+
+        clock_t t_start = clock();
+        std::ostringstream oss;
+        leaf.to_json_stream(oss);
+        clock_t t_emit = clock() - t_start;
+
+        // reference: per value stream output, as done before the
+        // buffered emitter
+        t_start = clock();
+        std::ostringstream oss_ref;
+        oss_ref << "[";
+        for(index_t i=0; i < nvals; i++)
+        {
+            if(i > 0)
+                oss_ref << ", ";
+            if(p == 0)
+                oss_ref << utils::float64_to_string(f_vals[i]);
+            else
+                oss_ref << i_vals[i];
+        }
+        oss_ref << "]";
+        clock_t t_ref = clock() - t_start;
+
+        double emit_secs = double(t_emit) / CLOCKS_PER_SEC;
+        double ref_secs  = double(t_ref)  / CLOCKS_PER_SEC;
+        double mbytes = double(oss.str().size()) / (1024.0 * 1024.0);
+
+        std::cout << paths[p] << " to_json (emitter, per value stream): "
+                  << emit_secs << " " << ref_secs << " secs, emitter "
+                  << (emit_secs > 0 ? mbytes / emit_secs : 0.0)
+                  << " MB/s" << std::endl;
+    }
+}
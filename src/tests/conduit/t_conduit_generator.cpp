@@ -506,3 +506,103 @@ TEST(conduit_generator, yaml_parsing_errors)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, pure_json_types)
+{
+    std::string json = "{\n"
+                       "  \"ints\": [1, 2, -3, 4],\n"
+                       "  \"floats\": [1, 2.5, 3],\n"
+                       "  \"mixed\": [1, 2.5, 18446744073709551615, \"s\", true, null, [1,2], {\"a\": 1}],\n"
+                       "  \"empty_list\": [],\n"
+                       "  \"empty_obj\": {},\n"
+                       "  \"int\": -5,\n"
+                       "  \"big\": 18446744073709551615,\n"
+                       "  \"float\": 3.5,\n"
+                       "  \"str\": \"hello\",\n"
+                       "  \"t\": true,\n"
+                       "  \"f\": false,\n"
+                       "  \"null\": null,\n"
+                       "  \"nested\": {\"a\": {\"b\": [[1.5], [\"x\"]]}},\n"
+                       "  \"path/key\": 7\n"
+                       "}";
+
+    Generator g(json,"json");
+    Node n;
+    g.walk(n);
+    n.print();
+
+    EXPECT_TRUE(n.is_compact());
+    EXPECT_TRUE(n.contiguous_data_ptr() != NULL);
+
+    EXPECT_TRUE(n["ints"].dtype().is_int64());
+    EXPECT_EQ(n["ints"].dtype().number_of_elements(),4);
+    int64_array ints = n["ints"].value();
+    EXPECT_EQ(ints[2],-3);
+
+    EXPECT_TRUE(n["floats"].dtype().is_float64());
+    float64_array floats = n["floats"].value();
+    EXPECT_EQ(floats[0],1.0);
+    EXPECT_EQ(floats[1],2.5);
+
+    Node &mixed = n["mixed"];
+    EXPECT_TRUE(mixed.dtype().is_list());
+    EXPECT_EQ(mixed.number_of_children(),8);
+    EXPECT_TRUE(mixed[0].dtype().is_int64());
+    EXPECT_EQ(mixed[0].as_int64(),1);
+    EXPECT_TRUE(mixed[1].dtype().is_float64());
+    EXPECT_EQ(mixed[1].as_float64(),2.5);
+    EXPECT_TRUE(mixed[2].dtype().is_uint64());
+    EXPECT_EQ(mixed[2].as_uint64(),18446744073709551615ULL);
+    EXPECT_EQ(mixed[3].as_string(),"s");
+    EXPECT_EQ(mixed[4].as_uint8(),1);
+    EXPECT_TRUE(mixed[5].dtype().is_empty());
+    EXPECT_TRUE(mixed[6].dtype().is_int64());
+    EXPECT_EQ(mixed[6].dtype().number_of_elements(),2);
+    EXPECT_EQ(mixed[7]["a"].as_int64(),1);
+
+    EXPECT_TRUE(n["empty_list"].dtype().is_list());
+    EXPECT_EQ(n["empty_list"].number_of_children(),0);
+    EXPECT_TRUE(n["empty_obj"].dtype().is_object());
+
+    EXPECT_EQ(n["int"].as_int64(),-5);
+    EXPECT_EQ(n["big"].as_uint64(),18446744073709551615ULL);
+    EXPECT_EQ(n["float"].as_float64(),3.5);
+    EXPECT_EQ(n["str"].as_string(),"hello");
+    EXPECT_EQ(n["t"].as_uint8(),1);
+    EXPECT_EQ(n["f"].as_uint8(),0);
+    EXPECT_TRUE(n["null"].dtype().is_empty());
+    EXPECT_EQ(n["nested/a/b"][0].as_float64_ptr()[0],1.5);
+    EXPECT_EQ(n["nested/a/b"][1][0].as_string(),"x");
+    EXPECT_EQ(n["path/key"].as_int64(),7);
+
+    // walk_external gives the same result
+    Node n_ext;
+    g.walk_external(n_ext);
+    Node info;
+    EXPECT_FALSE(n.diff(n_ext,info));
+
+    // top level leaves and arrays
+    Generator g_leaf("[1, 2, 3]","json");
+    g_leaf.walk(n);
+    EXPECT_TRUE(n.dtype().is_int64());
+    EXPECT_EQ(n.dtype().number_of_elements(),3);
+
+    g_leaf.set_schema("3.5");
+    g_leaf.walk(n);
+    EXPECT_EQ(n.as_float64(),3.5);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, pure_json_errors)
+{
+    Node n;
+    Generator g("{\"a\": 1, \"a\": 2}","json");
+    EXPECT_THROW(g.walk(n),conduit::Error);
+
+    g.set_schema("{\"a\": [1, 2,]}");
+    EXPECT_THROW(g.walk(n),conduit::Error);
+
+    g.set_schema("{\"a\": 1");
+    EXPECT_THROW(g.walk(n),conduit::Error);
+}
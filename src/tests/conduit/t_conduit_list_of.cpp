@@ -238,3 +238,56 @@ TEST(conduit_list_of, dtype)
     
     
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_list_of, shared_child_names)
+{
+    Schema s_domain;
+    s_domain["coordsets/coords/values/x"].set(DataType::float64(8));
+    s_domain["coordsets/coords/values/y"].set(DataType::float64(8));
+    s_domain["fields/pressure/values"].set(DataType::float64(8));
+    s_domain["fields/temperature/values"].set(DataType::float64(8));
+
+    Node n;
+    n.list_of(s_domain,100);
+    EXPECT_EQ(n.number_of_children(),100);
+    EXPECT_EQ(n.allocated_bytes(),100 * 4 * 8 * 8);
+
+    // every domain refers to the same child names 
+    const std::vector<std::string> &names = n[0]["fields"].child_names();
+    for(index_t i=1; i < 100; i++)
+    {
+        EXPECT_EQ(&n[i]["fields"].child_names(),&names);
+        EXPECT_EQ(&n[i]["coordsets/coords/values"].child_names(),
+                  &n[0]["coordsets/coords/values"].child_names());
+    }
+
+    // changing one domain's names copies them first
+    n[5]["fields/density/values"].set(DataType::float64(8));
+    EXPECT_NE(&n[5]["fields"].child_names(),&names);
+    EXPECT_EQ(n[5]["fields"].number_of_children(),3);
+    EXPECT_EQ(n[4]["fields"].number_of_children(),2);
+    EXPECT_FALSE(n[4].has_path("fields/density"));
+
+    n[6]["fields"].rename_child("pressure","p");
+    EXPECT_TRUE(n[6].has_path("fields/p/values"));
+    EXPECT_TRUE(n[7].has_path("fields/pressure/values"));
+    EXPECT_FALSE(n[7].has_path("fields/p"));
+
+    n[8]["fields"].remove("temperature");
+    EXPECT_EQ(n[8]["fields"].number_of_children(),1);
+    EXPECT_EQ(n[9]["fields"].number_of_children(),2);
+    EXPECT_EQ(&n[9]["fields"].child_names(),&names);
+
+    // data is independent
+    n[1]["fields/pressure/values"].as_float64_ptr()[0] = 42.0;
+    EXPECT_EQ(n[2]["fields/pressure/values"].as_float64_ptr()[0],0.0);
+
+    // copies of the tree share too, and compare equal
+    Node n_copy;
+    n_copy.set(n);
+    EXPECT_FALSE(n.diff(n_copy));
+    n_copy.reset();
+    EXPECT_EQ(n[3]["fields"].number_of_children(),2);
+}
+
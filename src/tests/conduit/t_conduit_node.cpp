@@ -51,6 +51,10 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <algorithm>
+#ifdef CONDUIT_USE_CXX11
+#include <type_traits>
+#endif
 #include "gtest/gtest.h"
 #include "rapidjson/document.h"
 using namespace conduit;
@@ -1099,3 +1103,532 @@ TEST(conduit_node, test_parse_all_protos)
     EXPECT_FALSE(n.diff(n2,info));
 
 }
+
+//-----------------------------------------------------------------------------
+// counting allocator used to check allocator registration, the counts 
+// live in the allocator's context
+//-----------------------------------------------------------------------------
+struct tst_alloc_counts
+{
+    index_t num_allocs;
+    index_t num_frees;
+    index_t num_bytes;
+};
+
+//-----------------------------------------------------------------------------
+void *
+tst_counting_alloc(size_t num_bytes, void *context)
+{
+    tst_alloc_counts *counts = (tst_alloc_counts*)context;
+    counts->num_allocs++;
+    counts->num_bytes += (index_t)num_bytes;
+    return calloc(num_bytes,1);
+}
+
+//-----------------------------------------------------------------------------
+void
+tst_counting_free(void *data_ptr, size_t num_bytes, void *context)
+{
+    tst_alloc_counts *counts = (tst_alloc_counts*)context;
+    counts->num_frees++;
+    counts->num_bytes -= (index_t)num_bytes;
+    free(data_ptr);
+}
+
+//-----------------------------------------------------------------------------
+// simple bump arena, memory is reclaimed when the arena is reset
+//-----------------------------------------------------------------------------
+struct tst_arena
+{
+    std::vector<uint64> buffer;
+    size_t              used;
+    size_t              live_bytes;
+};
+
+//-----------------------------------------------------------------------------
+void *
+tst_arena_alloc(size_t num_bytes, void *context)
+{
+    tst_arena *arena = (tst_arena*)context;
+    // keep allocations 8 byte aligned
+    size_t num_words = (num_bytes + 7) / 8;
+    if(arena->used + num_words > arena->buffer.size())
+    {
+        return NULL;
+    }
+    void *res = &arena->buffer[arena->used];
+    arena->used += num_words;
+    arena->live_bytes += num_bytes;
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+tst_arena_free(void *, size_t num_bytes, void *context)
+{
+    tst_arena *arena = (tst_arena*)context;
+    arena->live_bytes -= num_bytes;
+    if(arena->live_bytes == 0)
+    {
+        // everything was released, start over (arena memory is zeroed)
+        std::fill(arena->buffer.begin(),
+                  arena->buffer.begin() + arena->used,
+                  0);
+        arena->used = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, allocator)
+{
+    tst_alloc_counts counts;
+    counts.num_allocs = 0;
+    counts.num_frees  = 0;
+    counts.num_bytes  = 0;
+
+    index_t alloc_id = utils::register_allocator(tst_counting_alloc,
+                                                 tst_counting_free,
+                                                 &counts);
+    EXPECT_TRUE(utils::is_allocator(alloc_id));
+    EXPECT_FALSE(utils::is_allocator(alloc_id + 1));
+
+    {
+        Node n;
+        EXPECT_EQ(n.allocator(),utils::default_allocator());
+        n.set_allocator(alloc_id);
+
+        // new children inherit the allocator from their parent
+        n["a/b"] = (int64) 10;
+        n["a/c"].set(DataType::float64(100));
+        n["d"].append() = "my string";
+
+        EXPECT_EQ(n["a/b"].allocator(),alloc_id);
+        EXPECT_EQ(n["d"][0].allocator(),alloc_id);
+        EXPECT_EQ(counts.num_allocs,3);
+
+        // compact_to allocates using the destination's allocator
+        Node n_compact;
+        n_compact.set_allocator(alloc_id);
+        n.compact_to(n_compact);
+        EXPECT_EQ(counts.num_allocs,4);
+        EXPECT_EQ(n_compact["a/b"].as_int64(),10);
+
+        // switching allocators does not change how owned memory is freed
+        n["a/b"].set_allocator(0);
+        n["a/b"] = (float32) 3.0;
+        EXPECT_EQ(counts.num_frees,1);
+        EXPECT_EQ(counts.num_allocs,4);
+    }
+
+    EXPECT_EQ(counts.num_allocs,counts.num_frees);
+
+    // default allocator is used by new root nodes
+    utils::set_default_allocator(alloc_id);
+    {
+        Node n;
+        n.set(DataType::int32(10));
+        EXPECT_EQ(n.allocator(),alloc_id);
+    }
+    utils::set_default_allocator(0);
+
+    EXPECT_EQ(counts.num_allocs,5);
+    EXPECT_EQ(counts.num_allocs,counts.num_frees);
+
+    Node n;
+    EXPECT_THROW(n.set_allocator(alloc_id + 1),conduit::Error);
+
+    // release gets the allocated size
+    EXPECT_EQ(counts.num_bytes,0);
+
+    // an arena, selected through its context
+    tst_arena arena;
+    arena.buffer.resize(1024,0);
+    arena.used = 0;
+    arena.live_bytes = 0;
+    index_t arena_id = utils::register_allocator(tst_arena_alloc,
+                                                 tst_arena_free,
+                                                 &arena);
+    {
+        Node n_arena;
+        n_arena.set_allocator(arena_id);
+        n_arena["a"].set(DataType::float64(10));
+        n_arena["b"] = (int32) 5;
+        EXPECT_EQ(arena.used,11);
+        EXPECT_EQ(arena.live_bytes,84);
+        EXPECT_EQ(n_arena["a"].data_ptr(),(void*)&arena.buffer[0]);
+        EXPECT_EQ(n_arena["b"].as_int32(),5);
+    }
+    EXPECT_EQ(arena.used,0);
+    EXPECT_EQ(arena.live_bytes,0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, swap)
+{
+    Node n1;
+    n1["a/b"] = 10;
+    n1["a/c"].set(DataType::float64(5));
+    float64 *c_ptr = n1["a/c"].value();
+
+    Node n2;
+    n2.set(DataType::int32(4));
+    void *n2_ptr = n2.data_ptr();
+
+    n1.swap(n2);
+
+    // data is handed over, not copied
+    EXPECT_TRUE(n1.dtype().is_int32());
+    EXPECT_EQ(n1.data_ptr(),n2_ptr);
+    EXPECT_TRUE(n2.dtype().is_object());
+    EXPECT_EQ(n2["a/b"].to_int64(),10);
+    EXPECT_EQ((float64*)n2["a/c"].data_ptr(),c_ptr);
+
+    // children are relinked
+    EXPECT_EQ(n2["a"].parent(),&n2);
+    EXPECT_EQ(n2["a"].schema().parent(),n2.schema_ptr());
+    EXPECT_EQ(n2["a/b"].path(),"a/b");
+
+    // swap a subtree between two trees
+    Node n3;
+    n3["x/y"] = "hi";
+    n2["a"].swap(n3["x"]);
+    EXPECT_EQ(n2["a/y"].as_string(),"hi");
+    EXPECT_EQ(n3["x/b"].to_int64(),10);
+    EXPECT_EQ(n3["x/b"].path(),"x/b");
+    EXPECT_EQ(n2.child_names()[0],"a");
+
+    // can't swap with an ancestor
+    EXPECT_THROW(n3.swap(n3["x"]),conduit::Error);
+    EXPECT_THROW(n3["x/b"].swap(n3),conduit::Error);
+
+    // data owned by an ancestor falls back to copies
+    Schema s;
+    s["a"].set(DataType::int64());
+    s["b"].set(DataType::float64());
+    Node n4(s);
+    n4["a"] = 1;
+    n4["b"] = 2.0;
+    Node n5;
+    n5 = 42;
+    n4["a"].swap(n5);
+    EXPECT_EQ(n4["a"].to_int64(),42);
+    EXPECT_EQ(n5.to_int64(),1);
+    EXPECT_NE(n5.data_ptr(),n4["a"].data_ptr());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, hash)
+{
+    float64 xyz[12];
+    for(int i=0;i<12;i++)
+    {
+        xyz[i] = i * 1.5;
+    }
+
+    // strided external view vs compact copy
+    Node n1;
+    n1["coords/x"].set_external(DataType::float64(4,0,3*sizeof(float64)),xyz);
+    n1["coords/y"].set_external(DataType::float64(4,sizeof(float64),
+                                                  3*sizeof(float64)),xyz);
+    n1["name"] = "mesh";
+    n1["ids"].append() = 1;
+    n1["ids"].append() = 2;
+
+    Node n2;
+    n1.compact_to(n2);
+    EXPECT_EQ(n1.hash(),n2.hash());
+
+    // object child order does not matter
+    Node n3;
+    n3["name"] = "mesh";
+    n3["ids"].append() = 1;
+    n3["ids"].append() = 2;
+    n3["coords/y"].set(n1["coords/y"]);
+    n3["coords/x"].set(n1["coords/x"]);
+    EXPECT_EQ(n1.hash(),n3.hash());
+
+    // list order does
+    Node n4;
+    n4.update(n3);
+    n4["ids"][0] = 2;
+    n4["ids"][1] = 1;
+    EXPECT_NE(n1.hash(),n4.hash());
+
+    // data and dtype changes
+    n3["coords/x"].as_float64_ptr()[2] = -1.0;
+    EXPECT_NE(n1.hash(),n3.hash());
+
+    Node n5;
+    n5.set(DataType::int32(4));
+    Node n6;
+    n6.set(DataType::uint32(4));
+    EXPECT_NE(n5.hash(),n6.hash());
+
+    Node e1, e2;
+    EXPECT_EQ(e1.hash(),e2.hash());
+    EXPECT_NE(e1.hash(),n5.hash());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, hash_tree_update)
+{
+    Node n;
+    n["fields/pressure/values"].set(DataType::float64(10));
+    n["fields/temperature/values"].set(DataType::float64(10));
+    n["topo/conn"].set(DataType::int32(8));
+    n["state/cycle"] = 1;
+
+    Node digests;
+    std::vector<std::string> changed;
+    n.hash_tree_update(digests,changed);
+    ASSERT_EQ(changed.size(),1);
+    EXPECT_EQ(changed[0],"");
+
+    // no changes
+    changed.clear();
+    n.hash_tree_update(digests,changed);
+    EXPECT_EQ(changed.size(),0);
+
+    // leaf changes
+    changed.clear();
+    n["fields/temperature/values"].as_float64_ptr()[3] = 42.0;
+    n["state/cycle"] = 2;
+    n.hash_tree_update(digests,changed);
+    ASSERT_EQ(changed.size(),2);
+    EXPECT_EQ(changed[0],"fields/temperature/values");
+    EXPECT_EQ(changed[1],"state/cycle");
+
+    // structure changes are reported at the parent
+    changed.clear();
+    n["fields/velocity/values"].set(DataType::float64(10));
+    n.hash_tree_update(digests,changed);
+    ASSERT_EQ(changed.size(),1);
+    EXPECT_EQ(changed[0],"fields");
+
+    // list children are reported by index
+    n["domains"].append()["id"] = 0;
+    n["domains"].append()["id"] = 1;
+    n.hash_tree_update(digests,changed);
+    changed.clear();
+    n["domains"][1]["id"] = 7;
+    n.hash_tree_update(digests,changed);
+    ASSERT_EQ(changed.size(),1);
+    EXPECT_EQ(changed[0],"domains/1/id");
+
+    // changes relative to a subtree
+    Node sub_digests;
+    changed.clear();
+    n["fields"].hash_tree_update(sub_digests,changed);
+    changed.clear();
+    n["fields/pressure/values"].as_float64_ptr()[0] = 1.0;
+    n["fields"].hash_tree_update(sub_digests,changed);
+    ASSERT_EQ(changed.size(),1);
+    EXPECT_EQ(changed[0],"pressure/values");
+}
+
+
+#ifdef CONDUIT_USE_CXX11
+//-----------------------------------------------------------------------------
+Node
+make_move_test_tree(int64 **data_ptr)
+{
+    Node res;
+    res["fields/pressure/values"].set(DataType::int64(100));
+    *data_ptr = res["fields/pressure/values"].value();
+    for(int i=0;i<100;i++)
+    {
+        (*data_ptr)[i] = i;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, move)
+{
+    int64 *vals_ptr = NULL;
+    Node n1(make_move_test_tree(&vals_ptr));
+    EXPECT_EQ(n1["fields/pressure/values"].data_ptr(),(void*)vals_ptr);
+    EXPECT_EQ(n1["fields"].parent(),&n1);
+
+    // move construction
+    Node n2(std::move(n1));
+    EXPECT_TRUE(n1.dtype().is_empty());
+    EXPECT_EQ(n2["fields/pressure/values"].data_ptr(),(void*)vals_ptr);
+    EXPECT_EQ(n2["fields/pressure"].parent(),&n2["fields"]);
+
+    // move assignment
+    Node n3;
+    n3["old"] = 1;
+    n3 = std::move(n2);
+    EXPECT_TRUE(n2.dtype().is_empty());
+    EXPECT_FALSE(n3.has_child("old"));
+    EXPECT_EQ(n3["fields/pressure/values"].data_ptr(),(void*)vals_ptr);
+    int64_array vals = n3["fields/pressure/values"].value();
+    EXPECT_EQ(vals[99],99);
+
+    // move a subtree into another tree
+    Node n4;
+    n4["mesh/fields"].set(std::move(n3["fields"]));
+    EXPECT_TRUE(n3["fields"].dtype().is_empty());
+    EXPECT_EQ(n4["mesh/fields/pressure/values"].data_ptr(),(void*)vals_ptr);
+    EXPECT_EQ(n4["mesh/fields/pressure"].path(),"mesh/fields/pressure");
+
+    // move a descendant into its ancestor
+    n4["mesh"] = std::move(n4["mesh/fields/pressure"]);
+    EXPECT_EQ(n4["mesh/values"].data_ptr(),(void*)vals_ptr);
+    EXPECT_FALSE(n4.has_path("mesh/fields"));
+
+    // can't move into a descendant
+    EXPECT_THROW(n4["mesh/values"].set_node(std::move(n4["mesh"])),
+                 conduit::Error);
+
+    // nodes in vectors: moves are noexcept, so growing the vector moves
+    // the nodes instead of copying them
+    EXPECT_TRUE(std::is_nothrow_move_constructible<Node>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<Node>::value);
+    EXPECT_TRUE(std::is_nothrow_move_constructible<Schema>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<Schema>::value);
+
+    std::vector<Node> nodes;
+    nodes.reserve(1);
+    nodes.emplace_back();
+    nodes[0]["id"] = 0;
+    nodes[0]["vals"].set(DataType::float64(16));
+    void *id_ptr   = nodes[0]["id"].data_ptr();
+    void *vec_vals_ptr = nodes[0]["vals"].data_ptr();
+    for(int i=1;i<64;i++)
+    {
+        Node n;
+        n["id"] = i;
+        nodes.push_back(std::move(n));
+    }
+    // the vector reallocated
+    EXPECT_TRUE(nodes.capacity() > 1);
+    EXPECT_EQ(nodes[0]["id"].data_ptr(),id_ptr);
+    EXPECT_EQ(nodes[0]["vals"].data_ptr(),vec_vals_ptr);
+    EXPECT_EQ(nodes[7]["id"].to_int(),7);
+    EXPECT_EQ(nodes[63]["id"].to_int(),63);
+
+    // data owned by an ancestor is copied
+    Schema s;
+    s["a"].set(DataType::int64());
+    s["b"].set(DataType::float64());
+    Node n5(s);
+    n5["a"] = 5;
+    Node n6(std::move(n5["a"]));
+    EXPECT_EQ(n6.to_int64(),5);
+    EXPECT_EQ(n5["a"].to_int64(),5);
+    EXPECT_NE(n6.data_ptr(),n5["a"].data_ptr());
+
+    // schema moves
+    Schema s2(std::move(s));
+    EXPECT_TRUE(s.dtype().is_empty());
+    EXPECT_TRUE(s2.has_child("b"));
+    EXPECT_EQ(s2["b"].parent(),&s2);
+    Schema s3;
+    s3 = std::move(s2["b"]);
+    EXPECT_TRUE(s3.dtype().is_float64());
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// true if the node's data lives inside the node object
+bool
+tst_is_inline(const Node &n)
+{
+    const char *data_ptr = (const char*) n.data_ptr();
+    const char *node_ptr = (const char*) &n;
+    return data_ptr >= node_ptr && data_ptr < node_ptr + sizeof(Node);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, inline_leaf_data)
+{
+    // scalars and short strings are stored inside the node
+    Node n;
+    n["state/cycle"] = 100;
+    n["state/time"]  = 3.1415;
+    n["state/name"]  = "short";
+    n["big"].set(DataType::float64(4));
+
+    EXPECT_TRUE(tst_is_inline(n["state/cycle"]));
+    EXPECT_FALSE(n["state/cycle"].is_data_external());
+    EXPECT_EQ(n["state/cycle"].allocated_bytes(),4);
+    EXPECT_EQ(n["state/name"].as_string(),"short");
+    EXPECT_EQ(n["big"].allocated_bytes(),32);
+
+    // data_ptr is stable across reads and compatible updates
+    Node &cycle = n["state/cycle"];
+    void *cycle_ptr = cycle.data_ptr();
+    cycle = 101;
+    EXPECT_EQ(cycle.data_ptr(),cycle_ptr);
+    EXPECT_EQ(n["state/cycle"].to_int(),101);
+    EXPECT_EQ(n.fetch("state/cycle").data_ptr(),cycle_ptr);
+
+    // external nodes see the inline value
+    Node n_ext;
+    n_ext.set_external(n);
+    EXPECT_EQ(n_ext["state/cycle"].data_ptr(),cycle_ptr);
+    n_ext["state/cycle"] = 102;
+    EXPECT_EQ(cycle.to_int(),102);
+
+    // compaction of a tree uses one buffer, compaction of a leaf 
+    // uses inline storage
+    Node n_compact;
+    n.compact_to(n_compact);
+    EXPECT_EQ(n_compact["state/time"].as_float64(),3.1415);
+    EXPECT_EQ(n_compact["state/name"].as_string(),"short");
+    EXPECT_EQ(n_compact["state/cycle"].allocated_bytes(),0);
+    Node n_leaf;
+    n["state/time"].compact_to(n_leaf);
+    EXPECT_EQ(n_leaf.as_float64(),3.1415);
+    n_compact["state/time"].compact_to(n["other/time"]);
+    EXPECT_TRUE(tst_is_inline(n["other/time"]));
+
+    // root nodes never store values inline, so their data is handed
+    // over by swap and move
+    EXPECT_FALSE(tst_is_inline(n_leaf));
+    Node n_root;
+    n_root = 42;
+    EXPECT_FALSE(tst_is_inline(n_root));
+
+    // copies, updates and swaps keep the values
+    Node n_copy(n);
+    EXPECT_EQ(n_copy["state/name"].as_string(),"short");
+    EXPECT_FALSE(n.diff(n_copy));
+    n_copy.update(n);
+    EXPECT_EQ(n_copy["state/cycle"].to_int(),102);
+
+    // swapping a child's inline value copies it to a heap allocation 
+    // that is handed over: pointers taken before the swap keep 
+    // referring to the child's own storage
+    Node n_b;
+    n_b.set(DataType::int64(10));
+    n_b.as_int64_ptr()[9] = 9;
+    void *n_b_ptr = n_b.data_ptr();
+    Node &n_a = n["swap/a"];
+    n_a = "a string";
+    void *n_a_ptr = n_a.data_ptr();
+    EXPECT_TRUE(tst_is_inline(n_a));
+    n_a.swap(n_b);
+    EXPECT_EQ(n_b.as_string(),"a string");
+    EXPECT_FALSE(tst_is_inline(n_b));
+    EXPECT_NE(n_b.data_ptr(),n_a_ptr);
+    EXPECT_EQ(n_a.data_ptr(),n_b_ptr);
+    EXPECT_EQ(n_a.as_int64_ptr()[9],9);
+
+#ifdef CONDUIT_USE_CXX11
+    // move from a child with an inline value
+    n["swap/c"] = 7;
+    Node n_moved(std::move(n["swap/c"]));
+    EXPECT_EQ(n_moved.to_int(),7);
+    EXPECT_FALSE(tst_is_inline(n_moved));
+    EXPECT_TRUE(n["swap/c"].dtype().is_empty());
+#endif
+
+    // strings that don't fit use a heap allocation
+    n["state/name"] = "a string longer than the inline size";
+    EXPECT_FALSE(tst_is_inline(n["state/name"]));
+    EXPECT_EQ(n["state/name"].as_string(),
+              "a string longer than the inline size");
+}
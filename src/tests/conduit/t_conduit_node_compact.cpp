@@ -51,6 +51,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <vector>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -144,3 +145,64 @@ TEST(conduit_node_compact, compact_3)
         EXPECT_EQ(n_arr[i],nc_arr[i]);
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compact, compact_interleaved)
+{
+    index_t num_pts = 1000;
+    std::vector<float64> xyz((size_t)(num_pts * 3));
+    std::vector<int16>   ids((size_t)(num_pts * 2));
+    for(index_t i=0; i < num_pts; i++)
+    {
+        xyz[i*3]   = (float64)i;
+        xyz[i*3+1] = 2.0 * i;
+        xyz[i*3+2] = 3.0 * i;
+        ids[i*2]   = (int16)i;
+        ids[i*2+1] = (int16)-i;
+    }
+
+    index_t stride = 3 * sizeof(float64);
+    Node n;
+    n["coords/x"].set_external(&xyz[0],num_pts,0,stride);
+    n["coords/y"].set_external(&xyz[0],num_pts,sizeof(float64),stride);
+    n["coords/z"].set_external(&xyz[0],num_pts,2*sizeof(float64),stride);
+    n["ids"].set_external(&ids[0],num_pts,sizeof(int16),2*sizeof(int16));
+    EXPECT_FALSE(n.is_compact());
+
+    Node nc;
+    n.compact_to(nc);
+    EXPECT_TRUE(nc.is_compact());
+    EXPECT_TRUE(nc.is_contiguous());
+
+    float64_array y = nc["coords/y"].value();
+    float64_array z = nc["coords/z"].value();
+    int16_array  id = nc["ids"].value();
+    for(index_t i=0; i < num_pts; i++)
+    {
+        EXPECT_EQ(y[i],2.0 * i);
+        EXPECT_EQ(z[i],3.0 * i);
+        EXPECT_EQ(id[i],(int16)-i);
+    }
+
+    // data array compaction
+    std::vector<float64> z_vals((size_t)num_pts);
+    n["coords/z"].as_float64_array().compact_elements_to((uint8*)&z_vals[0]);
+    EXPECT_EQ(z_vals[num_pts-1],3.0 * (num_pts-1));
+
+    // compacting a compact, contiguous tree
+    Node nc2;
+    nc.compact_to(nc2);
+    EXPECT_NE(nc2.contiguous_data_ptr(),nc.contiguous_data_ptr());
+    Node info;
+    EXPECT_FALSE(nc2.diff(nc,info));
+
+    // serialize the strided tree, and read it back using the compact schema
+    std::vector<uint8> bytes;
+    n.serialize(bytes);
+    EXPECT_EQ((index_t)bytes.size(),n.total_bytes_compact());
+
+    Schema s_compact;
+    n.schema().compact_to(s_compact);
+    Node n_read(s_compact,&bytes[0],true);
+    EXPECT_FALSE(n_read.diff(nc,info));
+}
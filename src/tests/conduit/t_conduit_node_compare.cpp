@@ -483,3 +483,88 @@ TEST(conduit_node_compare, compare_list_size_diff)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, compare_fast)
+{
+    Node n_ref;
+    n_ref["a/b"].set(DataType::float64(10));
+    n_ref["a/c"] = "text";
+    n_ref["l"].append() = 1;
+    n_ref["l"].append().set(DataType::int32(4));
+    n_ref["e"];
+
+    std::vector<Node> cases(8);
+    for(size_t i = 0; i < cases.size(); i++)
+    {
+        cases[i].set(n_ref);
+    }
+    cases[1]["a/b"].as_float64_ptr()[9] = 1.0;   // data
+    cases[2]["a/c"] = "txet";                     // string data
+    cases[3]["l"][1].as_int32_ptr()[0] = 3;       // list data
+    cases[4]["l"].append() = 2;                   // extra list child
+    cases[5]["a/d"] = 3;                          // extra object child
+    cases[6]["a"].remove("c");                    // missing object child
+    cases[6]["a/x"] = "text";
+    cases[7]["a/b"].set(DataType::float32(10));   // dtype
+
+    for(size_t i = 0; i < cases.size(); i++)
+    {
+        for(size_t j = 0; j < cases.size(); j++)
+        {
+            Node info;
+            EXPECT_EQ(cases[i].diff(cases[j]),
+                      cases[i].diff(cases[j], info));
+            EXPECT_EQ(cases[i].diff(cases[j]), i != j);
+        }
+    }
+
+    // object child order does not matter
+    Node n_reorder;
+    n_reorder["l"].set(n_ref["l"]);
+    n_reorder["e"];
+    n_reorder["a/c"] = "text";
+    n_reorder["a/b"].set(n_ref["a/b"]);
+    EXPECT_FALSE(n_ref.diff(n_reorder));
+
+    // strided vs compact, and epsilon
+    float64 xyz[12];
+    float64 y[4];
+    for(int i = 0; i < 4; i++)
+    {
+        xyz[i*3]   = 0.0;
+        xyz[i*3+1] = i * 0.5;
+        xyz[i*3+2] = 0.0;
+        y[i] = i * 0.5;
+    }
+    Node n_strided, n_compact, info;
+    n_strided.set_external(DataType::float64(4,sizeof(float64),
+                                             3*sizeof(float64)),xyz);
+    n_compact.set_external(y,4);
+    EXPECT_FALSE(n_strided.diff(n_compact));
+
+    y[2] += 1e-4;
+    EXPECT_TRUE(n_strided.diff(n_compact, 0.0));
+    EXPECT_FALSE(n_strided.diff(n_compact, 1e-3));
+    EXPECT_EQ(n_strided.diff(n_compact, 1e-3),
+              n_strided.diff(n_compact, info, 1e-3));
+
+    // large leaves (split across threads when OpenMP is enabled)
+    index_t num_ele = 4 * 1024 * 1024;
+    Node n_large, o_large;
+    n_large.set(DataType::int64(num_ele));
+    int64 *n_vals = n_large.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        n_vals[i] = i;
+    }
+    o_large.set(n_large);
+    EXPECT_FALSE(n_large.diff(o_large));
+
+    int64 *o_vals = o_large.value();
+    o_vals[num_ele - 1] = -1;
+    EXPECT_TRUE(n_large.diff(o_large));
+    o_vals[num_ele - 1] = num_ele - 1;
+    o_vals[num_ele / 3] = -1;
+    EXPECT_TRUE(n_large.diff(o_large));
+}
@@ -395,4 +395,105 @@ TEST(conduit_node_iterator, ref_constructor)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_iterator, leaf_itr)
+{
+    Node n;
+    n["a/b"] = 1;
+    n["a/c"].set(DataType::float64(3));
+    n["empty"];
+    n["l"].append() = "text";
+    n["l"].append()["d"] = (int32)2;
+
+    const char *paths[] = {"a/b", "a/c", "l/0", "l/1/d"};
+    const Node *leaves[] = {&n["a/b"], &n["a/c"], &n["l"][0], &n["l"][1]["d"]};
+
+    NodeConstLeafIterator itr(n);
+    EXPECT_EQ(itr.number_of_leaves(),4);
+    EXPECT_EQ(itr.order(),NodeConstLeafIterator::SCHEMA_ORDER);
+    index_t count = 0;
+    while(itr.has_next())
+    {
+        const Node &leaf = itr.next();
+        EXPECT_EQ(itr.index(),count);
+        EXPECT_EQ(itr.path(),std::string(paths[count]));
+        EXPECT_EQ(&leaf,leaves[count]);
+        EXPECT_EQ(itr.data_ptr(),leaves[count]->element_ptr(0));
+        EXPECT_EQ(itr.dtype().id(),leaves[count]->dtype().id());
+        count++;
+    }
+    EXPECT_EQ(count,4);
 
+    itr.to_front();
+    EXPECT_TRUE(itr.has_next());
+    itr.next();
+    EXPECT_EQ(itr.path(),"a/b");
+    Node info;
+    itr.info(info);
+    EXPECT_EQ(info["number_of_leaves"].to_index_t(),4);
+
+    // non-const access
+    NodeLeafIterator w_itr(n["a"]);
+    while(w_itr.has_next())
+    {
+        w_itr.next();
+        if(w_itr.path() == "c")
+        {
+            ((float64*)w_itr.data_ptr())[2] = 3.5;
+        }
+    }
+    EXPECT_EQ(n["a/c"].as_float64_ptr()[2],3.5);
+
+    // a leaf itself, and an empty node
+    NodeConstLeafIterator leaf_itr(n["a/b"]);
+    EXPECT_EQ(leaf_itr.number_of_leaves(),1);
+    leaf_itr.next();
+    EXPECT_EQ(leaf_itr.path(),"");
+    NodeConstLeafIterator empty_itr(n["empty"]);
+    EXPECT_FALSE(empty_itr.has_next());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_iterator, leaf_itr_address_order)
+{
+    // children in reverse order of their data in a compact buffer
+    float64 vals[6] = {0, 1, 2, 3, 4, 5};
+    Node n;
+    n["z"].set_external(DataType::float64(2,4*sizeof(float64)),vals);
+    n["y"].set_external(DataType::float64(2,2*sizeof(float64)),vals);
+    n["x"].set_external(DataType::float64(1,0),vals);
+    n["w"].set_external(DataType::float64(1,sizeof(float64)),vals);
+
+    NodeConstLeafIterator itr(n,NodeConstLeafIterator::ADDRESS_ORDER);
+    const char *paths[] = {"x", "w", "y", "z"};
+    index_t count = 0;
+    while(itr.has_next())
+    {
+        itr.next();
+        EXPECT_EQ(itr.path(),std::string(paths[count]));
+        // every leaf continues the previous one
+        EXPECT_EQ(itr.is_contiguous_with_previous(),count > 0);
+        count++;
+    }
+    EXPECT_EQ(count,4);
+
+    // strided leaves are not contiguous
+    Node s;
+    s["a"].set_external(DataType::float64(3,0,2*sizeof(float64)),vals);
+    s["b"].set_external(DataType::float64(1,6*sizeof(float64)),vals);
+    NodeConstLeafIterator s_itr(s,NodeConstLeafIterator::ADDRESS_ORDER);
+    s_itr.next();
+    s_itr.next();
+    EXPECT_FALSE(s_itr.is_contiguous_with_previous());
+
+    // compact nodes are contiguous in schema order
+    Node c;
+    n.compact_to(c);
+    NodeConstLeafIterator c_itr(c);
+    c_itr.next();
+    while(c_itr.has_next())
+    {
+        c_itr.next();
+        EXPECT_TRUE(c_itr.is_contiguous_with_previous());
+    }
+}
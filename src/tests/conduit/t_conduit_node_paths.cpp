@@ -155,3 +155,76 @@ TEST(conduit_node_paths, path_empty_slashes)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, node_path_basics)
+{
+    NodePath p("/fields//pressure/values");
+    EXPECT_EQ(p.path(),"/fields//pressure/values");
+    EXPECT_EQ(p.number_of_segments(),3);
+    EXPECT_EQ(p.segment(0),"fields");
+    EXPECT_EQ(p.segment(2),"values");
+    EXPECT_THROW(p.segment(3),conduit::Error);
+
+    Node n;
+    // const access to a missing path
+    const Node &n_const = n;
+    EXPECT_FALSE(n.has_path(p));
+    EXPECT_TRUE(n_const.fetch_ptr(p) == NULL);
+    EXPECT_THROW(n_const.fetch(p),conduit::Error);
+    EXPECT_THROW(n.fetch_child(p),conduit::Error);
+
+    // non-const fetch creates the path
+    n[p] = 42;
+    EXPECT_TRUE(n.has_path(p));
+    EXPECT_EQ(n["fields/pressure/values"].to_int64(),42);
+    EXPECT_EQ(&n[p],n.fetch_ptr("fields/pressure/values"));
+    EXPECT_EQ(&n_const[p],&n["fields/pressure/values"]);
+
+    // parent segments
+    n["fields/pressure/units"] = "Pa";
+    NodePath p_units("fields/pressure/values/../units");
+    EXPECT_EQ(n[p_units].as_string(),"Pa");
+
+    // reuse a path handle across different trees
+    Node n2;
+    n2["fields/pressure/values"] = 1.5;
+    EXPECT_EQ(n2[p].to_float64(),1.5);
+    EXPECT_EQ(n[p].to_int64(),42);
+
+    NodePath p_empty;
+    EXPECT_EQ(&n_const.fetch_child(p_empty),&n);
+    EXPECT_THROW(n.fetch(p_empty),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, node_path_shape_change)
+{
+    Node n;
+    n["a/x"] = 1;
+    n["b/y"] = 2;
+    n["c/z"] = 3;
+
+    NodePath p("c/z");
+    EXPECT_EQ(n[p].to_int64(),3);
+
+    // removing a child shifts the cached index of "c"
+    n.remove("a");
+    EXPECT_EQ(n[p].to_int64(),3);
+
+    // a new child now lives at the old index of "c"
+    n["d"] = 4;
+    n.rename_child("b","c_old");
+    EXPECT_EQ(n[p].to_int64(),3);
+
+    // leaf replaced with a different tree
+    n["c"].reset();
+    EXPECT_FALSE(n.has_path(p));
+    n["c/z"] = 5;
+    EXPECT_EQ(n[p].to_int64(),5);
+
+    // path through a non object node
+    n["c"] = 10;
+    EXPECT_FALSE(n.has_path(p));
+}
+
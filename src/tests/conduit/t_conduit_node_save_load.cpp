@@ -122,6 +122,124 @@ TEST(conduit_node_save_load, bin_simple_file)
     delete [] data;
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, bin_save_non_compact)
+{
+    // interleaved xyz external data, saved without compacting first
+    index_t num_pts = 1000;
+    std::vector<float64> xyz(num_pts * 3);
+    for(index_t i = 0; i < num_pts * 3; i++)
+    {
+        xyz[i] = (float64) i;
+    }
+
+    // large enough to span several staging buffer chunks
+    index_t num_big = 3 * 1024 * 1024;
+    std::vector<int32> big(num_big * 2);
+    for(index_t i = 0; i < num_big * 2; i++)
+    {
+        big[i] = (int32) i;
+    }
+
+    Node nsrc;
+    nsrc["coords/x"].set_external(&xyz[0], num_pts, 0,
+                                  3 * sizeof(float64));
+    nsrc["coords/y"].set_external(&xyz[0], num_pts, sizeof(float64),
+                                  3 * sizeof(float64));
+    nsrc["coords/z"].set_external(&xyz[0], num_pts, 2 * sizeof(float64),
+                                  3 * sizeof(float64));
+    nsrc["compact"].set(DataType::int64(10));
+    int64 *compact_ptr = nsrc["compact"].value();
+    for(index_t i = 0; i < 10; i++)
+    {
+        compact_ptr[i] = i * 10;
+    }
+    nsrc["big_odd"].set_external(DataType::int32(num_big,
+                                                 sizeof(int32),
+                                                 2 * sizeof(int32)),
+                                 &big[0]);
+    nsrc["name"] = "mesh";
+
+    EXPECT_FALSE(nsrc.is_compact());
+
+    nsrc.save("tout_conduit_node_save_load_bin_non_compact.conduit_bin");
+
+    Schema s_saved;
+    s_saved.load("tout_conduit_node_save_load_bin_non_compact.conduit_bin_json");
+    EXPECT_TRUE(s_saved.is_compact());
+    EXPECT_EQ(s_saved.total_bytes_compact(), nsrc.total_bytes_compact());
+
+    Node n;
+    n.load("tout_conduit_node_save_load_bin_non_compact.conduit_bin");
+
+    Node info;
+    EXPECT_FALSE(n.diff(nsrc,info));
+
+    float64_array y_vals = n["coords/y"].value();
+    EXPECT_EQ(y_vals[0], 1.0);
+    EXPECT_EQ(y_vals[num_pts-1], (float64)(3 * (num_pts-1) + 1));
+
+    int32_array odd_vals = n["big_odd"].value();
+    EXPECT_EQ(odd_vals[0], 1);
+    EXPECT_EQ(odd_vals[num_big-1], (int32)(2 * (num_big-1) + 1));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, bin_schema_formats)
+{
+    Node n;
+    n["a"] = (int64) 10;
+    n["b/vals"].set(DataType::float64(4));
+    n["b/name"] = "field";
+
+    std::string tout_base = "tout_conduit_node_save_load_bin_schema_formats";
+    std::string tout_file = tout_base + ".conduit_bin";
+
+    // json is the default, in the classic <base>_json file
+    n.save(tout_file);
+    EXPECT_TRUE(utils::is_file(tout_file + "_json"));
+    EXPECT_FALSE(utils::is_file(tout_file + "_schema_bin"));
+    Node n_load;
+    n_load.load(tout_file);
+    Node info;
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    // binary schemas are opt in, and use their own file name
+    Node opts;
+    opts["schema_format"] = "binary";
+    n.save(tout_file,"conduit_bin",opts);
+    EXPECT_TRUE(utils::is_file(tout_file + "_schema_bin"));
+    EXPECT_FALSE(utils::is_file(tout_file + "_json"));
+
+    n_load.reset();
+    n_load.load(tout_file);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    Node n_mmap;
+    n_mmap.mmap(tout_file);
+    EXPECT_FALSE(n.diff(n_mmap,info));
+
+    // Schema::load() opens exactly the file it is given
+    EXPECT_EQ(Node::conduit_bin_schema_path(tout_file),
+              tout_file + "_schema_bin");
+    Schema s;
+    EXPECT_THROW(s.load(tout_file + "_json"),conduit::Error);
+    s.load(Node::conduit_bin_schema_path(tout_file));
+    EXPECT_EQ(s["b/vals"].dtype().number_of_elements(),4);
+
+    // saving json again replaces the binary schema
+    n.save(tout_file,"conduit_bin");
+    EXPECT_TRUE(utils::is_file(tout_file + "_json"));
+    EXPECT_FALSE(utils::is_file(tout_file + "_schema_bin"));
+    EXPECT_EQ(Node::conduit_bin_schema_path(tout_file),
+              tout_file + "_json");
+    s.load(Node::conduit_bin_schema_path(tout_file));
+    EXPECT_EQ(s["b/vals"].dtype().number_of_elements(),4);
+
+    opts["schema_format"] = "bogus";
+    EXPECT_THROW(n.save(tout_file,"conduit_bin",opts),conduit::Error);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_node_save_load, other_protocols)
 {
@@ -0,0 +1,302 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_threads.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+// read-only access to one shared tree from many OpenMP threads
+
+static const index_t num_domains = 64;
+static const index_t num_values  = 4096;
+// use a fixed number of threads, so we run concurrently on any machine
+static const int     num_threads = 8;
+
+//-----------------------------------------------------------------------------
+void
+build_tree(Node &n)
+{
+    for(index_t d = 0; d < num_domains; d++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << d;
+        Node &dom = n[oss.str()];
+        dom["state/cycle"] = (int64) d;
+        dom["state/name"]  = oss.str();
+
+        dom["fields/pressure/values"].set(DataType::float64(num_values));
+        dom["fields/ids/values"].set(DataType::int32(num_values));
+        float64 *p_vals = dom["fields/pressure/values"].value();
+        int32   *i_vals = dom["fields/ids/values"].value();
+        for(index_t i = 0; i < num_values; i++)
+        {
+            p_vals[i] = (float64)(d * num_values + i);
+            i_vals[i] = (int32)i;
+        }
+
+        Node &lst = dom["list"];
+        for(index_t i = 0; i < 8; i++)
+        {
+            lst.append() = (int64) (d + i);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// checks one domain through a view, returns the number of errors
+index_t
+check_domain(const NodeConstView &root, index_t d)
+{
+    index_t errors = 0;
+
+    std::ostringstream oss;
+    oss << "domain_" << d;
+    NodeConstView dom = root[oss.str()];
+
+    if(dom["state/cycle"].node().to_int64() != d)
+    {
+        errors++;
+    }
+
+    if(dom.fetch("state/name").node().as_string() != oss.str())
+    {
+        errors++;
+    }
+
+    // conversions into thread local nodes
+    Node res;
+    dom["fields/ids/values"].node().to_float64_array(res);
+    float64_array ids = res.value();
+    for(index_t i = 0; i < num_values; i += 97)
+    {
+        if(ids[i] != (float64)i)
+        {
+            errors++;
+        }
+    }
+
+    dom["fields/pressure/values"].node().to_int64_array(res);
+    int64_array p_vals = res.value();
+    if(p_vals[num_values - 1] != d * num_values + num_values - 1)
+    {
+        errors++;
+    }
+
+    // child iteration
+    index_t list_sum = 0;
+    NodeConstIterator itr = dom["list"].children();
+    while(itr.has_next())
+    {
+        list_sum += itr.next().to_int64();
+    }
+    if(list_sum != 8 * d + 28)
+    {
+        errors++;
+    }
+
+    // leaf iteration
+    NodeConstLeafIterator leaves = dom.leaves();
+    if(leaves.number_of_leaves() != 4 + 8)
+    {
+        errors++;
+    }
+    while(leaves.has_next())
+    {
+        leaves.next();
+        if(leaves.data_ptr() == NULL)
+        {
+            errors++;
+        }
+    }
+
+    // sizes, schema, and string output
+    if(dom.total_bytes_compact() != dom.node().total_bytes_compact() ||
+       dom["state"].node().to_json().empty() ||
+       !dom.has_path("fields/pressure/values") ||
+       dom.has_path("fields/missing"))
+    {
+        errors++;
+    }
+
+    // missing paths throw and are not created
+    try
+    {
+        dom.fetch("fields/missing");
+        errors++;
+    }
+    catch(conduit::Error &)
+    {}
+
+    return errors;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_threads, concurrent_reads)
+{
+    Node n;
+    build_tree(n);
+    uint64 hash_before = n.hash();
+    index_t nchildren_before = n.number_of_children();
+
+    NodeConstView root(n);
+
+    index_t num_iters = 64 * num_domains;
+    index_t errors = 0;
+    #pragma omp parallel for num_threads(num_threads) reduction(+:errors) \
+                             schedule(dynamic,4)
+    for(index_t i = 0; i < num_iters; i++)
+    {
+        // scatter accesses so threads hit the same domains at once
+        index_t d = (i * 7) % num_domains;
+        errors += check_domain(root,d);
+    }
+
+    EXPECT_EQ(errors,0);
+    EXPECT_EQ(n.hash(),hash_before);
+    EXPECT_EQ(n.number_of_children(),nchildren_before);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_threads, concurrent_const_node_reads)
+{
+    Node n;
+    build_tree(n);
+    // a view fills the cached sizes, after that const Node methods
+    // can be used directly
+    NodeConstView root(n);
+    const Node &cn = n;
+
+    std::vector<index_t> sizes;
+    std::vector<uint64>  hashes;
+    for(index_t d = 0; d < num_domains; d++)
+    {
+        sizes.push_back(cn.child(d).total_bytes_compact());
+        hashes.push_back(cn.child(d).schema().hash());
+    }
+
+    index_t errors = 0;
+    #pragma omp parallel for num_threads(num_threads) reduction(+:errors)
+    for(index_t i = 0; i < 4 * num_domains; i++)
+    {
+        index_t d = i % num_domains;
+        std::ostringstream oss;
+        oss << "domain_" << d << "/fields/pressure/values";
+        const Node &vals = cn[oss.str()];
+        if(vals.dtype().number_of_elements() != num_values ||
+           vals.as_float64_ptr()[1] != (float64)(d * num_values + 1))
+        {
+            errors++;
+        }
+
+        Node info;
+        if(cn.child(d).diff(cn.child(d),info) ||
+           cn.child(d).diff(cn.child(d)))
+        {
+            errors++;
+        }
+
+        if(cn.child(d).schema().hash() != hashes[(size_t)d] ||
+           cn.child(d).schema().total_bytes_compact() != sizes[(size_t)d] ||
+           cn.child(d).schema().is_compact() != true)
+        {
+            errors++;
+        }
+    }
+
+    EXPECT_EQ(errors,0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_threads, concurrent_const_reads_without_view)
+{
+    Node n;
+    build_tree(n);
+
+    // expected values come from a copy, so the cached sizes of the 
+    // shared tree are still empty when the threads start
+    Node n_copy(n);
+    index_t expected_bytes = n_copy.total_bytes_compact();
+    std::string expected_json = n_copy["domain_0/state"].to_json();
+
+    const Node &cn = n;
+
+    index_t errors = 0;
+    #pragma omp parallel for num_threads(num_threads) reduction(+:errors)
+    for(index_t i = 0; i < 4 * num_domains; i++)
+    {
+        index_t d = i % num_domains;
+        // every thread fills (or reads) the shared tree's size caches
+        if(cn.total_bytes_compact() != expected_bytes ||
+           cn.is_compact() != n_copy.is_compact() ||
+           cn.child(d).schema().total_strided_bytes() == 0)
+        {
+            errors++;
+        }
+
+        Node n_compact;
+        cn.child(d).compact_to(n_compact);
+        if(n_compact.total_bytes_compact() != 
+           cn.child(d).total_bytes_compact())
+        {
+            errors++;
+        }
+
+        if(cn["domain_0/state"].to_json() != expected_json)
+        {
+            errors++;
+        }
+    }
+
+    EXPECT_EQ(errors,0);
+}
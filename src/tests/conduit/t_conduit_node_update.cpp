@@ -280,3 +280,91 @@ TEST(conduit_node_update, update_external)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_update, update_bulk_copy)
+{
+    Schema s;
+    s["a"].set(DataType::float64(100));
+    s["b/c"].set(DataType::int32(10));
+    s["b/d"].set(DataType::uint8(7));
+
+    Node n_src(s);
+    float64_array a_vals = n_src["a"].value();
+    for(index_t i=0; i < 100; i++)
+    {
+        a_vals[i] = 0.5 * i;
+    }
+    int32_array c_vals = n_src["b/c"].value();
+    uint8_array d_vals = n_src["b/d"].value();
+    for(index_t i=0; i < 10; i++)
+    {
+        c_vals[i] = -4;
+    }
+    for(index_t i=0; i < 7; i++)
+    {
+        d_vals[i] = 8;
+    }
+
+    // same compact and contiguous schema
+    Node n_dest(s);
+    void *dest_data_ptr = n_dest.contiguous_data_ptr();
+    n_dest.update(n_src);
+    EXPECT_EQ(n_dest.contiguous_data_ptr(),dest_data_ptr);
+    Node info;
+    EXPECT_FALSE(n_dest.diff(n_src,info));
+
+    d_vals[6] = 9;
+    n_dest.update_compatible(n_src);
+    EXPECT_EQ(n_dest["b/d"].as_uint8_array()[6],9);
+    EXPECT_EQ(n_dest.contiguous_data_ptr(),dest_data_ptr);
+
+    // update from self is a no-op
+    n_dest.update(n_dest);
+    EXPECT_FALSE(n_dest.diff(n_src,info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_update, update_strided_leaves)
+{
+    float64 xyz[] = {1.0, 2.0, 3.0,
+                     4.0, 5.0, 6.0,
+                     7.0, 8.0, 9.0};
+
+    // strided src, compact dest
+    Node n_src;
+    n_src["y"].set_external(xyz,3,sizeof(float64),3*sizeof(float64));
+
+    Node n_dest;
+    n_dest["y"].set(DataType::float64(3));
+    n_dest.update(n_src);
+    float64_array y = n_dest["y"].value();
+    EXPECT_EQ(y[0],2.0);
+    EXPECT_EQ(y[1],5.0);
+    EXPECT_EQ(y[2],8.0);
+
+    // compact src, strided dest keeps the striding holes
+    float64 res[] = {0.0, 0.0, 0.0,
+                     0.0, 0.0, 0.0,
+                     0.0, 0.0, 0.0};
+    Node n_res;
+    n_res["y"].set_external(res,3,sizeof(float64),3*sizeof(float64));
+    n_res.update_compatible(n_dest);
+    EXPECT_EQ(res[1],2.0);
+    EXPECT_EQ(res[4],5.0);
+    EXPECT_EQ(res[7],8.0);
+    EXPECT_EQ(res[0],0.0);
+    EXPECT_EQ(res[2],0.0);
+    EXPECT_EQ(res[8],0.0);
+
+    // equal strided schemas can't use a bulk copy (would overwrite holes)
+    float64 res2[] = {-1.0, -1.0, -1.0,
+                      -1.0, -1.0, -1.0,
+                      -1.0, -1.0, -1.0};
+    Node n_res2;
+    n_res2["y"].set_external(res2,3,sizeof(float64),3*sizeof(float64));
+    n_res2.update(n_res);
+    EXPECT_EQ(res2[4],5.0);
+    EXPECT_EQ(res2[3],-1.0);
+    EXPECT_EQ(res2[5],-1.0);
+}
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_view.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_view, basics)
+{
+    Node n;
+    n["a/b"] = 10;
+    n["a/c"].set(DataType::float64(4));
+    n["l"].append() = "text";
+    n["l"].append() = 1.5;
+
+    NodeConstView v(n);
+    EXPECT_FALSE(v.is_empty_view());
+    EXPECT_EQ(&v.node(),&n);
+    EXPECT_EQ(v.number_of_children(),2);
+    EXPECT_TRUE(v.has_child("a"));
+    EXPECT_TRUE(v.has_path("a/b"));
+    EXPECT_FALSE(v.has_path("a/d"));
+
+    EXPECT_EQ(v["a/b"].node().to_int64(),10);
+    EXPECT_EQ(v.fetch("a").child("c").dtype().number_of_elements(),4);
+    EXPECT_EQ(v["l"][1].node().to_float64(),1.5);
+    EXPECT_EQ(v["a"]["b"].path(),"a/b");
+    EXPECT_EQ(v["a/c"].data_ptr(),n["a/c"].element_ptr(0));
+    EXPECT_EQ(v.fetch(NodePath("a/b")).node().to_int64(),10);
+    EXPECT_EQ(v.total_bytes_compact(),n.total_bytes_compact());
+
+    NodeConstIterator itr = v["a"].children();
+    EXPECT_EQ(itr.next().to_int64(),10);
+
+    NodeConstLeafIterator leaves = v.leaves();
+    EXPECT_EQ(leaves.number_of_leaves(),4);
+
+    // missing paths throw and are not created
+    EXPECT_THROW(v.fetch("a/d"),conduit::Error);
+    EXPECT_THROW(v["a"].child("d"),conduit::Error);
+    EXPECT_THROW(v.child(10),conduit::Error);
+    EXPECT_FALSE(n.has_path("a/d"));
+    EXPECT_EQ(n["a"].number_of_children(),2);
+
+    NodeConstView empty;
+    EXPECT_TRUE(empty.is_empty_view());
+    EXPECT_THROW(empty.node(),conduit::Error);
+
+    NodeConstView v_copy;
+    v_copy = v["a"];
+    EXPECT_EQ(v_copy.name(),"a");
+}
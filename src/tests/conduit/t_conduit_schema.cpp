@@ -51,6 +51,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
 #include "gtest/gtest.h"
 
 
@@ -333,6 +334,333 @@ TEST(schema_basics, rename_child)
     EXPECT_EQ(cnames[2],"d");
 }
 
+//-----------------------------------------------------------------------------
+TEST(schema_basics, many_children_lookup_and_remove)
+{
+    Schema s;
+    index_t num_children = 2000;
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        s[oss.str()].set(DataType::int64());
+    }
+
+    EXPECT_EQ(s.number_of_children(),num_children);
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        EXPECT_TRUE(s.has_child(oss.str()));
+        EXPECT_EQ(s.child_index(oss.str()),i);
+    }
+
+    EXPECT_FALSE(s.has_child("child_"));
+    EXPECT_FALSE(s.has_path("child_2000"));
+
+    // remove every other child, indices above each removal shift down
+    for(index_t i=0; i < num_children; i+=2)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        s.remove(oss.str());
+    }
+
+    EXPECT_EQ(s.number_of_children(),num_children / 2);
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        if(i % 2 == 0)
+        {
+            EXPECT_FALSE(s.has_child(oss.str()));
+        }
+        else
+        {
+            EXPECT_EQ(s.child_index(oss.str()),i / 2);
+            EXPECT_EQ(s.child_name(i / 2),oss.str());
+        }
+    }
+
+    // rename keeps the index
+    s.rename_child("child_1","first");
+    EXPECT_EQ(s.child_index("first"),0);
+    EXPECT_FALSE(s.has_child("child_1"));
+
+    // copies carry the index
+    Schema s2(s);
+    EXPECT_TRUE(s2.equals(s));
+    EXPECT_EQ(s2.child_index("child_1999"),num_children / 2 - 1);
+
+    s2.remove(0);
+    EXPECT_FALSE(s2.has_child("first"));
+    EXPECT_EQ(s2.child_index("child_3"),0);
+    EXPECT_FALSE(s2.equals(s));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, many_children_remove_and_insert)
+{
+    // enough removes to fold the index's tombstones in several times,
+    // interleaved with inserts and renames
+    index_t num_children = 2000;
+    Schema s;
+    std::vector<std::string> ref_names;
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        s[oss.str()].set(DataType::int64());
+        ref_names.push_back(oss.str());
+    }
+
+    for(index_t i=0; i < num_children / 2; i++)
+    {
+        // remove from the middle, alternating removes by name and by index
+        size_t ridx = ref_names.size() / 2;
+        if(i % 2 == 0)
+        {
+            s.remove(ref_names[ridx]);
+        }
+        else
+        {
+            s.remove((index_t)ridx);
+        }
+        ref_names.erase(ref_names.begin() + ridx);
+
+        if(i % 7 == 0)
+        {
+            std::ostringstream oss;
+            oss << "extra_" << i;
+            s[oss.str()].set(DataType::float64());
+            ref_names.push_back(oss.str());
+        }
+
+        if(i % 11 == 0)
+        {
+            std::ostringstream oss;
+            oss << "renamed_" << i;
+            s.rename_child(ref_names[0],oss.str());
+            ref_names[0] = oss.str();
+        }
+    }
+
+    EXPECT_EQ(s.number_of_children(),(index_t)ref_names.size());
+    for(size_t i=0; i < ref_names.size(); i++)
+    {
+        EXPECT_EQ(s.child_index(ref_names[i]),(index_t)i);
+        EXPECT_EQ(s.child_name((index_t)i),ref_names[i]);
+    }
+    EXPECT_FALSE(s.has_child("child_1000"));
+
+    // copies carry the index
+    Schema s2(s);
+    for(size_t i=0; i < ref_names.size(); i++)
+    {
+        EXPECT_EQ(s2.child_index(ref_names[i]),(index_t)i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, binary_round_trip)
+{
+    Schema s;
+    s["coords/x"].set(DataType::float64(10));
+    s["coords/y"].set(DataType::float64(10,8,24));
+    s["fields/pressure/values"].set(DataType::float32(5));
+    s["fields/pressure/name"].set(DataType::char8_str(9));
+    s["fields/energy/values"].set(DataType::int64(3,0,8,8,
+                                                  Endianness::BIG_ID));
+    s["fields/energy/name"].set(DataType::char8_str(7));
+    s["empty"].set(DataType::empty());
+    Schema &lst = s["list"];
+    lst.append().set(DataType::int8());
+    lst.append()["values"].set(DataType::uint16(4));
+
+    std::vector<uint8> bin;
+    s.to_binary(bin);
+    EXPECT_TRUE(Schema::is_binary(&bin[0],(index_t)bin.size()));
+
+    // repeated names are stored once, so the binary form is smaller
+    std::string json = s.to_json();
+    EXPECT_LT(bin.size(),json.size());
+
+    Schema s_bin;
+    s_bin.from_binary(bin);
+    EXPECT_TRUE(s.equals(s_bin));
+    EXPECT_EQ(s.to_json(),s_bin.to_json());
+    EXPECT_EQ(s_bin["coords/y"].dtype().stride(),24);
+    EXPECT_EQ(s_bin["fields/energy/values"].dtype().endianness(),
+              (index_t)Endianness::BIG_ID);
+    EXPECT_TRUE(s_bin.fetch_child("list").dtype().is_list());
+    EXPECT_EQ(s_bin.child_index("list"),s.child_index("list"));
+
+    // the result can still be modified
+    s_bin["coords/z"].set(DataType::float64(10));
+    EXPECT_TRUE(s_bin["coords"].has_child("z"));
+
+    // schema files can be json or binary
+    s["coords"].save("tout_schema_binary_round_trip.json");
+    Schema s_json_file;
+    s_json_file.load("tout_schema_binary_round_trip.json");
+    EXPECT_EQ(s["coords"].to_json(),s_json_file.to_json());
+
+    std::ofstream ofs("tout_schema_binary_round_trip.bin",
+                      std::ios::out | std::ios::binary);
+    ofs.write((const char*)&bin[0],(std::streamsize)bin.size());
+    ofs.close();
+    Schema s_bin_file;
+    s_bin_file.load("tout_schema_binary_round_trip.bin");
+    EXPECT_TRUE(s.equals(s_bin_file));
+
+    // leaf and empty schemas
+    Schema s_leaf(DataType::uint32(7));
+    s_leaf.to_binary(bin);
+    Schema s_leaf_res;
+    s_leaf_res.from_binary(bin);
+    EXPECT_TRUE(s_leaf.equals(s_leaf_res));
+
+    Schema s_empty;
+    s_empty.to_binary(bin);
+    s_leaf_res.from_binary(bin);
+    EXPECT_TRUE(s_leaf_res.dtype().is_empty());
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, binary_errors)
+{
+    Schema s;
+    s["a/b"].set(DataType::float64(10));
+    s["a/c"].set(DataType::int32(2));
+
+    std::vector<uint8> bin;
+    s.to_binary(bin);
+
+    Schema s_res;
+    // not a binary schema
+    std::string json = s.to_json();
+    EXPECT_FALSE(Schema::is_binary(json.c_str(),(index_t)json.size()));
+    EXPECT_THROW(s_res.from_binary(json.c_str(),(index_t)json.size()),
+                 conduit::Error);
+
+    // truncated data
+    for(index_t len = 8; len < (index_t)bin.size(); len+= 5)
+    {
+        EXPECT_THROW(s_res.from_binary(&bin[0],len),conduit::Error);
+    }
+
+    // unknown version
+    std::vector<uint8> bin_bad = bin;
+    bin_bad[4] = 200;
+    EXPECT_THROW(s_res.from_binary(bin_bad),conduit::Error);
+
+    // bad dtype id (first tree entry follows the name table)
+    index_t tree_offset = 8 + 8 + (8 + 1) + (8 + 1) + (8 + 1);
+    bin_bad = bin;
+    int64 bad_id = 100;
+    memcpy(&bin_bad[tree_offset],&bad_id,8);
+    EXPECT_THROW(s_res.from_binary(bin_bad),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, shared_child_names)
+{
+    Schema s;
+    s["a"].set(DataType::int64());
+    s["b"].set(DataType::float64());
+    s["c/d"].set(DataType::int32());
+
+    Schema s_copy(s);
+    EXPECT_EQ(&s_copy.child_names(),&s.child_names());
+    EXPECT_EQ(&s_copy["c"].child_names(),&s["c"].child_names());
+    EXPECT_TRUE(s_copy.equals(s));
+
+    Schema s_compact;
+    s.compact_to(s_compact);
+    EXPECT_EQ(&s_compact.child_names(),&s.child_names());
+    EXPECT_EQ(s_compact.child_index("b"),1);
+
+    // lookups do not copy the names
+    EXPECT_TRUE(s_copy.has_child("a"));
+    EXPECT_EQ(s_copy.fetch("b").dtype().id(),DataType::FLOAT64_ID);
+    EXPECT_EQ(&s_copy.child_names(),&s.child_names());
+
+    // changes do
+    s_copy["e"].set(DataType::int8());
+    EXPECT_NE(&s_copy.child_names(),&s.child_names());
+    EXPECT_EQ(s.number_of_children(),3);
+    EXPECT_EQ(s_copy.number_of_children(),4);
+    EXPECT_FALSE(s.has_child("e"));
+    EXPECT_EQ(s_copy.child_index("e"),3);
+
+    // the original still works after its copies go away
+    s_compact.reset();
+    s.remove("a");
+    EXPECT_EQ(s.child_index("b"),0);
+    EXPECT_EQ(s.child_index("c"),1);
+    EXPECT_EQ(s_copy.child_index("a"),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, cached_sizes)
+{
+    Schema s;
+    s["a/b"].set(DataType::int64(10));
+    s["a/c"].set(DataType::float32(4,0,8));
+    EXPECT_EQ(s.total_bytes_compact(),10 * 8 + 4 * 4);
+    EXPECT_EQ(s.total_strided_bytes(),10 * 8 + 3 * 8 + 4);
+    EXPECT_FALSE(s.is_compact());
+
+    // changes below the root update the root's sizes
+    s["a/d"].set(DataType::int8(3));
+    EXPECT_EQ(s.total_bytes_compact(),10 * 8 + 4 * 4 + 3);
+    EXPECT_EQ(s["a"].total_bytes_compact(),10 * 8 + 4 * 4 + 3);
+
+    s["a"].remove("b");
+    EXPECT_EQ(s.total_bytes_compact(),4 * 4 + 3);
+
+    s["l"].append().set(DataType::int32(2));
+    s["l"].append().set(DataType::int32(5));
+    EXPECT_EQ(s.total_bytes_compact(),4 * 4 + 3 + 7 * 4);
+    s["l"].remove((index_t)0);
+    EXPECT_EQ(s.total_bytes_compact(),4 * 4 + 3 + 5 * 4);
+
+    // non-const dtype access
+    s["a/c"].dtype().set_number_of_elements(2);
+    EXPECT_EQ(s.total_bytes_compact(),2 * 4 + 3 + 5 * 4);
+
+    // swapping subtrees
+    Schema o;
+    o.set(DataType::float64(100));
+    s["l"].swap(o);
+    EXPECT_EQ(s.total_bytes_compact(),2 * 4 + 3 + 100 * 8);
+    EXPECT_EQ(o.total_bytes_compact(),5 * 4);
+
+    // copies and compact forms
+    Schema s_copy(s);
+    EXPECT_EQ(s_copy.total_bytes_compact(),s.total_bytes_compact());
+    s_copy["a/c"].set(DataType::float64(1));
+    EXPECT_EQ(s_copy.total_bytes_compact(),8 + 3 + 100 * 8);
+    EXPECT_EQ(s.total_bytes_compact(),2 * 4 + 3 + 100 * 8);
+
+    Schema s_compact;
+    s.compact_to(s_compact);
+    EXPECT_TRUE(s_compact.is_compact());
+    EXPECT_EQ(s_compact.total_strided_bytes(),s.total_bytes_compact());
+
+    // a node allocates the spanned bytes of its schema
+    Node n(s_compact);
+    EXPECT_EQ(n.allocated_bytes(),s.total_bytes_compact());
+    s_compact["a/c"].set(DataType::float32(2,0,4));
+    s_compact["a/e"].set(DataType::int8(1,1000));
+    Node n2(s_compact);
+    EXPECT_EQ(n2.allocated_bytes(),1001);
+}
+
 
 
 
@@ -52,6 +52,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <limits>
 #include "gtest/gtest.h"
 using namespace conduit;
 
@@ -84,3 +85,85 @@ TEST(conduit_to_string, simple_1)
     delete [] data;
 }
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_to_string, numeric_array_formats)
+{
+    Node n;
+    int32 i_vals[4] = {-2147483647 - 1, -1, 0, 2147483647};
+    n["i"].set(i_vals,4);
+    uint64 u_vals[2] = {0, 18446744073709551615ULL};
+    n["u"].set(u_vals,2);
+    float32 f_vals[3] = {0.1f, -2.5f, 1e-8f};
+    n["f"].set(f_vals,3);
+    float64 d_vals[5] = {0.1, 1.0/3.0, -0.0, 1e300, 5e-324};
+    n["d"].set(d_vals,5);
+    n["s"] = 42.0;
+
+    EXPECT_EQ(n["i"].to_json(),"[-2147483648, -1, 0, 2147483647]");
+    EXPECT_EQ(n["u"].to_json(),"[0, 18446744073709551615]");
+    // float32 values use their own shortest form, not the float64 one
+    EXPECT_EQ(n["f"].to_json(),"[0.1, -2.5, 1e-8]");
+    EXPECT_EQ(n["d"].to_json(),
+              "[0.1, 0.3333333333333333, -0.0, 1e300, 5e-324]");
+    EXPECT_EQ(n["s"].to_json(),"42.0");
+
+    // round trip through both json and yaml
+    Node n_json, n_yaml;
+    n_json.parse(n.to_json(),"json");
+    n_yaml.parse(n.to_yaml(),"yaml");
+
+    float64_array d_json = n_json["d"].value();
+    float64_array d_yaml = n_yaml["d"].value();
+    for(index_t i=0; i < 5; i++)
+    {
+        EXPECT_EQ(d_vals[i],d_json[i]);
+        EXPECT_EQ(d_vals[i],d_yaml[i]);
+    }
+
+    float64_array f_json = n_json["f"].value();
+    for(index_t i=0; i < 3; i++)
+    {
+        EXPECT_EQ(f_vals[i],(float32)f_json[i]);
+    }
+
+    // inf and nan are quoted
+    float64 nf_vals[3] = {std::numeric_limits<float64>::infinity(),
+                          -std::numeric_limits<float64>::infinity(),
+                          std::numeric_limits<float64>::quiet_NaN()};
+    n["nf"].set(nf_vals,3);
+    EXPECT_EQ(n["nf"].to_json(),"[\"inf\", \"-inf\", \"nan\"]");
+
+    // strided array
+    int64 vals[6] = {0, 1, 2, 3, 4, 5};
+    n["strided"].set_external(DataType::int64(3,0,2*sizeof(int64)),vals);
+    EXPECT_EQ(n["strided"].to_json(),"[0, 2, 4]");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_to_string, numeric_array_large)
+{
+    // larger than the emit chunk size, to exercise the flush path
+    index_t nvals = 100000;
+    Node n;
+    n.set(DataType::float64(nvals));
+    float64_array vals = n.value();
+    for(index_t i=0; i < nvals; i++)
+    {
+        vals[i] = (i * 1.0001) / 7.0;
+    }
+
+    // check each value round trips exactly
+    std::string json = n.to_json();
+    EXPECT_EQ(json[0],'[');
+    const char *ptr = json.c_str() + 1;
+    for(index_t i=0; i < nvals; i++)
+    {
+        char *end = NULL;
+        float64 v = strtod(ptr,&end);
+        EXPECT_EQ(vals[i],v);
+        ptr = end + 2;
+    }
+    EXPECT_EQ(std::string(ptr - 2),"]");
+}
+
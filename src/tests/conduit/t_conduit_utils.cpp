@@ -53,6 +53,8 @@
 
 #include <iostream>
 #include <limits>
+#include <vector>
+#include <algorithm>
 #include "gtest/gtest.h"
 
 #include "t_config.hpp"
@@ -239,6 +241,62 @@ TEST(conduit_utils, float64_to_string)
     EXPECT_EQ("nan",utils::float64_to_string(v));
 }
 
+//-----------------------------------------------------------------------------
+std::string
+chars_to_string(const char *buffer, const char *end)
+{
+    return std::string(buffer,end);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, number_to_chars)
+{
+    char buff[64];
+
+    EXPECT_EQ("-9223372036854775808",
+              chars_to_string(buff,utils::int64_to_chars(
+                                std::numeric_limits<int64>::min(),buff)));
+    EXPECT_EQ("18446744073709551615",
+              chars_to_string(buff,utils::uint64_to_chars(
+                                std::numeric_limits<uint64>::max(),buff)));
+
+    EXPECT_EQ("10.0",chars_to_string(buff,utils::float64_to_chars(10.0,buff)));
+    EXPECT_EQ("0.1",chars_to_string(buff,utils::float64_to_chars(0.1,buff)));
+    EXPECT_EQ("-0.0",chars_to_string(buff,utils::float64_to_chars(-0.0,buff)));
+    EXPECT_EQ("1e300",chars_to_string(buff,utils::float64_to_chars(1e300,buff)));
+    EXPECT_EQ("0.1",chars_to_string(buff,utils::float32_to_chars(0.1f,buff)));
+    EXPECT_EQ("3.4028235e38",
+              chars_to_string(buff,utils::float32_to_chars(
+                                std::numeric_limits<float32>::max(),buff)));
+
+    float64 inf = std::numeric_limits<float64>::infinity();
+    EXPECT_EQ("inf",chars_to_string(buff,utils::float64_to_chars(inf,buff)));
+    EXPECT_EQ("-inf",chars_to_string(buff,utils::float64_to_chars(-inf,buff)));
+    EXPECT_EQ("nan",chars_to_string(buff,utils::float32_to_chars(
+                            std::numeric_limits<float32>::quiet_NaN(),buff)));
+
+    // shortest forms must round trip
+    float64 f64_vals[6] = {1.0/3.0, 2.0/3.0, 1e-310, 123456.789e-20,
+                           std::numeric_limits<float64>::max(),
+                           std::numeric_limits<float64>::min()};
+    for(int i=0; i < 6; i++)
+    {
+        char *end = utils::float64_to_chars(f64_vals[i],buff);
+        *end = 0;
+        EXPECT_EQ(f64_vals[i],strtod(buff,NULL));
+    }
+
+    float32 f32_vals[6] = {1.0f/3.0f, 2.0f/3.0f, 1e-40f, 16777217.0f,
+                           std::numeric_limits<float32>::max(),
+                           std::numeric_limits<float32>::min()};
+    for(int i=0; i < 6; i++)
+    {
+        char *end = utils::float32_to_chars(f32_vals[i],buff);
+        *end = 0;
+        EXPECT_EQ(f32_vals[i],strtof(buff,NULL));
+    }
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -310,7 +368,7 @@ TEST(conduit_utils, base64_enc_dec)
     Node n;
     n_src.compact_to(n);
     
-    // use libb64 to encode the data
+    // encode the data
     index_t nbytes = n.schema().total_strided_bytes();
     Node bb64_data;
     index_t enc_buff_size = utils::base64_encode_buffer_size(nbytes);
@@ -325,7 +383,7 @@ TEST(conduit_utils, base64_enc_dec)
 
     index_t dec_buff_size = utils::base64_decode_buffer_size(enc_buff_size);
 
-    // use libb64 to decode the data
+    // decode the data
     
     // decode buffer
     Node bb64_decode;
@@ -346,6 +404,181 @@ TEST(conduit_utils, base64_enc_dec)
     EXPECT_EQ(n_src["c"].as_int32(), n_res["c"].as_int32());
 }
 
+//-----------------------------------------------------------------------------
+// simple reference encoder used to check the optimized codec
+//-----------------------------------------------------------------------------
+std::string
+base64_encode_reference(const std::vector<uint8> &src)
+{
+    static const char chars[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string res;
+    for(size_t i=0; i < src.size(); i+=3)
+    {
+        size_t rem = std::min((size_t)3, src.size() - i);
+        unsigned int v = src[i] << 16;
+        if(rem > 1) v |= src[i+1] << 8;
+        if(rem > 2) v |= src[i+2];
+        res += chars[(v >> 18) & 0x3F];
+        res += chars[(v >> 12) & 0x3F];
+        res += rem > 1 ? chars[(v >> 6) & 0x3F] : '=';
+        res += rem > 2 ? chars[v & 0x3F] : '=';
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// base64 kernels to test, skips the ones the cpu doesn't support
+//-----------------------------------------------------------------------------
+std::vector<std::string>
+base64_supported_kernels()
+{
+    std::string default_kernel = utils::base64_kernel();
+    std::vector<std::string> res;
+    const char *kernels[] = {"scalar", "ssse3", "avx2"};
+    for(int i=0; i < 3; i++)
+    {
+        if(utils::base64_set_kernel(kernels[i]))
+        {
+            res.push_back(kernels[i]);
+        }
+        else
+        {
+            std::cout << "skipping unsupported base64 kernel: "
+                      << kernels[i] << std::endl;
+        }
+    }
+    utils::base64_set_kernel(default_kernel);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+base64_check_sizes()
+{
+    // cover every tail case for both simd and scalar code paths
+    for(size_t nbytes = 0; nbytes < 300; nbytes++)
+    {
+        std::vector<uint8> src(nbytes);
+        for(size_t i=0; i < nbytes; i++)
+        {
+            src[i] = (uint8)((i * 131 + nbytes * 7) & 0xFF);
+        }
+
+        std::vector<char> enc(utils::base64_encode_buffer_size(nbytes));
+        utils::base64_encode(src.data(),(index_t)nbytes,enc.data());
+        std::string enc_str(enc.data());
+        EXPECT_EQ(base64_encode_reference(src),enc_str);
+
+        std::vector<uint8> dec(
+            utils::base64_decode_buffer_size(enc_str.size()),0);
+        index_t dec_nbytes = utils::base64_decode(enc_str.c_str(),
+                                                  enc_str.size(),
+                                                  dec.data(),
+                                                  dec.size());
+        EXPECT_EQ((index_t)nbytes,dec_nbytes);
+        EXPECT_TRUE(std::equal(src.begin(),src.end(),dec.begin()));
+
+        // decode skips chars outside the alphabet
+        std::string enc_ws;
+        for(size_t i=0; i < enc_str.size(); i++)
+        {
+            enc_ws += enc_str[i];
+            if(i % 61 == 60)
+                enc_ws += "\n";
+        }
+        std::vector<uint8> dec_ws(dec.size(),0);
+        dec_nbytes = utils::base64_decode(enc_ws.c_str(),
+                                          enc_ws.size(),
+                                          dec_ws.data(),
+                                          dec_ws.size());
+        EXPECT_EQ((index_t)nbytes,dec_nbytes);
+        EXPECT_TRUE(std::equal(src.begin(),src.end(),dec_ws.begin()));
+
+        // bounded decode never writes past dest_nbytes
+        if(nbytes > 1)
+        {
+            std::vector<uint8> dec_small(nbytes,0xAB);
+            dec_nbytes = utils::base64_decode(enc_str.c_str(),
+                                              enc_str.size(),
+                                              dec_small.data(),
+                                              (index_t)nbytes - 1);
+            EXPECT_EQ((index_t)nbytes - 1,dec_nbytes);
+            EXPECT_EQ(dec_small[nbytes-1],0xAB);
+            EXPECT_TRUE(std::equal(src.begin(),src.end() - 1,
+                                   dec_small.begin()));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_kernels)
+{
+    std::string default_kernel = utils::base64_kernel();
+    EXPECT_TRUE(utils::base64_set_kernel("scalar"));
+    EXPECT_EQ(utils::base64_kernel(),"scalar");
+    EXPECT_THROW(utils::base64_set_kernel("bogus"),conduit::Error);
+    EXPECT_EQ(utils::base64_kernel(),"scalar");
+    EXPECT_TRUE(utils::base64_set_kernel(default_kernel));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_sizes)
+{
+    std::string default_kernel = utils::base64_kernel();
+    std::vector<std::string> kernels = base64_supported_kernels();
+    for(size_t i=0; i < kernels.size(); i++)
+    {
+        std::cout << "base64 kernel: " << kernels[i] << std::endl;
+        EXPECT_TRUE(utils::base64_set_kernel(kernels[i]));
+        base64_check_sizes();
+    }
+    utils::base64_set_kernel(default_kernel);
+}
+
+//-----------------------------------------------------------------------------
+void
+base64_check_large()
+{
+    // large enough to be split across threads when OpenMP is enabled
+    size_t nbytes = 16 * 1024 * 1024 + 1;
+    std::vector<uint8> src(nbytes);
+    for(size_t i=0; i < nbytes; i++)
+    {
+        src[i] = (uint8)((i * 2654435761u) >> 13);
+    }
+
+    std::vector<char> enc(utils::base64_encode_buffer_size(nbytes));
+    utils::base64_encode(src.data(),(index_t)nbytes,enc.data());
+
+    std::string enc_str(enc.data());
+    EXPECT_TRUE(base64_encode_reference(src) == enc_str);
+
+    std::vector<uint8> dec(utils::base64_decode_buffer_size(enc_str.size()));
+    utils::base64_decode(enc_str.c_str(),enc_str.size(),dec.data());
+    EXPECT_TRUE(std::equal(src.begin(),src.end(),dec.begin()));
+
+    // a char outside the alphabet in the middle is skipped
+    enc_str.insert(enc_str.size() / 2 + 1,"\n");
+    std::fill(dec.begin(),dec.end(),0);
+    utils::base64_decode(enc_str.c_str(),enc_str.size(),dec.data());
+    EXPECT_TRUE(std::equal(src.begin(),src.end(),dec.begin()));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_large)
+{
+    std::string default_kernel = utils::base64_kernel();
+    std::vector<std::string> kernels = base64_supported_kernels();
+    for(size_t i=0; i < kernels.size(); i++)
+    {
+        std::cout << "base64 kernel: " << kernels[i] << std::endl;
+        EXPECT_TRUE(utils::base64_set_kernel(kernels[i]));
+        base64_check_large();
+    }
+    utils::base64_set_kernel(default_kernel);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_utils, dir_create_and_remove_tests)
 {
@@ -588,3 +821,124 @@ TEST(conduit_utils, split_tests)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, strided_copy)
+{
+    // cover the specialized element sizes, a generic size, and 
+    // the contiguous case
+    index_t ele_sizes[] = {1, 2, 3, 4, 8};
+    index_t num_ele = 1000;
+
+    for(int s = 0; s < 5; s++)
+    {
+        index_t ele_bytes  = ele_sizes[s];
+        index_t src_stride = ele_bytes * 3;
+
+        std::vector<uint8> src((size_t)(num_ele * src_stride));
+        for(size_t i=0; i < src.size(); i++)
+        {
+            src[i] = (uint8)(i % 251);
+        }
+
+        // strided to compact
+        std::vector<uint8> dest((size_t)(num_ele * ele_bytes),0);
+        utils::strided_copy(&dest[0],ele_bytes,
+                            &src[0],src_stride,
+                            num_ele,ele_bytes);
+
+        for(index_t i=0; i < num_ele; i++)
+        {
+            for(index_t b=0; b < ele_bytes; b++)
+            {
+                EXPECT_EQ(dest[i*ele_bytes + b],src[i*src_stride + b]);
+            }
+        }
+
+        // compact to strided
+        std::vector<uint8> dest_strided(src.size(),0);
+        utils::strided_copy(&dest_strided[0],src_stride,
+                            &dest[0],ele_bytes,
+                            num_ele,ele_bytes);
+
+        for(index_t i=0; i < num_ele; i++)
+        {
+            for(index_t b=0; b < ele_bytes; b++)
+            {
+                EXPECT_EQ(dest_strided[i*src_stride + b],
+                          src[i*src_stride + b]);
+            }
+            // bytes between elements are untouched
+            EXPECT_EQ(dest_strided[i*src_stride + ele_bytes],0);
+        }
+
+        // contiguous
+        std::vector<uint8> dest_copy(dest.size(),0);
+        utils::strided_copy(&dest_copy[0],ele_bytes,
+                            &dest[0],ele_bytes,
+                            num_ele,ele_bytes);
+        EXPECT_TRUE(dest_copy == dest);
+    }
+
+    // nothing to copy
+    utils::strided_copy(NULL,8,NULL,8,0,8);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, strided_copy_large)
+{
+    // large enough to be split across threads when OpenMP is enabled
+    index_t num_ele = 2 * 1024 * 1024;
+    std::vector<float64> xyz((size_t)(num_ele * 3));
+    for(index_t i=0; i < num_ele; i++)
+    {
+        xyz[i*3]   = (float64)i;
+        xyz[i*3+1] = -(float64)i;
+        xyz[i*3+2] = 0.5 * i;
+    }
+
+    std::vector<float64> y((size_t)num_ele,0.0);
+    utils::strided_copy(&y[0],sizeof(float64),
+                        &xyz[1],3 * sizeof(float64),
+                        num_ele,sizeof(float64));
+
+    for(index_t i=0; i < num_ele; i++)
+    {
+        EXPECT_EQ(y[i],-(float64)i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, hash64)
+{
+    // reference xxhash64 values
+    EXPECT_EQ(utils::hash64("",0),0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(utils::hash64("a",1),0xD24EC4F1A98C6E5BULL);
+    EXPECT_EQ(utils::hash64("abc",3),0x44BC2CF5AD770999ULL);
+    EXPECT_NE(utils::hash64("abc",3,1),utils::hash64("abc",3));
+
+    // strided and compact data hash the same
+    // (sizes cover the tail cases and multiple staging chunks)
+    index_t sizes[] = {0, 1, 3, 4, 7, 33, 100, 10000};
+    for(size_t s=0; s < sizeof(sizes)/sizeof(index_t); s++)
+    {
+        index_t num_ele = sizes[s];
+        std::vector<int32> xyz((size_t)(num_ele * 3 + 1));
+        std::vector<int32> y((size_t)(num_ele + 1));
+        for(index_t i=0; i < num_ele; i++)
+        {
+            xyz[i*3]   = (int32)i;
+            xyz[i*3+1] = (int32)(i * 7 + 3);
+            xyz[i*3+2] = -(int32)i;
+            y[i] = xyz[i*3+1];
+        }
+
+        uint64 h_compact = utils::hash64(&y[0],num_ele * sizeof(int32));
+        EXPECT_EQ(utils::hash64_strided(&y[0],num_ele,
+                                        sizeof(int32),sizeof(int32)),
+                  h_compact);
+        EXPECT_EQ(utils::hash64_strided(&xyz[1],num_ele,
+                                        sizeof(int32),3*sizeof(int32)),
+                  h_compact);
+    }
+}
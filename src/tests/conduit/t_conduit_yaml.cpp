@@ -628,3 +628,87 @@ TEST(conduit_yaml, dup_object_name_error)
     ASSERT_THROW(g3.walk(n),conduit::Error);
     EXPECT_TRUE(n3.dtype().is_empty());
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_yaml, parse_yaml_sequences)
+{
+    std::string yaml_txt = "ints: [1, 2, 3]\n"
+                           "floats: [1, 2.5, 3]\n"
+                           "mixed: [1, 2.5, here, [4, 5]]\n"
+                           "empty: []\n"
+                           "nested:\n"
+                           "  - a: 10\n"
+                           "  - [1.5, 2.5]\n";
+    Node n;
+    n.parse(yaml_txt,"yaml");
+    n.print();
+
+    EXPECT_EQ(n["ints"].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["ints"].dtype().number_of_elements(),3);
+    EXPECT_EQ(n["ints"].as_int64_ptr()[2],3);
+
+    // ints are promoted when a float is present
+    EXPECT_EQ(n["floats"].dtype().id(),DataType::FLOAT64_ID);
+    EXPECT_EQ(n["floats"].as_float64_ptr()[0],1.0);
+    EXPECT_EQ(n["floats"].as_float64_ptr()[1],2.5);
+
+    // non numeric values give a list, numbers keep their own types
+    EXPECT_TRUE(n["mixed"].dtype().is_list());
+    EXPECT_EQ(n["mixed"].number_of_children(),4);
+    EXPECT_EQ(n["mixed"][0].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["mixed"][1].dtype().id(),DataType::FLOAT64_ID);
+    EXPECT_EQ(n["mixed"][2].as_string(),"here");
+    EXPECT_EQ(n["mixed"][3].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["mixed"][3].dtype().number_of_elements(),2);
+
+    EXPECT_TRUE(n["empty"].dtype().is_empty());
+
+    EXPECT_EQ(n["nested"][0]["a"].as_int64(),10);
+    EXPECT_EQ(n["nested"][1].as_float64_ptr()[1],2.5);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_yaml, parse_yaml_anchors)
+{
+    std::string yaml_txt = "a: &val 10\n"
+                           "b: &obj\n"
+                           "  c: here\n"
+                           "  d: [1, 2]\n"
+                           "e: *val\n"
+                           "f: *obj\n"
+                           "g: [*val, 2, 3]\n";
+    Node n;
+    n.parse(yaml_txt,"yaml");
+    n.print();
+
+    EXPECT_EQ(n["e"].as_int64(),10);
+    EXPECT_EQ(n["f/c"].as_string(),"here");
+    EXPECT_EQ(n["f/d"].as_int64_ptr()[1],2);
+    EXPECT_EQ(n["g"].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["g"].as_int64_ptr()[0],10);
+
+    // undefined alias
+    Node n_err;
+    EXPECT_THROW(n_err.parse("a: *missing\n","yaml"),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_yaml, parse_yaml_large_sequence)
+{
+    index_t nvals = 200000;
+    Node n;
+    n["vals"].set(DataType::float64(nvals));
+    float64_array vals = n["vals"].value();
+    for(index_t i=0; i < nvals; i++)
+    {
+        vals[i] = i * 0.5;
+    }
+
+    std::string yaml_txt = n.to_yaml();
+
+    Node n_parsed;
+    n_parsed.parse(yaml_txt,"yaml");
+
+    Node info;
+    EXPECT_FALSE(n.diff(n_parsed,info));
+}
@@ -331,3 +331,154 @@ TEST(conduit_relay_io_handle, test_reuse_handle)
 
 }
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_conduit_bin_lazy_read)
+{
+    Node n;
+    n["a"] = (int64) 20;
+    n["b/vals"].set(DataType::float64(1000));
+    float64_array b_vals = n["b/vals"].value();
+    for(index_t i = 0; i < 1000; i++)
+    {
+        b_vals[i] = (float64) i;
+    }
+    n["b/name"] = "field";
+    n["c"].append() = (int32) 1;
+    n["c"].append() = (int32) 2;
+
+    std::string tout_file = "tout_conduit_relay_io_handle_lazy.conduit_bin";
+    relay::io::save(n,tout_file);
+
+    io::IOHandle h;
+    h.open(tout_file);
+
+    // structure is available before any data is read
+    EXPECT_TRUE(h.has_path("b/vals"));
+    EXPECT_TRUE(h.has_path("c"));
+    EXPECT_FALSE(h.has_path("e"));
+
+    std::vector<std::string> cnames;
+    h.list_child_names(cnames);
+    EXPECT_EQ(cnames.size(),3);
+    EXPECT_EQ(cnames[0],"a");
+    EXPECT_EQ(cnames[2],"c");
+
+    Node nread;
+    h.read("b/vals",nread);
+    Node info;
+    EXPECT_FALSE(n["b/vals"].diff(nread, info, 0.0));
+
+    // second read uses the cached data
+    nread.reset();
+    h.read("b",nread);
+    EXPECT_FALSE(n["b"].diff(nread, info, 0.0));
+
+    nread.reset();
+    h.read("c",nread);
+    EXPECT_FALSE(n["c"].diff(nread, info, 0.0));
+
+    nread.reset();
+    h.read(nread);
+    EXPECT_FALSE(n.diff(nread, info, 0.0));
+    h.close();
+
+    // a modified handle writes the full tree on close
+    h.open(tout_file);
+    Node n_e;
+    n_e = (float32) 3.5;
+    h.write(n_e,"e");
+    h.remove("a");
+    h.close();
+
+    Node n_check;
+    relay::io::load(tout_file,n_check);
+    n["e"] = (float32) 3.5;
+    n.remove("a");
+    EXPECT_FALSE(n.diff(n_check, info, 0.0));
+
+    // lazy reads also work with binary schema files
+    Node opts;
+    opts["conduit_bin/schema_format"] = "binary";
+    relay::io::save(n,tout_file,"conduit_bin",opts);
+    EXPECT_TRUE(utils::is_file(tout_file + "_schema_bin"));
+
+    Schema s;
+    relay::io::load_schema(tout_file,s);
+    EXPECT_EQ(s["b/vals"].dtype().number_of_elements(),1000);
+
+    h.open(tout_file);
+    EXPECT_TRUE(h.has_path("b/vals"));
+    nread.reset();
+    h.read("b/vals",nread);
+    EXPECT_FALSE(n["b/vals"].diff(nread, info, 0.0));
+    h.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_read_schema)
+{
+    std::string tfile_base = "tout_conduit_relay_io_handle_schema.";
+    std::vector<std::string> protocols;
+
+    protocols.push_back("conduit_bin");
+    protocols.push_back("json");
+    protocols.push_back("conduit_json");
+    protocols.push_back("yaml");
+
+    Node n_about;
+    io::about(n_about);
+
+    if(n_about["protocols/hdf5"].as_string() == "enabled")
+        protocols.push_back("hdf5");
+
+    Node n;
+    n["a"] = (int64) 20;
+    n["b/vals"].set(DataType::float64(100));
+    n["b/name"] = "field";
+
+    for (std::vector<std::string>::const_iterator itr = protocols.begin();
+             itr < protocols.end(); ++itr)
+    {
+        std::string protocol = *itr;
+        CONDUIT_INFO("Testing read_schema with protocol: " << protocol );
+        std::string test_file_name = tfile_base  + protocol;
+
+        relay::io::save(n,test_file_name);
+
+        // the schema should match what a full load produces
+        Node n_load;
+        relay::io::load(test_file_name,n_load);
+        Schema s_expect;
+        n_load.schema().compact_to(s_expect);
+
+        Schema s;
+        relay::io::load_schema(test_file_name,s);
+        EXPECT_TRUE(s.equals(s_expect));
+        EXPECT_EQ(s["b/vals"].dtype().number_of_elements(),100);
+
+        io::IOHandle h;
+        h.open(test_file_name);
+
+        h.read_schema(s);
+        EXPECT_TRUE(s.equals(s_expect));
+
+        // subpath results are compact too
+        Schema s_expect_b;
+        s_expect["b"].compact_to(s_expect_b);
+        h.read_schema("b",s);
+        EXPECT_TRUE(s.equals(s_expect_b));
+        EXPECT_TRUE(s["vals"].dtype().is_float64());
+
+        h.read_schema("a",s);
+        EXPECT_TRUE(s.dtype().is_int64());
+
+        EXPECT_THROW(h.read_schema("bad",s),conduit::Error);
+        h.close();
+    }
+
+    // schema reads aren't supported by every protocol
+    Schema s;
+    EXPECT_THROW(relay::io::load_schema("tout_schema.silo","conduit_silo_mesh",s),
+                 conduit::Error);
+}
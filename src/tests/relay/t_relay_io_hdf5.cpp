@@ -1335,3 +1335,63 @@ TEST(conduit_relay_io_hdf5, conduit_hdf5_write_read_string_compress)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, hdf5_read_schema)
+{
+    Node n;
+    n["a"].set_int64(12345689);
+    n["b/vals"].set(DataType::float32(10));
+    n["b/empty"];
+    n["b/zero"].set(DataType::float64(0));
+    n["b/grp"].set(DataType::object());
+    n["c"] = "my string";
+
+    // opposite endianness, which is converted on read
+    Node n_swap;
+    n_swap.set(n);
+    if(Endianness::machine_is_big_endian())
+    {
+        n_swap.endian_swap_to_little();
+    }
+    else
+    {
+        n_swap.endian_swap_to_big();
+    }
+
+    std::string tout_file = "tout_hdf5_read_schema.hdf5";
+    io::hdf5_write(n_swap,tout_file);
+
+    Node n_load;
+    io::hdf5_read(tout_file,n_load);
+    Schema s_expect;
+    n_load.schema().compact_to(s_expect);
+
+    Schema s;
+    io::hdf5_read_schema(tout_file,s);
+    s.print();
+    EXPECT_TRUE(s.equals(s_expect));
+    EXPECT_TRUE(s["a"].dtype().endianness_matches_machine());
+    EXPECT_TRUE(s["b/empty"].dtype().is_empty());
+    EXPECT_TRUE(s["b/grp"].dtype().is_object());
+    EXPECT_EQ(s["b/zero"].dtype().number_of_elements(),0);
+    EXPECT_EQ(s["b/vals"].dtype().number_of_elements(),10);
+    EXPECT_TRUE(s["c"].dtype().is_char8_str());
+
+    // file + internal path
+    io::hdf5_read_schema(tout_file + ":b/vals",s);
+    EXPECT_TRUE(s.dtype().is_float32());
+    EXPECT_EQ(s.dtype().number_of_elements(),10);
+
+    // hdf5 id + internal path
+    hid_t h5_file_id = io::hdf5_open_file_for_read(tout_file);
+    io::hdf5_read_schema(h5_file_id,"b",s);
+    EXPECT_EQ(s.number_of_children(),4);
+    EXPECT_EQ(s.child_name(0),"vals");
+    EXPECT_EQ(s["vals"].dtype().offset(),0);
+
+    EXPECT_THROW(io::hdf5_read_schema(h5_file_id,"bad",s),
+                 conduit::Error);
+
+    H5Fclose(h5_file_id);
+}
@@ -158,6 +158,161 @@ TEST(conduit_relay_io_hdf5, conduit_hdf5_write_synth)
 }
 
 
+//-----------------------------------------------------------------------------
+void
+dset_storage(const std::string &file_path,
+             const std::string &dset_path,
+             H5D_layout_t &layout,
+             int &num_filters)
+{
+    hid_t h5_file_id = io::hdf5_open_file_for_read(file_path);
+    hid_t h5_dset_id = H5Dopen(h5_file_id,dset_path.c_str(),H5P_DEFAULT);
+    EXPECT_TRUE(h5_dset_id >= 0);
+    hid_t h5_cprops_id = H5Dget_create_plist(h5_dset_id);
+    layout      = H5Pget_layout(h5_cprops_id);
+    num_filters = H5Pget_nfilters(h5_cprops_id);
+    H5Pclose(h5_cprops_id);
+    H5Dclose(h5_dset_id);
+    io::hdf5_close_file(h5_file_id);
+}
+
+//-----------------------------------------------------------------------------
+void
+create_opts_test_mesh(Node &n)
+{
+    n.reset();
+    n["topologies/mesh/elements/connectivity"].set(DataType::int32(1000));
+    n["topologies/mesh/elements/sizes"].set(DataType::int32(1000));
+    n["fields/pressure/values"].set(DataType::float64(1000));
+    n["fields/pressure/association"] = "element";
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_write_overrides)
+{
+    Node defaults_before;
+    io::hdf5_options(defaults_before);
+
+    Node n;
+    create_opts_test_mesh(n);
+
+    // chunk everything, but only compress the fields
+    Node opts;
+    opts["compact_storage/enabled"] = "false";
+    opts["chunking/threshold"]  = 100;
+    opts["chunking/chunk_size"] = 1000;
+    opts["chunking/compression/method"] = "none";
+    Node &fields_ovr = opts["overrides"].append();
+    fields_ovr["path"] = "fields";
+    fields_ovr["chunking/compression/method"] = "gzip";
+    fields_ovr["chunking/compression/level"]  = 1;
+    // connectivity is not chunked
+    Node &conn_ovr = opts["overrides"].append();
+    conn_ovr["path"] = "topologies/*/elements/connectivity";
+    conn_ovr["chunking/enabled"] = "false";
+
+    std::string ofile = "tout_hdf5_opts_overrides.hdf5";
+    io::hdf5_save(n,ofile,opts);
+
+    H5D_layout_t layout;
+    int num_filters;
+
+    dset_storage(ofile,"fields/pressure/values",layout,num_filters);
+    EXPECT_EQ(layout,H5D_CHUNKED);
+    EXPECT_TRUE(num_filters > 0);
+
+    dset_storage(ofile,"topologies/mesh/elements/sizes",layout,num_filters);
+    EXPECT_EQ(layout,H5D_CHUNKED);
+    EXPECT_EQ(num_filters,0);
+
+    dset_storage(ofile,
+                 "topologies/mesh/elements/connectivity",
+                 layout,
+                 num_filters);
+    EXPECT_EQ(layout,H5D_CONTIGUOUS);
+
+    // override paths are relative to the node being written
+    io::hdf5_save(n,ofile,"domain_0",opts);
+    dset_storage(ofile,"domain_0/fields/pressure/values",layout,num_filters);
+    EXPECT_TRUE(num_filters > 0);
+    dset_storage(ofile,
+                 "domain_0/topologies/mesh/elements/connectivity",
+                 layout,
+                 num_filters);
+    EXPECT_EQ(layout,H5D_CONTIGUOUS);
+
+    // the defaults are not changed by writes
+    Node defaults_after, info;
+    io::hdf5_options(defaults_after);
+    EXPECT_FALSE(defaults_before.diff(defaults_after,info));
+
+    // without options, the defaults are used
+    io::hdf5_save(n,ofile);
+    dset_storage(ofile,"fields/pressure/values",layout,num_filters);
+    EXPECT_EQ(layout,H5D_CONTIGUOUS);
+
+    // relay::io::save passes its hdf5 options to the write
+    Node save_opts;
+    save_opts["hdf5"].set(opts);
+    io::save(n,ofile,"hdf5",save_opts);
+    dset_storage(ofile,"fields/pressure/values",layout,num_filters);
+    EXPECT_TRUE(num_filters > 0);
+    io::hdf5_options(defaults_after);
+    EXPECT_FALSE(defaults_before.diff(defaults_after,info));
+
+    // overrides require a path
+    Node bad_opts;
+    bad_opts["overrides"].append()["chunking/enabled"] = "false";
+    EXPECT_THROW(io::hdf5_save(n,ofile,bad_opts),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_handle_write_options)
+{
+    Node n;
+    create_opts_test_mesh(n);
+
+    std::string ofile = "tout_hdf5_opts_handle.hdf5";
+    if(utils::is_file(ofile))
+    {
+        utils::remove_file(ofile);
+    }
+
+    // handle options are used for all writes
+    Node h_opts;
+    h_opts["hdf5/compact_storage/enabled"] = "false";
+    h_opts["hdf5/chunking/threshold"]  = 100;
+    h_opts["hdf5/chunking/chunk_size"] = 1000;
+
+    io::IOHandle h;
+    h.open(ofile,"hdf5",h_opts);
+    h.write(n,"a");
+
+    // options passed to a write are applied on top of the handle's
+    Node w_opts;
+    Node &ovr = w_opts["overrides"].append();
+    ovr["path"] = "fields";
+    ovr["chunking/compression/method"] = "none";
+    h.write(n,"b",w_opts);
+    h.close();
+
+    H5D_layout_t layout;
+    int num_filters;
+
+    dset_storage(ofile,"a/fields/pressure/values",layout,num_filters);
+    EXPECT_EQ(layout,H5D_CHUNKED);
+    EXPECT_TRUE(num_filters > 0);
+
+    dset_storage(ofile,"b/fields/pressure/values",layout,num_filters);
+    EXPECT_EQ(layout,H5D_CHUNKED);
+    EXPECT_EQ(num_filters,0);
+
+    dset_storage(ofile,"b/topologies/mesh/elements/sizes",layout,num_filters);
+    EXPECT_EQ(layout,H5D_CHUNKED);
+    EXPECT_TRUE(num_filters > 0);
+}
+
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -61,8 +61,8 @@ using namespace conduit::relay;
 //-----------------------------------------------------------------------------
 // This example tests reads of slabs from a hdf5 dataset.
 // 
-// we may provide something like this in in the relay hdf5 interface
-// in the future. 
+// relay::io::hdf5_read provides this via the offset, stride and count
+// read options (see the hyperslab_opts tests below).
 //-----------------------------------------------------------------------------
 bool
 hdf5_read_dset_slab(const std::string &file_path,
@@ -284,3 +284,392 @@ TEST(conduit_relay_io_hdf5, hdf5_dset_slab_read_test)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, hdf5_read_hyperslab_opts)
+{
+    Node n;
+    n["full_data"].set(DataType::float64(20));
+    n["ids"].set(DataType::int32(20));
+
+    float64 *vin = n["full_data"].value();
+    int32   *ids = n["ids"].value();
+    for(int i=0;i<20;i++)
+    {
+        vin[i] = i;
+        ids[i] = 100 + i;
+    }
+
+    io::hdf5_save(n,"tout_hdf5_slab_opts.hdf5");
+
+    // every other entry, starting at 1
+    Node opts;
+    opts["offset"] = 1;
+    opts["stride"] = 2;
+
+    Node nload;
+    io::hdf5_read("tout_hdf5_slab_opts.hdf5:full_data",opts,nload);
+    EXPECT_EQ(nload.dtype().number_of_elements(),10);
+    float64 *vload = nload.value();
+    for(int i=0;i<10;i++)
+    {
+        EXPECT_EQ(vload[i],1.0 + i * 2.0);
+    }
+
+    // offset + count
+    opts.reset();
+    opts["offset"] = 15;
+    opts["count"]  = 5;
+    nload.reset();
+    io::hdf5_read("tout_hdf5_slab_opts.hdf5","ids",opts,nload);
+    EXPECT_EQ(nload.dtype().number_of_elements(),5);
+    int32_array ids_load = nload.value();
+    EXPECT_EQ(ids_load[0],115);
+    EXPECT_EQ(ids_load[4],119);
+
+    // read into an existing compatible node
+    Node ndest(DataType::int32(5));
+    void *ndest_ptr = ndest.data_ptr();
+    opts["offset"] = 0;
+    io::hdf5_read("tout_hdf5_slab_opts.hdf5","ids",opts,ndest);
+    EXPECT_EQ(ndest.data_ptr(),ndest_ptr);
+    EXPECT_EQ(ndest.as_int32_ptr()[4],104);
+
+    // empty selection
+    opts["count"] = 0;
+    nload.reset();
+    io::hdf5_read("tout_hdf5_slab_opts.hdf5","ids",opts,nload);
+    EXPECT_TRUE(nload.dtype().is_int32());
+    EXPECT_EQ(nload.dtype().number_of_elements(),0);
+
+    // selection is applied to each dataset of a group
+    opts.reset();
+    opts["offset"] = 18;
+    hid_t h5_id = io::hdf5_open_file_for_read("tout_hdf5_slab_opts.hdf5");
+    nload.reset();
+    io::hdf5_read(h5_id,opts,nload);
+    io::hdf5_close_file(h5_id);
+    EXPECT_EQ(nload["full_data"].dtype().number_of_elements(),2);
+    EXPECT_EQ(nload["ids"].dtype().number_of_elements(),2);
+
+    // handle reads
+    io::IOHandle h;
+    h.open("tout_hdf5_slab_opts.hdf5");
+    nload.reset();
+    h.read(nload,opts);
+    EXPECT_EQ(nload["full_data"].dtype().number_of_elements(),2);
+    EXPECT_EQ(nload["full_data"].as_float64_ptr()[1],19.0);
+    EXPECT_EQ(nload["ids"].as_int32_ptr()[0],118);
+
+    // handle subpath read
+    opts["count"] = 1;
+    nload.reset();
+    h.read("ids",nload,opts);
+    EXPECT_EQ(nload.dtype().number_of_elements(),1);
+    EXPECT_EQ(nload.to_int32(),118);
+    h.close();
+
+    // other protocols don't support hyperslab options
+    io::save(n,"tout_hdf5_slab_opts.json");
+    h.open("tout_hdf5_slab_opts.json");
+    EXPECT_THROW(h.read(nload,opts),conduit::Error);
+    Node no_opts;
+    nload.reset();
+    h.read("ids",nload,no_opts);
+    EXPECT_EQ(nload.dtype().number_of_elements(),20);
+    h.close();
+
+    // errors
+    // (note: these leave the file open, so they are checked last)
+
+    // out of bounds
+    opts.reset();
+    opts["offset"] = 10;
+    opts["count"]  = 11;
+    EXPECT_THROW(io::hdf5_read("tout_hdf5_slab_opts.hdf5:ids",opts,nload),
+                 conduit::Error);
+    opts.reset();
+    opts["stride"] = 0;
+    EXPECT_THROW(io::hdf5_read("tout_hdf5_slab_opts.hdf5:ids",opts,nload),
+                 conduit::Error);
+    // one value per dimension
+    opts.reset();
+    int64 offsets[2] = {0, 0};
+    opts["offset"].set(offsets,2);
+    EXPECT_THROW(io::hdf5_read("tout_hdf5_slab_opts.hdf5:ids",opts,nload),
+                 conduit::Error);
+    // strings can't be sliced
+    Node n_str;
+    n_str["name"] = "my name";
+    io::hdf5_save(n_str,"tout_hdf5_slab_opts_str.hdf5");
+    opts.reset();
+    opts["count"] = 2;
+    EXPECT_THROW(io::hdf5_read("tout_hdf5_slab_opts_str.hdf5:name",
+                               opts,
+                               nload),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, hdf5_read_hyperslab_opts_2d)
+{
+    // create a 4x6 dataset with the hdf5 api
+    int64 vals[4][6];
+    for(int i=0;i<4;i++)
+    {
+        for(int j=0;j<6;j++)
+        {
+            vals[i][j] = i * 10 + j;
+        }
+    }
+
+    hid_t h5_file_id = io::hdf5_create_file("tout_hdf5_slab_opts_2d.hdf5");
+    hsize_t dims[2] = {4,6};
+    hid_t h5_dspace_id = H5Screate_simple(2,dims,NULL);
+    hid_t h5_dset_id   = H5Dcreate(h5_file_id,
+                                   "vals",
+                                   H5T_NATIVE_INT64,
+                                   h5_dspace_id,
+                                   H5P_DEFAULT,
+                                   H5P_DEFAULT,
+                                   H5P_DEFAULT);
+    EXPECT_TRUE(H5Dwrite(h5_dset_id,
+                         H5T_NATIVE_INT64,
+                         H5S_ALL,
+                         H5S_ALL,
+                         H5P_DEFAULT,
+                         vals) >= 0);
+    H5Dclose(h5_dset_id);
+    H5Sclose(h5_dspace_id);
+    io::hdf5_close_file(h5_file_id);
+
+    // rows 1 and 3, columns 2 to 4
+    int64 offset[2] = {1,2};
+    int64 stride[2] = {2,1};
+    int64 count[2]  = {2,3};
+    Node opts;
+    opts["offset"].set(offset,2);
+    opts["stride"].set(stride,2);
+    opts["count"].set(count,2);
+
+    Node nload;
+    io::hdf5_read("tout_hdf5_slab_opts_2d.hdf5:vals",opts,nload);
+    EXPECT_EQ(nload.dtype().number_of_elements(),6);
+    int64_array res = nload.value();
+    EXPECT_EQ(res[0],12);
+    EXPECT_EQ(res[2],14);
+    EXPECT_EQ(res[3],32);
+    EXPECT_EQ(res[5],34);
+
+    // default count reads to the end of each dimension
+    opts.remove("count");
+    io::hdf5_read("tout_hdf5_slab_opts_2d.hdf5:vals",opts,nload);
+    EXPECT_EQ(nload.dtype().number_of_elements(),8);
+    res = nload.value();
+    EXPECT_EQ(res[3],15);
+    EXPECT_EQ(res[7],35);
+
+    // scalar options need a 1-D dataset
+    opts.reset();
+    opts["offset"] = 1;
+    EXPECT_THROW(io::hdf5_read("tout_hdf5_slab_opts_2d.hdf5:vals",opts,nload),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, hdf5_write_hyperslab_opts)
+{
+    hid_t h5_id = io::hdf5_create_file("tout_hdf5_slab_write_opts.hdf5");
+
+    // pre-create a dataset of 20 elements by writing its first slab
+    Node vals;
+    vals.set(DataType::float64(5));
+    float64 *vals_ptr = vals.value();
+    for(int i=0;i<5;i++)
+    {
+        vals_ptr[i] = i;
+    }
+
+    Node opts;
+    opts["offset"] = 0;
+    opts["dims"]   = 20;
+    io::hdf5_write(vals,h5_id,"fields/pressure",opts);
+
+    // other writers fill disjoint regions
+    for(int w=1;w<4;w++)
+    {
+        for(int i=0;i<5;i++)
+        {
+            vals_ptr[i] = w * 5 + i;
+        }
+        opts.reset();
+        opts["offset"] = w * 5;
+        io::hdf5_write(vals,h5_id,"fields/pressure",opts);
+    }
+
+    Node nload;
+    io::hdf5_read(h5_id,"fields/pressure",nload);
+    EXPECT_EQ(nload.dtype().number_of_elements(),20);
+    float64_array res = nload.value();
+    for(int i=0;i<20;i++)
+    {
+        EXPECT_EQ(res[i],(float64)i);
+    }
+
+    // strided writes, from a non compact node
+    Node n_strided;
+    n_strided.set(DataType::float64(4));
+    float64 *strided_ptr = n_strided.value();
+    for(int i=0;i<4;i++)
+    {
+        strided_ptr[i] = -i;
+    }
+    Node n_view;
+    n_view.set_external(DataType::float64(2,0,2*sizeof(float64)),
+                        strided_ptr);
+    opts.reset();
+    opts["offset"] = 1;
+    opts["stride"] = 3;
+    io::hdf5_write(n_view,h5_id,"fields/pressure",opts);
+    io::hdf5_read(h5_id,"fields/pressure",nload);
+    res = nload.value();
+    EXPECT_EQ(res[1],0.0);
+    EXPECT_EQ(res[2],2.0);
+    EXPECT_EQ(res[4],-2.0);
+
+    // object writes apply the options to each leaf
+    Node n_cycle;
+    n_cycle["time"]  = 0.5;
+    n_cycle["cycle"] = (int64) 10;
+    for(int c=0;c<3;c++)
+    {
+        n_cycle["time"]  = 0.5 * c;
+        n_cycle["cycle"] = (int64) (10 + c);
+        opts.reset();
+        opts["offset"] = c;
+        // time series: each write extends the datasets
+        io::hdf5_write(n_cycle,h5_id,"series",opts);
+    }
+    io::hdf5_read(h5_id,"series",nload);
+    EXPECT_EQ(nload["time"].dtype().number_of_elements(),3);
+    EXPECT_EQ(nload["cycle"].as_int64_ptr()[2],12);
+    EXPECT_EQ(nload["time"].as_float64_ptr()[1],0.5);
+
+    // 2d slabs
+    int32 block[6] = {1,2,3,4,5,6};
+    Node n_block;
+    n_block.set_external(block,6);
+    int64 offset_2d[2] = {1,2};
+    int64 count_2d[2]  = {2,3};
+    int64 dims_2d[2]   = {4,6};
+    opts.reset();
+    opts["offset"].set(offset_2d,2);
+    opts["count"].set(count_2d,2);
+    opts["dims"].set(dims_2d,2);
+    io::hdf5_write(n_block,h5_id,"block",opts);
+    Node read_opts;
+    read_opts["offset"].set(offset_2d,2);
+    read_opts["count"].set(count_2d,2);
+    io::hdf5_read(h5_id,"block",read_opts,nload);
+    int32_array block_res = nload.value();
+    EXPECT_EQ(block_res[0],1);
+    EXPECT_EQ(block_res[5],6);
+    io::hdf5_read(h5_id,"block",nload);
+    EXPECT_EQ(nload.dtype().number_of_elements(),24);
+    EXPECT_EQ(nload.as_int32_ptr()[8],1);
+    EXPECT_EQ(nload.as_int32_ptr()[0],0);
+
+    // handle writes
+    io::hdf5_close_file(h5_id);
+    io::IOHandle h;
+    h.open("tout_hdf5_slab_write_opts.hdf5");
+    vals_ptr[0] = 100.0;
+    opts.reset();
+    opts["offset"] = 15;
+    h.write(vals,"fields/pressure",opts);
+    h.read("fields/pressure",nload);
+    EXPECT_EQ(nload.as_float64_ptr()[15],100.0);
+    EXPECT_EQ(nload.dtype().number_of_elements(),20);
+    h.close();
+
+    // errors
+    h5_id = io::hdf5_open_file_for_read_write("tout_hdf5_slab_write_opts.hdf5");
+    // type mismatch with an existing dataset
+    Node n_int;
+    n_int.set(DataType::int32(5));
+    opts.reset();
+    opts["offset"] = 0;
+    EXPECT_THROW(io::hdf5_write(n_int,h5_id,"fields/pressure",opts),
+                 conduit::Error);
+    // selection does not match the number of elements
+    opts.reset();
+    opts["count"] = 4;
+    EXPECT_THROW(io::hdf5_write(vals,h5_id,"fields/pressure",opts),
+                 conduit::Error);
+    // datasets created without hyperslab options have a fixed extent
+    Node n_fixed;
+    n_fixed.set(DataType::float64(5));
+    io::hdf5_write(n_fixed,h5_id,"fixed");
+    opts.reset();
+    opts["offset"] = 3;
+    EXPECT_THROW(io::hdf5_write(n_fixed,h5_id,"fixed",opts),
+                 conduit::Error);
+    opts["offset"] = 0;
+    io::hdf5_write(n_fixed,h5_id,"fixed",opts);
+    // count is required for N-D writes
+    opts.reset();
+    opts["offset"].set(offset_2d,2);
+    EXPECT_THROW(io::hdf5_write(n_block,h5_id,"block",opts),
+                 conduit::Error);
+    io::hdf5_close_file(h5_id);
+
+    // other protocols don't support hyperslab options
+    std::string json_file_name = "tout_hdf5_slab_write_opts.json";
+    if(utils::is_file(json_file_name))
+    {
+        utils::remove_file(json_file_name);
+    }
+    h.open(json_file_name);
+    EXPECT_THROW(h.write(vals,"vals",opts),conduit::Error);
+    h.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, hdf5_write_hyperslab_chunk_size)
+{
+    std::string ofile = "tout_hdf5_slab_write_chunk_size.hdf5";
+    hid_t h5_id = io::hdf5_create_file(ofile);
+
+    // slabs larger than the chunk size option are split across chunks
+    Node vals;
+    vals.set(DataType::float64(1000));
+    Node opts;
+    opts["offset"] = 0;
+    opts["chunking/chunk_size"] = 800;
+    io::hdf5_write(vals,h5_id,"vals",opts);
+
+    int64 count_2d[2] = {4,500};
+    Node block;
+    block.set(DataType::int64(2000));
+    opts.reset();
+    opts["count"].set(count_2d,2);
+    opts["chunking/chunk_size"] = 800;
+    io::hdf5_write(block,h5_id,"block",opts);
+
+    const char *dset_names[2] = {"vals", "block"};
+    hsize_t     expected[2][2] = {{100,0}, {1,100}};
+    for(int i=0; i < 2; i++)
+    {
+        hid_t h5_dset_id = H5Dopen(h5_id,dset_names[i],H5P_DEFAULT);
+        hid_t h5_cprops_id = H5Dget_create_plist(h5_dset_id);
+        hsize_t chunk[2] = {0,0};
+        int chunk_rank = H5Pget_chunk(h5_cprops_id,2,chunk);
+        EXPECT_EQ(chunk_rank,i+1);
+        EXPECT_EQ(chunk[0],expected[i][0]);
+        EXPECT_EQ(chunk[1],expected[i][1]);
+        H5Pclose(h5_cprops_id);
+        H5Dclose(h5_dset_id);
+    }
+
+    io::hdf5_close_file(h5_id);
+}
@@ -0,0 +1,249 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_relay_mpi_io_hdf5.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay_mpi_io.hpp"
+#include "conduit_relay_mpi_io_hdf5.hpp"
+#include <iostream>
+#include "gtest/gtest.h"
+
+#include <mpi.h>
+
+using namespace conduit;
+using namespace conduit::relay;
+
+//-----------------------------------------------------------------------------
+void
+create_rank_data(Node &n, int rank)
+{
+    n.reset();
+    n["domain_id"] = (int64) rank;
+    // each rank has a different number of values
+    n["fields/pressure/values"].set(DataType::float64(rank + 3));
+    float64 *vals_ptr = n["fields/pressure/values"].value();
+    for(int i = 0; i < rank + 3; i++)
+    {
+        vals_ptr[i] = rank * 100 + i;
+    }
+    n["fields/pressure/association"] = "element";
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_io_hdf5, shared_file_rank_groups)
+{
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    Node n;
+    create_rank_data(n, rank);
+
+    std::string ofile = "tout_relay_mpi_io_hdf5_rank_groups.hdf5";
+
+    Node opts;
+    opts["hdf5/shared_file/layout"] = "rank_groups";
+    mpi::io::save(n, ofile, "hdf5", opts, MPI_COMM_WORLD);
+
+    Node n_load, info;
+    mpi::io::load(ofile, "hdf5", opts, n_load, MPI_COMM_WORLD);
+    EXPECT_FALSE(n.diff(n_load, info));
+
+    // the shared file can be read with serial hdf5
+    if(rank == 0)
+    {
+        Node n_all;
+        mpi::io::hdf5_read(ofile, n_all);
+        EXPECT_EQ(n_all.number_of_children(), size);
+        for(int r = 0; r < size; r++)
+        {
+            Node n_rank;
+            create_rank_data(n_rank, r);
+            std::ostringstream oss;
+            oss << "rank_" << r;
+            EXPECT_FALSE(n_rank.diff(n_all[oss.str()], info));
+        }
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_io_hdf5, shared_file_concatenate)
+{
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    Node n;
+    create_rank_data(n, rank);
+    // strings are not supported by the concatenate layout
+    n.remove("fields/pressure/association");
+
+    // write from a non compact node
+    Node n_strided;
+    n_strided["domain_id"] = (int64) rank;
+    n_strided["vals"].set(DataType::int32(4));
+    int32 *strided_ptr = n_strided["vals"].value();
+    for(int i = 0; i < 4; i++)
+    {
+        strided_ptr[i] = rank * 10 + i;
+    }
+    n["strided"].set_external(DataType::int32(2,0,2*sizeof(int32)),
+                              strided_ptr);
+
+    std::string ofile = "tout_relay_mpi_io_hdf5_concatenate.hdf5";
+
+    Node opts;
+    opts["layout"] = "concatenate";
+    mpi::io::hdf5_save_shared(n, ofile, opts, MPI_COMM_WORLD);
+
+    Node n_load, info;
+    mpi::io::hdf5_load_shared(ofile, n_load, MPI_COMM_WORLD);
+    EXPECT_EQ(n_load["domain_id"].to_int64(), rank);
+    EXPECT_EQ(n_load["fields/pressure/values"].dtype().number_of_elements(),
+              rank + 3);
+    EXPECT_FALSE(n["fields/pressure/values"].diff(
+                                        n_load["fields/pressure/values"],
+                                        info));
+    EXPECT_EQ(n_load["strided"].as_int32_ptr()[1], rank * 10 + 2);
+
+    // each leaf holds the values of all ranks, in rank order
+    if(rank == 0)
+    {
+        Node n_all;
+        mpi::io::hdf5_read(ofile, n_all);
+        EXPECT_EQ(n_all["domain_id"].dtype().number_of_elements(), size);
+        int64_array domain_ids = n_all["domain_id"].value();
+        float64_array vals = n_all["fields/pressure/values"].value();
+        index_t idx = 0;
+        for(int r = 0; r < size; r++)
+        {
+            EXPECT_EQ(domain_ids[r], r);
+            for(int i = 0; i < r + 3; i++)
+            {
+                EXPECT_EQ(vals[idx], r * 100 + i);
+                idx++;
+            }
+        }
+        EXPECT_EQ(vals.number_of_elements(), idx);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_io_hdf5, shared_file_errors)
+{
+    int rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    Node n;
+    create_rank_data(n, rank);
+
+    std::string ofile = "tout_relay_mpi_io_hdf5_errors.hdf5";
+
+    // strings can't be concatenated
+    Node opts;
+    opts["layout"] = "concatenate";
+    EXPECT_THROW(mpi::io::hdf5_save_shared(n, ofile, opts, MPI_COMM_WORLD),
+                 conduit::Error);
+
+    // the trees must match
+    n.remove("fields/pressure/association");
+    if(rank == 1)
+    {
+        n["extra"] = 1;
+    }
+    EXPECT_THROW(mpi::io::hdf5_save_shared(n, ofile, opts, MPI_COMM_WORLD),
+                 conduit::Error);
+
+    opts["layout"] = "unknown";
+    EXPECT_THROW(mpi::io::hdf5_save_shared(n, ofile, opts, MPI_COMM_WORLD),
+                 conduit::Error);
+
+    // lists are not supported
+    Node n_list;
+    n_list.append() = 1;
+    EXPECT_THROW(mpi::io::hdf5_save_shared(n_list, ofile, MPI_COMM_WORLD),
+                 conduit::Error);
+
+    // the ranks take turns writing. when a turn fails (here the last rank
+    // can't open the file), every rank raises an error instead of waiting
+    // on the failed rank
+    int size = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    std::string turn_ofile = ofile;
+    if(rank == size - 1)
+    {
+        turn_ofile = "tout_missing_dir/" + ofile;
+    }
+    EXPECT_THROW(mpi::io::hdf5_save_shared(n, turn_ofile, MPI_COMM_WORLD),
+                 conduit::Error);
+
+    // files not written by hdf5_save_shared can't be loaded
+    if(rank == 0)
+    {
+        mpi::io::hdf5_save(n, ofile);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+    Node n_load;
+    EXPECT_THROW(mpi::io::hdf5_load_shared(ofile, n_load, MPI_COMM_WORLD),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
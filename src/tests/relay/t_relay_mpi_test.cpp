@@ -474,6 +474,53 @@ TEST(conduit_mpi_test, send_recv_using_schema)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, recv_using_schema_json_message)
+{
+    Node n;
+    int rank = mpi::rank(MPI_COMM_WORLD);
+
+    if( rank == 0 )
+    {
+        // send a message with a json schema, as older versions did
+        Node n_data;
+        n_data["value/a"] = 1;
+        n_data["value/b"] = 2.5;
+
+        Schema s_data_compact;
+        n_data.schema().compact_to(s_data_compact);
+        std::string snd_schema_json = s_data_compact.to_json();
+
+        Schema s_msg;
+        s_msg["schema_len"].set(DataType::int64());
+        s_msg["schema"].set(DataType::char8_str(snd_schema_json.size()+1));
+        s_msg["data"].set(s_data_compact);
+
+        Schema s_msg_compact;
+        s_msg.compact_to(s_msg_compact);
+
+        Node n_msg(s_msg_compact);
+        n_msg["schema_len"].set((int64)snd_schema_json.length());
+        n_msg["schema"].set(snd_schema_json);
+        n_msg["data"].update(n_data);
+
+        MPI_Send(n_msg.data_ptr(),
+                 static_cast<int>(n_msg.total_bytes_compact()),
+                 MPI_BYTE,
+                 1,
+                 0,
+                 MPI_COMM_WORLD);
+    }
+    else if( rank == 1 )
+    {
+        mpi::recv_using_schema(n,0,0,MPI_COMM_WORLD);
+
+        EXPECT_EQ(n["value/a"].to_int(), 1);
+        EXPECT_EQ(n["value/b"].to_double(), 2.5);
+    }
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_mpi_test, send_recv_without_using_schema)
 {